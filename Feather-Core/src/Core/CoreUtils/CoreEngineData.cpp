@@ -58,17 +58,17 @@ namespace Feather {
 	void CoreEngineData::RegisterMetaFunctions()
 	{
 		Entity::RegisterMetaComponent<Identification>();
-		Entity::RegisterMetaComponent<TransformComponent>();
-		Entity::RegisterMetaComponent<SpriteComponent>();
-		Entity::RegisterMetaComponent<AnimationComponent>();
-		Entity::RegisterMetaComponent<BoxColliderComponent>();
-		Entity::RegisterMetaComponent<CircleColliderComponent>();
-		Entity::RegisterMetaComponent<PhysicsComponent>();
-		Entity::RegisterMetaComponent<RigidBodyComponent>();
-		Entity::RegisterMetaComponent<TextComponent>();
+		Entity::RegisterMetaComponent<TransformComponent>("transform");
+		Entity::RegisterMetaComponent<SpriteComponent>("sprite");
+		Entity::RegisterMetaComponent<AnimationComponent>("animation");
+		Entity::RegisterMetaComponent<BoxColliderComponent>("boxCollider");
+		Entity::RegisterMetaComponent<CircleColliderComponent>("circleCollider");
+		Entity::RegisterMetaComponent<PhysicsComponent>("physics");
+		Entity::RegisterMetaComponent<RigidBodyComponent>("rigidBody");
+		Entity::RegisterMetaComponent<TextComponent>("text");
 		Entity::RegisterMetaComponent<TileComponent>();
 		Entity::RegisterMetaComponent<Relationship>();
-		Entity::RegisterMetaComponent<UIComponent>();
+		Entity::RegisterMetaComponent<UIComponent>("ui");
 
 		Registry::RegisterMetaComponent<Identification>();
 		Registry::RegisterMetaComponent<TransformComponent>();
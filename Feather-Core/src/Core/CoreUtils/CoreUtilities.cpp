@@ -4,7 +4,9 @@
 #include "Core/Scene/Scene.h"
 #include "Core/Resources/AssetManager.h"
 #include "Core/ECS/Registry.h"
+#include "Core/Tilemap/Tilemap.h"
 #include "Renderer/Essentials/Font.h"
+#include "Utils/FeatherUtilities.h"
 #include "Utils/MathUtilities.h"
 
 namespace Feather {
@@ -51,6 +53,14 @@ namespace Feather {
 		return model;
     }
 
+	glm::mat4 WorldModel(const TransformComponent& transform, const WorldTransformComponent* pWorldTransform, float width, float height)
+	{
+		if (pWorldTransform && pWorldTransform->IsCurrent(transform, width, height))
+			return pWorldTransform->model;
+
+		return TRSModel(transform, width, height);
+	}
+
 	void GenerateUVs(SpriteComponent& sprite, int textureWidth, int textureHeight)
 	{
 		sprite.uvs.uv_width = sprite.width / textureWidth;
@@ -213,4 +223,36 @@ namespace Feather {
 		}
 	}
 
+	void PreloadSceneAssets(Registry& registry, AssetManager& assetManager, const std::string& defaultMusic)
+	{
+		auto& reg = registry.GetRegistry();
+
+		std::unordered_set<std::string> textureNames;
+		for (const auto& [entity, sprite] : reg.view<SpriteComponent>().each())
+		{
+			if (!sprite.textureName.empty())
+				textureNames.insert(sprite.textureName);
+		}
+
+		if (auto* pTilemap = registry.TryGetContext<std::shared_ptr<Tilemap>>(); pTilemap && *pTilemap)
+		{
+			const auto& tilemapTextures = (*pTilemap)->GetTextureNames();
+			textureNames.insert(tilemapTextures.begin(), tilemapTextures.end());
+		}
+
+		std::unordered_set<std::string> fontNames;
+		for (const auto& [entity, text] : reg.view<TextComponent>().each())
+		{
+			fontNames.insert(text.fontName);
+		}
+
+		assetManager.PreloadAssets(std::vector<std::string>{ textureNames.begin(), textureNames.end() }, AssetType::TEXTURE);
+		assetManager.PreloadAssets(std::vector<std::string>{ fontNames.begin(), fontNames.end() }, AssetType::FONT);
+
+		if (!defaultMusic.empty())
+		{
+			assetManager.PreloadAssets({ defaultMusic }, AssetType::MUSIC);
+		}
+	}
+
 }
@@ -36,6 +36,17 @@ namespace Feather {
 	*/
 	glm::mat4 TRSModel(const TransformComponent& transform, float width, float height);
 
+	/**
+	* @brief Returns the model matrix cached by the TransformSystem, or builds it if the cache is missing or stale.
+	*
+	* @param transform The transform component containing position, rotation, and scale.
+	* @param pWorldTransform The cached world transform of the entity, may be null.
+	* @param width The object's width, used for pivot adjustments.
+	* @param height The object's height, used for pivot adjustments.
+	* @return The transformation matrix, the same as TRSModel would compute.
+	*/
+	glm::mat4 WorldModel(const TransformComponent& transform, const WorldTransformComponent* pWorldTransform, float width, float height);
+
 	/**
 	* @brief Generates UV coordinates for a sprite based on its dimensions and texture size.
 	*
@@ -80,9 +91,18 @@ namespace Feather {
 	 */
 	void UpdateDirtyEntities(Registry& registry);
 
-	/* Target time per frame. Used to help clamp delta time */
+	/**
+	 * @brief Loads the packed assets used by the entities and tilemap of the loaded scene.
+	 * Avoids decoding the scene's assets lazily during its first frames.
+	 * @param registry The registry the scene was loaded into.
+	 * @param assetManager Asset manager holding the packed assets.
+	 * @param defaultMusic Default music of the scene. Ignored if empty.
+	 */
+	void PreloadSceneAssets(Registry& registry, AssetManager& assetManager, const std::string& defaultMusic);
+
+	/* Fixed time of one physics step. Frame time is accumulated and consumed in steps of this size */
 	constexpr double TARGET_FRAME_TIME = 1.0 / 60.0;
-	/* Target time per frame. Used for Box2D step */
+	/* Fixed time of one physics step. Used for Box2D step */
 	constexpr float TARGET_FRAME_TIME_F = 1.0f / 60.0f;
 	/* Used to prevent specific loops from looping forever */
 	constexpr int SANITY_LOOP_CHECK = 100;
@@ -3,7 +3,7 @@
 #include "Logger/Logger.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/ECS/Entity.h"
-#include "Core/ECS/ECSUtils.h"
+#include "Core/ECS/EntityTagIndex.h"
 #include "Core/ECS/Components/ComponentSerializer.h"
 #include "Core/CoreUtils/ProjectInfo.h"
 #include "Core/CoreUtils/CoreUtilities.h"
@@ -436,19 +436,7 @@ namespace Feather {
 		const auto& prefabbed = prefab.GetPrefabbedEntity();
 		
 		// Remove the _pfab from the prefabbed id
-		std::string tag{ RemoveSuffixCopy(prefabbed.id->name, "_pfab") };
-		std::string checkTag{ tag };
-		int current{ 0 };
-
-		entt::entity hasEntity = FindEntityByTag(registry, tag);
-		while (hasEntity != entt::null)
-		{
-			checkTag = tag + std::to_string(current);
-			hasEntity = FindEntityByTag(registry, tag);
-			++current;
-		}
-
-		tag = checkTag;
+		std::string tag{ registry.GetTagIndex().GetUniqueName(RemoveSuffixCopy(prefabbed.id->name, "_pfab")) };
 
 		auto newEnt = std::make_shared<Entity>(&registry, tag, prefabbed.id->group);
 
@@ -153,6 +153,10 @@ namespace Feather {
 		float gravity{ 9.8f };
 
 		bool packageAssets{ false };
+		/* Memory budget in MB for packaged assets. Zero keeps every loaded asset resident */
+		int assetMemoryBudget{ 0 };
+		/* Packages assets into the previous zip of lua asset tables instead of the asset pack, to compare their load times */
+		bool legacyAssetZip{ false };
 
 		AudioConfigInfo audioConfig{};
 
@@ -177,6 +181,8 @@ namespace Feather {
 			audioConfig = {};
 
 			packageAssets = false;
+			assetMemoryBudget = 0;
+			legacyAssetZip = false;
 		}
 	};
 
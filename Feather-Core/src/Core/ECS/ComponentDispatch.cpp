@@ -0,0 +1,78 @@
+#include "ComponentDispatch.h"
+
+#include "Entity.h"
+#include "MetaUtilities.h"
+
+namespace Feather {
+
+	namespace {
+
+		/* Raw field on the component usertype table that holds its index in the dispatch table */
+		constexpr const char* COMPONENT_INDEX_KEY = "__componentIndex";
+
+	}
+
+	void LuaComponentDispatch::Register(LuaComponentFunctions functions)
+	{
+		auto& components = GetComponents();
+		if (auto componentItr = std::ranges::find(components, functions.typeId, &LuaComponentFunctions::typeId); componentItr != components.end())
+		{
+			// Keep the index, it may already be stored on a usertype table
+			*componentItr = std::move(functions);
+			return;
+		}
+
+		components.push_back(std::move(functions));
+	}
+
+	const LuaComponentFunctions* LuaComponentDispatch::Find(sol::table& component)
+	{
+		if (!component.valid())
+			return nullptr;
+
+		const auto& components = GetComponents();
+
+		// sol accepts component instances as tables, they are userdata and cannot hold the raw index
+		if (component.get_type() != sol::type::table)
+		{
+			auto componentItr = std::ranges::find(components, GetIdType(component), &LuaComponentFunctions::typeId);
+			return componentItr != components.end() ? &*componentItr : nullptr;
+		}
+
+		if (auto index = component.raw_get<sol::optional<uint32_t>>(COMPONENT_INDEX_KEY))
+			return *index < components.size() ? &components[*index] : nullptr;
+
+		// First time this table is used, find it by its type id and remember the index
+		auto componentItr = std::ranges::find(components, GetIdType(component), &LuaComponentFunctions::typeId);
+		if (componentItr == components.end())
+			return nullptr;
+
+		component.raw_set(COMPONENT_INDEX_KEY, static_cast<uint32_t>(std::distance(components.begin(), componentItr)));
+		return &*componentItr;
+	}
+
+	const LuaComponentFunctions* LuaComponentDispatch::Find(const sol::object& component)
+	{
+		if (!component.is<sol::table>())
+			return nullptr;
+
+		sol::table componentTable = component.as<sol::table>();
+		return Find(componentTable);
+	}
+
+	void LuaComponentDispatch::CreateShortcuts(sol::usertype<Entity>& entityType)
+	{
+		for (const auto& functions : GetComponents())
+		{
+			if (!functions.shortcutName.empty())
+				entityType.set(functions.shortcutName, functions.get);
+		}
+	}
+
+	std::vector<LuaComponentFunctions>& LuaComponentDispatch::GetComponents()
+	{
+		static std::vector<LuaComponentFunctions> components;
+		return components;
+	}
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <entt.hpp>
+#include <sol/sol.hpp>
+#include <span>
+
+namespace Feather {
+
+	class Entity;
+
+	/*
+	* @brief Functions scripts use to reach one component type through the Entity usertype.
+	*/
+	struct LuaComponentFunctions
+	{
+		entt::id_type typeId{ 0 };
+		/* Name of the typed shortcut on the Entity usertype, for example entity:transform(). Empty if it has none */
+		std::string shortcutName{};
+
+		sol::reference (*add)(Entity&, const sol::table&, sol::this_state){ nullptr };
+		bool (*has)(Entity&){ nullptr };
+		sol::reference (*get)(Entity&, sol::this_state){ nullptr };
+		size_t (*remove)(Entity&){ nullptr };
+
+		/* Storage of the component, created if the registry does not have one yet */
+		entt::sparse_set& (*storage)(entt::registry&){ nullptr };
+		/* Sets components[i + 1] to a reference to the component of entities[i]. Every entity must have the component */
+		void (*fillArray)(entt::registry&, std::span<const entt::entity>, sol::table&){ nullptr };
+	};
+
+	/*
+	* @brief Dispatch table from a small component index to the Lua functions of the component, filled by Entity::RegisterMetaComponent.
+	* The index is stored on the component's usertype table the first time the table is passed to addComponent, getComponent,
+	* hasComponent or removeComponent. Later calls read it back with a raw get instead of calling type_id
+	* and looking the function up through entt::meta. Component instances, such as addComponent(Transform(...)), are userdata
+	* and are looked up by their type id on every call.
+	*/
+	class LuaComponentDispatch
+	{
+	public:
+		static void Register(LuaComponentFunctions functions);
+
+		/*
+		* @brief Finds the functions of the component usertype table.
+		* @return Returns nullptr if the component was not registered with Entity::RegisterMetaComponent.
+		*/
+		static const LuaComponentFunctions* Find(sol::table& component);
+		static const LuaComponentFunctions* Find(const sol::object& component);
+
+		/*
+		* @brief Adds the typed shortcuts of the registered components to the Entity usertype.
+		*/
+		static void CreateShortcuts(sol::usertype<Entity>& entityType);
+
+	private:
+		static std::vector<LuaComponentFunctions>& GetComponents();
+	};
+
+}
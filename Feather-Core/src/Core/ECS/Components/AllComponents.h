@@ -4,6 +4,7 @@
 #include "CircleColliderComponent.h"
 #include "AnimationComponent.h"
 #include "TransformComponent.h"
+#include "WorldTransformComponent.h"
 #include "SpriteComponent.h"
 #include "PhysicsComponent.h"
 #include "RigidBodyComponent.h"
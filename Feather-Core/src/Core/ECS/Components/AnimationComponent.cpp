@@ -32,14 +32,10 @@ void Feather::AnimationComponent::CreateAnimationLuaBind(sol::state& lua)
 		"numFrames", &AnimationComponent::numFrames,
 		"frameRate", &AnimationComponent::frameRate,
 		"currentFrame", &AnimationComponent::currentFrame,
-		"startTime", &AnimationComponent::startTime,
+		"frameTime", &AnimationComponent::frameTime,
 		"isVertical", &AnimationComponent::isVertical,
 		"isLooped", &AnimationComponent::isLooped,
-		"reset", [](AnimationComponent& anim)
-		{
-			anim.currentFrame = 0;
-			anim.startTime = SDL_GetTicks();
-		},
+		"reset", &AnimationComponent::Reset,
 		"toString", &AnimationComponent::to_string
 	);
 }
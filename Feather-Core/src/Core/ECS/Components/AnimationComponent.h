@@ -1,20 +1,38 @@
 #pragma once
 
 #include <sol/sol.hpp>
-#include <SDL.h>
 
 namespace Feather {
 
 	struct AnimationComponent
 	{
+		static constexpr uint32_t INVALID_CLIP = 0xFFFFFFFF;
+
 		int numFrames{ 1 };
 		int frameRate{ 1 };
 		int currentFrame{ 0 };
-		int startTime{ static_cast<int>(SDL_GetTicks()) };
+		/* Seconds spent on the current frame, advanced by the AnimationSystem */
+		float frameTime{ 0.0f };
 
 		bool isVertical{ false };
 		bool isLooped{ false };
 
+		/* Frame whose UVs were last written to the sprite, -1 forces a write on the next update. Not serialized */
+		int appliedFrame{ -1 };
+		/* Cached index of the shared clip in the AnimationSystem, resolved on the first write. Not serialized */
+		uint32_t clipIndex{ INVALID_CLIP };
+
+		/*
+		* @brief Restarts the animation from the first frame.
+		* The sprite's UVs are rewritten on the next update, so call it after changing the sprite or the frames.
+		*/
+		inline void Reset()
+		{
+			currentFrame = 0;
+			frameTime = 0.0f;
+			appliedFrame = -1;
+		}
+
 		[[nodiscard]] std::string to_string() const;
 
 		static void CreateAnimationLuaBind(sol::state& lua);
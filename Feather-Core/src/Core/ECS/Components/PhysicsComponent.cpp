@@ -97,6 +97,17 @@ namespace Feather {
 		{
 			F_ERROR("Failed to create the RigidBody fixture!");
 		}
+
+		SavePreviousTransform();
+	}
+
+	void PhysicsComponent::SavePreviousTransform()
+	{
+		if (!m_RigidBody)
+			return;
+
+		m_PreviousPosition = m_RigidBody->GetPosition();
+		m_PreviousAngle = m_RigidBody->GetAngle();
 	}
 
 	const bool PhysicsComponent::IsTrigger() const
@@ -67,6 +67,14 @@ namespace Feather {
 		inline b2Body* GetBody() { return m_RigidBody.get(); }
 		inline UserData* GetUserData() { return m_UserData.get(); }
 
+		/*
+		* @brief Stores the current position and angle of the body as its previous transform.
+		* Called before each fixed physics step so the rendered transform can be interpolated between steps.
+		*/
+		void SavePreviousTransform();
+		inline const b2Vec2& GetPreviousPosition() const { return m_PreviousPosition; }
+		inline float GetPreviousAngle() const { return m_PreviousAngle; }
+
 		inline const PhysicsAttributes& GetAttributes() const { return m_InitialAttributes; }
 		inline PhysicsAttributes& GetChangableAttributes() { return m_InitialAttributes; }
 
@@ -76,6 +84,10 @@ namespace Feather {
 		std::shared_ptr<b2Body> m_RigidBody;
 		std::shared_ptr<UserData> m_UserData;
 
+		/* Body transform before the last physics step, in meters and radians */
+		b2Vec2 m_PreviousPosition{ 0.0f, 0.0f };
+		float m_PreviousAngle{ 0.0f };
+
 		PhysicsAttributes m_InitialAttributes;
 	};
 
@@ -4,9 +4,12 @@
 
 #include "Renderer/Essentials/Vertex.h"
 #include "Core/ECS/Registry.h"
+#include "Core/Resources/AssetHandle.h"
 
 namespace Feather {
 
+	class Texture;
+
 	struct UVs
 	{
 		float u{ 0.0f };
@@ -33,6 +36,8 @@ namespace Feather {
 		int isoCellX{ 0 };
 		/* Iso cell is needed to sort when rendering */
 		int isoCellY{ 0 };
+		/* Cached lookup of the texture name, resolved by the asset manager. Not serialized */
+		AssetHandle<Texture> textureHandle{};
 
 		// void generate_uvs(int textureWidth, int textureHeight);
 		[[nodiscard]] std::string to_string() const;
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "Renderer/Essentials/Vertex.h"
+#include "Core/Resources/AssetHandle.h"
 
 #include <sol/sol.hpp>
 
 namespace Feather {
 
+	class Font;
+
 	struct TextComponent
 	{
 		std::string fontName{ "pixelFont-32" };
@@ -17,6 +20,8 @@ namespace Feather {
 		Color color{ 255, 255, 255, 255 };
 		bool isHidden{ false };
 		bool isDirty{ false };
+		/* Cached lookup of the font name, resolved by the asset manager. Not serialized */
+		AssetHandle<Font> fontHandle{};
 
 		[[nodiscard]] std::string to_string();
 
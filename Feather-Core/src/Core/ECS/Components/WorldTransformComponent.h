@@ -0,0 +1,38 @@
+#pragma once
+
+#include "TransformComponent.h"
+
+namespace Feather {
+
+	/*
+	* @brief World transform of an entity, cached by the TransformSystem.
+	* Holds the model matrix of the entity's sprite or text box together with the transform it was built from,
+	* so the TransformSystem skips entities that did not change and the renderers can tell when it is stale.
+	* Not serialized, it is rebuilt from the TransformComponent.
+	*/
+	struct WorldTransformComponent
+	{
+		glm::mat4 model{ 1.0f };
+		/* Width and height the model was built for, negative until it has been built */
+		glm::vec2 modelSize{ -1.0f };
+
+		/* Transform the model was built from */
+		glm::vec2 position{ 0.0f };
+		glm::vec2 scale{ 1.0f };
+		float rotation{ 0.0f };
+
+		/* Local transform last applied to the entity, only used for children */
+		glm::vec2 localPosition{ 0.0f };
+		float localRotation{ 0.0f };
+
+		/*
+		* @brief Checks if the cached model matches the transform and size, without rebuilding it.
+		*/
+		inline bool IsCurrent(const TransformComponent& transform, float width, float height) const
+		{
+			return modelSize.x == width && modelSize.y == height && position == transform.position &&
+				   rotation == transform.rotation && scale == transform.scale;
+		}
+	};
+
+}
@@ -1,23 +1,18 @@
 #include "ECSUtils.h"
 
-#include "Components/AllComponents.h"
-#include "Entity.h"
+#include "Registry.h"
+#include "EntityTagIndex.h"
 
 namespace Feather {
 
 	entt::entity FindEntityByTag(Registry& registry, const std::string& tag)
 	{
-        auto ids = registry.GetRegistry().view<Identification>(entt::exclude<TileComponent>);
-
-        auto parItr = std::ranges::find_if(ids, [&](const auto& e) {
-            Entity en{ &registry, e };
-            return en.GetName() == tag;
-        });
-
-        if (parItr != ids.end())
-            return *parItr;
+		return registry.GetTagIndex().FindByName(tag);
+	}
 
-        return entt::entity{ entt::null };
+	std::vector<entt::entity> FindEntitiesByGroup(Registry& registry, const std::string& group)
+	{
+		return registry.GetTagIndex().FindByGroup(group);
 	}
 
 }
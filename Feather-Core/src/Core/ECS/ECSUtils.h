@@ -6,6 +6,15 @@ namespace Feather {
 
 	class Registry;
 
+	/*
+	* @brief Finds the first non tile entity with the given name, using the registry's tag index.
+	* @return Returns the entity or entt::null if there is none.
+	*/
 	entt::entity FindEntityByTag(Registry& registry, const std::string& tag);
 
+	/*
+	* @brief Returns all non tile entities in the given group, in no particular order.
+	*/
+	std::vector<entt::entity> FindEntitiesByGroup(Registry& registry, const std::string& group);
+
 }
@@ -153,6 +153,9 @@ namespace Feather {
 				childTransform.localPosition = childTransform.position - registry.get<TransformComponent>(relations.parent).position;
 				childTransform.localRotation = childTransform.rotation;
 			}
+
+			// Lets the TransformSystem pick up the new parent
+			registry.patch<TransformComponent>(child);
 			return true;
 		}
 
@@ -217,6 +220,11 @@ namespace Feather {
 			RelationshipUtils::SetSiblingLinks(firstChild, childRelationship);
 		}
 
+		// Lets the TransformSystem pick up the new parent, a tile is only tracked once it is part of a hierarchy
+		registry.patch<TransformComponent>(child);
+		if (registry.all_of<TransformComponent>(m_Entity))
+			registry.patch<TransformComponent>(m_Entity);
+
 		return true;
 	}
 
@@ -235,6 +243,9 @@ namespace Feather {
 			transform.rotation = parentTransform.rotation + transform.localRotation;
 		}
 
+		// The editor tools move the transform in place before calling this, let the listeners know it moved
+		m_Registry->GetRegistry().patch<TransformComponent>(m_Entity);
+
 		if (relations.firstChild == entt::null)
 			return;
 
@@ -249,8 +260,8 @@ namespace Feather {
 
 	void Entity::ChangeName(const std::string& name)
 	{
-		auto& id = GetComponent<Identification>();
-		id.name = name;
+		// Patch so the registry's tag index picks up the new name
+		m_Registry->GetRegistry().patch<Identification>(m_Entity, [&](auto& id) { id.name = name; });
 		m_Name = name;
 	}
 
@@ -269,7 +280,7 @@ namespace Feather {
 	void Entity::CreateLuaEntityBind(sol::state& lua, Registry& registry)
 	{
 		using namespace entt::literals;
-		lua.new_usertype<Entity>(
+		auto entityType = lua.new_usertype<Entity>(
 			"Entity",
 			sol::call_constructor,
 			sol::factories(
@@ -286,11 +297,14 @@ namespace Feather {
 					return Entity{ &registry, static_cast<entt::entity>(id) };
 				}
 			),
-			"addComponent", [](Entity& entity, const sol::table& comp, sol::this_state s) -> sol::object
+			"addComponent", [](Entity& entity, sol::table comp, sol::this_state s) -> sol::object
 			{
 				if (!comp.valid())
 					return sol::lua_nil_t{};
 
+				if (const auto* pFunctions = LuaComponentDispatch::Find(comp))
+					return pFunctions->add(entity, comp, s);
+
 				const auto component = InvokeMetaFunction(
 					GetIdType(comp),
 					"add_component"_hs,
@@ -300,8 +314,11 @@ namespace Feather {
 
 				return component ? component.cast<sol::reference>() : sol::lua_nil_t{};
 			},
-			"hasComponent", [](Entity& entity, const sol::table& comp)
+			"hasComponent", [](Entity& entity, sol::table comp)
 			{
+				if (const auto* pFunctions = LuaComponentDispatch::Find(comp))
+					return pFunctions->has(entity);
+
 				const auto has_comp = InvokeMetaFunction(
 					GetIdType(comp),
 					"has_component"_hs,
@@ -309,8 +326,11 @@ namespace Feather {
 
 				return has_comp ? has_comp.cast<bool>() : false;
 			},
-			"getComponent", [](Entity& entity, const sol::table& comp, sol::this_state s)
+			"getComponent", [](Entity& entity, sol::table comp, sol::this_state s) -> sol::reference
 			{
+				if (const auto* pFunctions = LuaComponentDispatch::Find(comp))
+					return pFunctions->get(entity, s);
+
 				const auto component = InvokeMetaFunction(
 					GetIdType(comp),
 					"get_component"_hs,
@@ -319,8 +339,11 @@ namespace Feather {
 
 				return component ? component.cast<sol::reference>() : sol::lua_nil_t{};
 			},
-			"removeComponent", [](Entity& entity, const sol::table& comp)
+			"removeComponent", [](Entity& entity, sol::table comp) -> sol::object
 			{
+				if (const auto* pFunctions = LuaComponentDispatch::Find(comp))
+					return sol::make_object(comp.lua_state(), pFunctions->remove(entity));
+
 				const auto component = InvokeMetaFunction(
 					GetIdType(comp),
 					"remove_component"_hs,
@@ -350,6 +373,8 @@ namespace Feather {
 			},
 			"id", [](Entity& entity) { return static_cast<uint32_t>(entity.GetEntity()); }
 		);
+
+		LuaComponentDispatch::CreateShortcuts(entityType);
 	}
 
 }
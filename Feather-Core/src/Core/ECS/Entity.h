@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Registry.h"
+#include "ComponentDispatch.h"
 
 #include "sol/sol.hpp"
 
@@ -29,6 +30,7 @@ namespace Feather {
 
 		/*
 		* @brief Updates the position of the entity. If the entity has children, it will update all the children as well.
+		* Every transform it visits is patched, so call it after editing the transform in place.
 		*/
 		void UpdateTransform();
 
@@ -49,8 +51,13 @@ namespace Feather {
 
 		static void CreateLuaEntityBind(sol::state& lua, Registry& registry);
 
+		/*
+		* @brief Registers the meta functions of the component and adds it to the Lua component dispatch table.
+		* @param luaShortcut Name of the typed getter scripts can call on an entity, for example "transform" for entity:transform().
+		* Leave empty for components that are not exposed to Lua.
+		*/
 		template <typename TComponent>
-		static void RegisterMetaComponent();
+		static void RegisterMetaComponent(std::string_view luaShortcut = {});
 
 		template <typename TComponent, typename ...Args>
 		TComponent& AddComponent(Args&& ...args);
@@ -109,6 +116,12 @@ namespace Feather {
 	template <typename TComponent>
 	auto copy_component(Entity& entityToCopy, Entity& entityThatCopies);
 
+	template <typename TComponent>
+	entt::sparse_set& get_component_storage(entt::registry& registry);
+
+	template <typename TComponent>
+	void fill_component_array(entt::registry& registry, std::span<const entt::entity> entities, sol::table& components);
+
 }
 
 #include "Entity.inl"
@@ -91,7 +91,23 @@ namespace Feather {
 	}
 
 	template<typename TComponent>
-	inline void Entity::RegisterMetaComponent()
+	entt::sparse_set& get_component_storage(entt::registry& registry)
+	{
+		return registry.storage<TComponent>();
+	}
+
+	template<typename TComponent>
+	void fill_component_array(entt::registry& registry, std::span<const entt::entity> entities, sol::table& components)
+	{
+		auto& storage = registry.storage<TComponent>();
+		for (size_t i = 0; i < entities.size(); i++)
+		{
+			components.raw_set(i + 1, std::ref(storage.get(entities[i])));
+		}
+	}
+
+	template<typename TComponent>
+	inline void Entity::RegisterMetaComponent(std::string_view luaShortcut)
 	{
 		using namespace entt::literals;
 		entt::meta<TComponent>()
@@ -102,6 +118,16 @@ namespace Feather {
 			.template func<&get_component<TComponent>>("get_component"_hs)
 			.template func<&copy_component<TComponent>>("copy_component"_hs)
 			.template func<&remove_component<TComponent>>("remove_component"_hs);
+
+		LuaComponentDispatch::Register(LuaComponentFunctions{
+			.typeId = entt::type_hash<TComponent>::value(),
+			.shortcutName = std::string{ luaShortcut },
+			.add = &add_component<TComponent>,
+			.has = &has_component<TComponent>,
+			.get = &get_component<TComponent>,
+			.remove = &remove_component<TComponent>,
+			.storage = &get_component_storage<TComponent>,
+			.fillArray = &fill_component_array<TComponent> });
 	}
 
 }
@@ -0,0 +1,144 @@
+#include "EntityTagIndex.h"
+
+#include "Components/Identification.h"
+#include "Components/TileComponent.h"
+
+namespace Feather {
+
+	void EntityTagIndex::Connect(entt::registry& registry)
+	{
+		registry.on_construct<Identification>().connect<&EntityTagIndex::OnIdentificationConstruct>(*this);
+		registry.on_update<Identification>().connect<&EntityTagIndex::OnIdentificationUpdate>(*this);
+		registry.on_destroy<Identification>().connect<&EntityTagIndex::OnIdentificationDestroy>(*this);
+		registry.on_construct<TileComponent>().connect<&EntityTagIndex::OnTileConstruct>(*this);
+		registry.on_destroy<TileComponent>().connect<&EntityTagIndex::OnTileDestroy>(*this);
+
+		auto ids = registry.view<Identification>(entt::exclude<TileComponent>);
+		for (auto entity : ids)
+		{
+			const auto& id = ids.get<Identification>(entity);
+			Insert(entity, id.name, id.group);
+		}
+	}
+
+	void EntityTagIndex::Disconnect(entt::registry& registry)
+	{
+		registry.on_construct<Identification>().disconnect(this);
+		registry.on_update<Identification>().disconnect(this);
+		registry.on_destroy<Identification>().disconnect(this);
+		registry.on_construct<TileComponent>().disconnect(this);
+		registry.on_destroy<TileComponent>().disconnect(this);
+
+		m_mapNameToEntities.clear();
+		m_mapGroupToEntities.clear();
+		m_mapIndexedEntities.clear();
+	}
+
+	entt::entity EntityTagIndex::FindByName(const std::string& name) const
+	{
+		auto nameItr = m_mapNameToEntities.find(name);
+		if (nameItr == m_mapNameToEntities.end() || nameItr->second.empty())
+			return entt::null;
+
+		return nameItr->second.front();
+	}
+
+	std::vector<entt::entity> EntityTagIndex::FindByGroup(const std::string& group) const
+	{
+		auto groupItr = m_mapGroupToEntities.find(group);
+		if (groupItr == m_mapGroupToEntities.end())
+			return {};
+
+		return { groupItr->second.begin(), groupItr->second.end() };
+	}
+
+	std::string EntityTagIndex::GetUniqueName(const std::string& name) const
+	{
+		if (!m_mapNameToEntities.contains(name))
+			return name;
+
+		// There can be at most Size() taken names, so this always terminates
+		int current{ 0 };
+		std::string checkName{ name + std::to_string(current) };
+		while (m_mapNameToEntities.contains(checkName))
+		{
+			checkName = name + std::to_string(++current);
+		}
+
+		return checkName;
+	}
+
+	void EntityTagIndex::Insert(entt::entity entity, const std::string& name, const std::string& group)
+	{
+		if (m_mapIndexedEntities.contains(entity))
+			Remove(entity);
+
+		// Unnamed entities can't be searched for, don't let them pile up in one bucket
+		if (!name.empty())
+			m_mapNameToEntities[name].push_back(entity);
+
+		if (!group.empty())
+			m_mapGroupToEntities[group].insert(entity);
+
+		m_mapIndexedEntities.insert_or_assign(entity, IndexedID{ .name = name, .group = group });
+	}
+
+	void EntityTagIndex::Remove(entt::entity entity)
+	{
+		auto indexedItr = m_mapIndexedEntities.find(entity);
+		if (indexedItr == m_mapIndexedEntities.end())
+			return;
+
+		const auto& [name, group] = indexedItr->second;
+
+		if (auto nameItr = m_mapNameToEntities.find(name); nameItr != m_mapNameToEntities.end())
+		{
+			auto& entities = nameItr->second;
+			std::erase(entities, entity);
+			if (entities.empty())
+				m_mapNameToEntities.erase(nameItr);
+		}
+
+		if (auto groupItr = m_mapGroupToEntities.find(group); groupItr != m_mapGroupToEntities.end())
+		{
+			groupItr->second.erase(entity);
+			if (groupItr->second.empty())
+				m_mapGroupToEntities.erase(groupItr);
+		}
+
+		m_mapIndexedEntities.erase(indexedItr);
+	}
+
+	void EntityTagIndex::OnIdentificationConstruct(entt::registry& registry, entt::entity entity)
+	{
+		if (registry.all_of<TileComponent>(entity))
+			return;
+
+		const auto& id = registry.get<Identification>(entity);
+		Insert(entity, id.name, id.group);
+	}
+
+	void EntityTagIndex::OnIdentificationUpdate(entt::registry& registry, entt::entity entity)
+	{
+		Remove(entity);
+		OnIdentificationConstruct(registry, entity);
+	}
+
+	void EntityTagIndex::OnIdentificationDestroy(entt::registry& registry, entt::entity entity)
+	{
+		Remove(entity);
+	}
+
+	void EntityTagIndex::OnTileConstruct(entt::registry& registry, entt::entity entity)
+	{
+		Remove(entity);
+	}
+
+	void EntityTagIndex::OnTileDestroy(entt::registry& registry, entt::entity entity)
+	{
+		// The tile component can be removed before the identification when the entity is destroyed
+		if (const auto* id = registry.try_get<Identification>(entity))
+			Insert(entity, id->name, id->group);
+	}
+
+}
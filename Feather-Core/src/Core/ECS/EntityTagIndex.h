@@ -0,0 +1,68 @@
+#pragma once
+
+#include <entt.hpp>
+
+namespace Feather {
+
+	/*
+	* @brief Hash index from entity name and group to the entities that carry them.
+	* Kept in sync with the Identification component through the registry's construct,
+	* update and destroy signals. Tiles are not indexed, they are looked up by position.
+	* Identification changes made in place must be followed by a registry patch, see Entity::ChangeName.
+	*/
+	class EntityTagIndex
+	{
+	public:
+		EntityTagIndex() = default;
+		~EntityTagIndex() = default;
+
+		/*
+		* @brief Connects the index to the registry signals and indexes any existing entities.
+		*/
+		void Connect(entt::registry& registry);
+		void Disconnect(entt::registry& registry);
+
+		/*
+		* @brief Finds the first entity with the given name.
+		* @return Returns the entity or entt::null if no entity has that name.
+		*/
+		entt::entity FindByName(const std::string& name) const;
+
+		/*
+		* @brief Returns all the entities in the given group, in no particular order.
+		*/
+		std::vector<entt::entity> FindByGroup(const std::string& group) const;
+
+		/*
+		* @brief Returns the name if it is not taken, otherwise the name followed by the first free number.
+		*/
+		std::string GetUniqueName(const std::string& name) const;
+
+		inline bool Contains(const std::string& name) const { return m_mapNameToEntities.contains(name); }
+		inline size_t Size() const { return m_mapIndexedEntities.size(); }
+
+	private:
+		struct IndexedID
+		{
+			std::string name{};
+			std::string group{};
+		};
+
+		void Insert(entt::entity entity, const std::string& name, const std::string& group);
+		void Remove(entt::entity entity);
+
+		void OnIdentificationConstruct(entt::registry& registry, entt::entity entity);
+		void OnIdentificationUpdate(entt::registry& registry, entt::entity entity);
+		void OnIdentificationDestroy(entt::registry& registry, entt::entity entity);
+		void OnTileConstruct(entt::registry& registry, entt::entity entity);
+		void OnTileDestroy(entt::registry& registry, entt::entity entity);
+
+	private:
+		/* @brief Names should be unique, the vector only holds more than one entity when they are not. */
+		std::unordered_map<std::string, std::vector<entt::entity>> m_mapNameToEntities;
+		std::unordered_map<std::string, std::unordered_set<entt::entity>> m_mapGroupToEntities;
+		/* @brief The name and group each entity was indexed under, needed to unindex after an in place change. */
+		std::unordered_map<entt::entity, IndexedID> m_mapIndexedEntities;
+	};
+
+}
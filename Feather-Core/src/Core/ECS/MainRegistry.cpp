@@ -11,6 +11,7 @@
 #include "Core/Systems/RenderShapeSystem.h"
 #include "Core/Systems/AnimationSystem.h"
 #include "Core/Systems/PhysicsSystem.h"
+#include "Core/Systems/TransformSystem.h"
 #ifdef IN_FEATHER_EDITOR
 #include "Core/Systems/RenderPickingSystem.h"
 #endif
@@ -104,6 +105,7 @@ namespace Feather {
 
         AddToContext<std::shared_ptr<PhysicsSystem>>(std::make_shared<PhysicsSystem>());
         AddToContext<std::shared_ptr<AnimationSystem>>(std::make_shared<AnimationSystem>());
+        AddToContext<std::shared_ptr<TransformSystem>>(std::make_shared<TransformSystem>());
         AddToContext<std::shared_ptr<EventDispatcher>>(std::make_shared<EventDispatcher>());
 #ifdef IN_FEATHER_EDITOR
         AddToContext<std::shared_ptr<RenderPickingSystem>>(std::make_shared<RenderPickingSystem>());
@@ -167,6 +169,12 @@ namespace Feather {
         return *m_MainRegistry->GetContext<std::shared_ptr<PhysicsSystem>>();
     }
 
+    TransformSystem& MainRegistry::GetTransformSystem()
+    {
+        F_ASSERT(m_Initialized && "Main Registry must be initialized before use");
+        return *m_MainRegistry->GetContext<std::shared_ptr<TransformSystem>>();
+    }
+
     Registry* MainRegistry::GetRegistry()
     {
         if (!m_MainRegistry)
@@ -19,6 +19,7 @@ namespace Feather {
 	class RenderShapeSystem;
 	class AnimationSystem;
 	class PhysicsSystem;
+	class TransformSystem;
 
 	class EventDispatcher;
 
@@ -50,6 +51,7 @@ namespace Feather {
 		RenderShapeSystem& GetRenderShapeSystem();
 		AnimationSystem& GetAnimationSystem();
 		PhysicsSystem& GetPhysicsSystem();
+		TransformSystem& GetTransformSystem();
 		Registry* GetRegistry();
 
 		EventDispatcher& GetEventDispatcher();
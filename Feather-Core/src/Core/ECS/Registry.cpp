@@ -3,13 +3,21 @@
 #include "Entity.h"
 #include "MetaUtilities.h"
 #include "ECSUtils.h"
+#include "EntityTagIndex.h"
+#include "RegistryQuery.h"
 #include "Components\PersistentComponent.h"
+#include "Components\Relationship.h"
+#include "Components\Identification.h"
+#include "Core/Tilemap/Tilemap.h"
 
 namespace Feather {
 
 	Registry::Registry()
-		: m_Registry{ std::make_shared<entt::registry>() }
-	{}
+		: m_TagIndex{ std::make_shared<EntityTagIndex>() }
+		, m_Registry{ std::make_shared<entt::registry>() }
+	{
+		m_TagIndex->Connect(*m_Registry);
+	}
 
 	void Registry::ClearRegistry()
 	{
@@ -18,6 +26,10 @@ namespace Feather {
 		{
 			m_Registry->destroy(entity);
 		}
+
+		// Baked tiles are not entities
+		if (auto* tilemap = TryGetContext<std::shared_ptr<Tilemap>>())
+			(*tilemap)->Clear();
 	}
 
 	void Registry::AddToPendingDestruction(entt::entity entity)
@@ -41,6 +53,77 @@ namespace Feather {
 		m_EntitiesPendingDestruction.clear();
 	}
 
+	entt::entity RegistryCloneContext::Map(entt::entity entity) const
+	{
+		if (entity == entt::null || !entities.contains(entity))
+			return entt::null;
+
+		if (auto remapItr = mapRemappedEntities.find(entity); remapItr != mapRemappedEntities.end())
+			return remapItr->second;
+
+		return entity;
+	}
+
+	void CloneFixup<Relationship>::Apply(Relationship& relationship, const RegistryCloneContext& context)
+	{
+		if (context.IsIdentity())
+			return;
+
+		relationship.self = context.Map(relationship.self);
+		relationship.firstChild = context.Map(relationship.firstChild);
+		relationship.prevSibling = context.Map(relationship.prevSibling);
+		relationship.nextSibling = context.Map(relationship.nextSibling);
+		relationship.parent = context.Map(relationship.parent);
+	}
+
+	void CloneFixup<Identification>::Apply(Identification& identification, const RegistryCloneContext& context)
+	{
+		if (context.IsIdentity())
+			return;
+
+		// Ids that do not belong to a cloned entity are left as they are
+		if (auto clone = context.Map(static_cast<entt::entity>(identification.entity_id)); clone != entt::null)
+			identification.entity_id = static_cast<uint32_t>(clone);
+	}
+
+	void Registry::CloneStorages(RegistryCloneContext& context)
+	{
+		using namespace entt::literals;
+		F_ASSERT(&context.source != &context.destination && "Cannot clone a registry into itself!");
+
+		// Create every clone before any component is copied, asking for the id of the source entity
+		auto& destinationEntities = context.destination.storage<entt::entity>();
+		destinationEntities.reserve(destinationEntities.size() + context.entities.size());
+
+		for (auto entity : context.entities)
+		{
+			if (auto clone = context.destination.create(entity); clone != entity)
+				context.mapRemappedEntities.emplace(entity, clone);
+		}
+
+		context.bAllEntities = context.entities.size() == m_Registry->storage<entt::entity>().free_list();
+
+		for (auto&& [id, storage] : m_Registry->storage())
+		{
+			if (storage.empty())
+				continue;
+
+			auto metaType = entt::resolve(id);
+			auto cloneStorage = metaType ? metaType.func("clone_storage"_hs) : entt::meta_func{};
+			if (!cloneStorage)
+			{
+				if (std::ranges::any_of(storage, [&](auto entity) { return context.entities.contains(entity); }))
+				{
+					F_WARN("Failed to clone components of type '{}'. Type is not registered", storage.type().name());
+				}
+
+				continue;
+			}
+
+			cloneStorage.invoke({}, entt::forward_as_meta(context));
+		}
+	}
+
 	void Registry::CreateLuaRegistryBind(sol::state& lua, Registry& registry)
 	{
 		lua.new_enum<RegistryType>("RegistryType",
@@ -135,6 +218,11 @@ namespace Feather {
 
 				return view;
 			},
+			"query",
+			[](Registry& reg, const sol::variadic_args& va)
+			{
+				return RegistryQuery{ reg, va };
+			},
 			"findEntityByTag",
 			[&](Registry& reg, const std::string& tag, sol::this_state s)
 			{
@@ -142,6 +230,25 @@ namespace Feather {
 
 				return entity == entt::null ? sol::lua_nil_t{} : sol::make_reference(s, Entity{ &reg, entity });
 			},
+			"findEntitiesByGroup",
+			[&](Registry& reg, const std::string& group, sol::this_state s)
+			{
+				auto entities = FindEntitiesByGroup(reg, group);
+
+				sol::state_view lua{ s };
+				auto entityTable = lua.create_table(static_cast<int>(entities.size()), 0);
+				for (auto entity : entities)
+				{
+					entityTable.add(Entity{ &reg, entity });
+				}
+
+				return entityTable;
+			},
+			"getUniqueName",
+			[&](Registry& reg, const std::string& name)
+			{
+				return reg.GetTagIndex().GetUniqueName(name);
+			},
 			"createEntity",
 			sol::overload(
 			[](Registry& reg)
@@ -4,6 +4,59 @@
 #include <sol/sol.hpp>
 
 namespace Feather {
+
+	class EntityTagIndex;
+	struct Relationship;
+	struct Identification;
+
+	/*
+	* @brief State shared by the clone_storage functions while one registry is cloned into another.
+	*/
+	struct RegistryCloneContext
+	{
+		const entt::registry& source;
+		entt::registry& destination;
+		/* @brief Source entities being cloned. */
+		entt::sparse_set entities{};
+		/* @brief Clones that could not keep the id of their source entity. Empty when every id was kept. */
+		std::unordered_map<entt::entity, entt::entity> mapRemappedEntities{};
+		/* @brief Every live source entity is cloned, so whole storages can be copied without filtering. */
+		bool bAllEntities{ false };
+
+		inline bool IsIdentity() const { return mapRemappedEntities.empty(); }
+
+		/*
+		* @brief Returns the clone of the source entity, or entt::null if the entity was not cloned.
+		*/
+		entt::entity Map(entt::entity entity) const;
+	};
+
+	/*
+	* @brief Fix-up applied to the cloned components after their storage was copied.
+	* Specialize it for components that hold entity ids or engine resources the clone must not share.
+	*/
+	template <typename TComponent>
+	struct CloneFixup
+	{
+		static constexpr bool Enabled = false;
+		static void Apply(TComponent& component, const RegistryCloneContext& context) {}
+	};
+
+	/* @brief Remaps the hierarchy links of clones that did not keep their ids. */
+	template <>
+	struct CloneFixup<Relationship>
+	{
+		static constexpr bool Enabled = true;
+		static void Apply(Relationship& relationship, const RegistryCloneContext& context);
+	};
+
+	/* @brief Points the stored entity id at the clone when the clone did not keep its id. */
+	template <>
+	struct CloneFixup<Identification>
+	{
+		static constexpr bool Enabled = true;
+		static void Apply(Identification& identification, const RegistryCloneContext& context);
+	};
 	
 	enum RegistryType
 	{
@@ -21,6 +74,7 @@ namespace Feather {
 
 		inline entt::registry& GetRegistry() { return *m_Registry; }
 		inline entt::entity CreateEntity() { return m_Registry->create(); }
+		inline EntityTagIndex& GetTagIndex() { return *m_TagIndex; }
 
 		void ClearRegistry();
 		void AddToPendingDestruction(entt::entity entity);
@@ -44,12 +98,27 @@ namespace Feather {
 		template <typename... Excludes>
 		void DestroyEntities();
 
+		/*
+		* @brief Clones the entities and their components into another registry, skipping entities with any of the excluded components.
+		* All the clones are created first and keep the id of their source entity unless it is taken in the destination.
+		* Each component storage is then copied at once by its clone_storage function, so only components
+		* registered with Registry::RegisterMetaComponent are cloned.
+		* @return Returns the number of cloned entities.
+		*/
+		template <typename... Excludes>
+		size_t CloneEntities(Registry& destination);
+
 		static void CreateLuaRegistryBind(sol::state& lua, Registry& registry);
 
 		template <typename TComponent>
 		static void RegisterMetaComponent();
 
 	private:
+		void CloneStorages(RegistryCloneContext& context);
+
+	private:
+		/* @brief Declared before the registry so it outlives any destroy signals the registry emits. */
+		std::shared_ptr<EntityTagIndex> m_TagIndex;
 		std::shared_ptr<entt::registry> m_Registry;
 		RegistryType m_Type{ RegistryType::FeatherRegistry };
 		std::vector<entt::entity> m_EntitiesPendingDestruction;
@@ -61,6 +130,9 @@ namespace Feather {
 	template <typename TComponent>
 	auto exclude_component_from_view(Registry* registry, entt::runtime_view* view);
 
+	template <typename TComponent>
+	void clone_storage(RegistryCloneContext& context);
+
 }
 
 #include "Registry.inl"
@@ -42,6 +42,21 @@ namespace Feather {
 		}
 	}
 
+	template<typename... Excludes>
+	inline size_t Registry::CloneEntities(Registry& destination)
+	{
+		RegistryCloneContext context{ .source = *m_Registry, .destination = destination.GetRegistry() };
+
+		auto view = m_Registry->view<entt::entity>(entt::exclude<Excludes...>);
+		for (auto entity : view)
+		{
+			context.entities.push(entity);
+		}
+
+		CloneStorages(context);
+		return context.entities.size();
+	}
+
 	template <typename TComponent>
 	entt::runtime_view& add_component_to_view(Registry* registry, entt::runtime_view& view)
 	{
@@ -54,6 +69,41 @@ namespace Feather {
 		view->exclude(registry->GetRegistry().storage<TComponent>());
 	}
 
+	template <typename TComponent>
+	void clone_storage(RegistryCloneContext& context)
+	{
+		const auto* pSource = context.source.storage<TComponent>();
+		if (!pSource || pSource->empty())
+			return;
+
+		auto& destination = context.destination.storage<TComponent>();
+		destination.reserve(destination.size() + pSource->size());
+
+		if (context.bAllEntities && context.IsIdentity())
+		{
+			// Every entity kept its id, copy the packed components in one go
+			const entt::sparse_set& sourceEntities = *pSource;
+			destination.insert(sourceEntities.begin(), sourceEntities.end(), pSource->begin());
+		}
+		else
+		{
+			for (auto [entity, component] : pSource->each())
+			{
+				if (auto clone = context.Map(entity); clone != entt::null)
+					destination.emplace(clone, component);
+			}
+		}
+
+		if constexpr (CloneFixup<TComponent>::Enabled)
+		{
+			for (auto entity : *static_cast<const entt::sparse_set*>(pSource))
+			{
+				if (auto clone = context.Map(entity); clone != entt::null)
+					CloneFixup<TComponent>::Apply(destination.get(clone), context);
+			}
+		}
+	}
+
 	template <typename TComponent>
 	void Registry::RegisterMetaComponent()
 	{
@@ -61,7 +111,8 @@ namespace Feather {
 		entt::meta<TComponent>()
 			.type(entt::type_hash<TComponent>::value())
 			.template func<&add_component_to_view<TComponent>>("add_component_to_view"_hs)
-			.template func<&exclude_component_from_view<TComponent>>("exclude_component_from_view"_hs);
+			.template func<&exclude_component_from_view<TComponent>>("exclude_component_from_view"_hs)
+			.template func<&clone_storage<TComponent>>("clone_storage"_hs);
 	}
 
 }
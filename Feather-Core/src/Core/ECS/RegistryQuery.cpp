@@ -0,0 +1,188 @@
+#include "RegistryQuery.h"
+
+#include "Registry.h"
+#include "ComponentDispatch.h"
+#include "Logger/Logger.h"
+
+namespace Feather {
+
+	RegistryQuery::RegistryQuery(Registry& registry, const sol::variadic_args& components)
+		: m_pRegistry{ &registry }
+	{
+		for (const auto& component : components)
+		{
+			const auto* pFunctions = LuaComponentDispatch::Find(component.as<sol::object>());
+			if (!pFunctions)
+			{
+				F_ERROR("Failed to create query. Component has not been registered with Entity::RegisterMetaComponent");
+				m_bValid = false;
+				continue;
+			}
+
+			m_Components.push_back(pFunctions);
+			m_IncludedStorages.push_back(&pFunctions->storage(registry.GetRegistry()));
+		}
+
+		if (m_Components.empty())
+		{
+			F_ERROR("Failed to create query. At least one component is required");
+			m_bValid = false;
+		}
+	}
+
+	void RegistryQuery::Exclude(const sol::variadic_args& components)
+	{
+		for (const auto& component : components)
+		{
+			const auto* pFunctions = LuaComponentDispatch::Find(component.as<sol::object>());
+			if (!pFunctions)
+			{
+				F_ERROR("Failed to exclude component from query. Component has not been registered with Entity::RegisterMetaComponent");
+				m_bValid = false;
+				continue;
+			}
+
+			m_ExcludedStorages.push_back(&pFunctions->storage(m_pRegistry->GetRegistry()));
+		}
+	}
+
+	size_t RegistryQuery::ForEachChunk(const sol::function& callback, size_t chunkSize, sol::this_state s)
+	{
+		if (!m_bValid || !callback.valid())
+			return 0;
+
+		auto view = CreateView();
+		CollectEntities(view);
+
+		size_t numEntities{ 0 };
+		size_t cursor{ 0 };
+		while (cursor < m_Entities.size())
+		{
+			size_t count = FillChunk(view, cursor, std::max(chunkSize, size_t{ 1 }), s);
+			if (count == 0)
+				break;
+
+			callback(m_Chunk, count);
+			numEntities += count;
+		}
+
+		return numEntities;
+	}
+
+	std::tuple<sol::table, size_t> RegistryQuery::Fetch(sol::this_state s)
+	{
+		if (!m_bValid)
+			return { sol::table{}, 0 };
+
+		auto view = CreateView();
+		CollectEntities(view);
+
+		size_t cursor{ 0 };
+		size_t count = FillChunk(view, cursor, m_Entities.size(), s);
+
+		return { m_Chunk, count };
+	}
+
+	entt::runtime_view RegistryQuery::CreateView() const
+	{
+		// Built on every call so the smallest storage leads the iteration
+		entt::runtime_view view{};
+		for (auto* pStorage : m_IncludedStorages)
+		{
+			view.iterate(*pStorage);
+		}
+
+		for (auto* pStorage : m_ExcludedStorages)
+		{
+			view.exclude(*pStorage);
+		}
+
+		return view;
+	}
+
+	void RegistryQuery::CollectEntities(const entt::runtime_view& view)
+	{
+		m_Entities.clear();
+		m_Entities.reserve(view.size_hint());
+		for (auto entity : view)
+		{
+			m_Entities.push_back(entity);
+		}
+	}
+
+	size_t RegistryQuery::FillChunk(const entt::runtime_view& view, size_t& cursor, size_t chunkSize, sol::this_state s)
+	{
+		if (!m_Chunk.valid())
+		{
+			sol::state_view lua{ s };
+			m_Chunk = lua.create_table(static_cast<int>(m_Components.size()), 1);
+			m_EntityArray = lua.create_table(static_cast<int>(chunkSize), 0);
+			m_Chunk["entities"] = m_EntityArray;
+
+			for (size_t i = 0; i < m_Components.size(); i++)
+			{
+				m_ComponentArrays.push_back(lua.create_table(static_cast<int>(chunkSize), 0));
+				m_Chunk[i + 1] = m_ComponentArrays.back();
+			}
+		}
+
+		// An earlier callback may have destroyed entities or removed their components
+		m_ChunkEntities.clear();
+		for (; cursor < m_Entities.size() && m_ChunkEntities.size() < chunkSize; ++cursor)
+		{
+			if (view.contains(m_Entities[cursor]))
+				m_ChunkEntities.push_back(m_Entities[cursor]);
+		}
+
+		const size_t count = m_ChunkEntities.size();
+		for (size_t i = 0; i < count; i++)
+		{
+			m_EntityArray.raw_set(i + 1, static_cast<uint32_t>(m_ChunkEntities[i]));
+		}
+
+		auto& registry = m_pRegistry->GetRegistry();
+		for (size_t c = 0; c < m_Components.size(); c++)
+		{
+			m_Components[c]->fillArray(registry, m_ChunkEntities, m_ComponentArrays[c]);
+		}
+
+		// Clear what is left of a bigger chunk, so no stale references stay reachable
+		for (size_t i = count; i < m_NumFilled; i++)
+		{
+			m_EntityArray.raw_set(i + 1, sol::lua_nil);
+			for (auto& componentArray : m_ComponentArrays)
+			{
+				componentArray.raw_set(i + 1, sol::lua_nil);
+			}
+		}
+
+		m_NumFilled = count;
+		return count;
+	}
+
+	void RegistryQuery::CreateLuaQueryBind(sol::state& lua)
+	{
+		lua.new_usertype<RegistryQuery>(
+			"RegistryQuery",
+			sol::no_constructor,
+			"exclude",
+			[](RegistryQuery& query, const sol::variadic_args& va) -> RegistryQuery& {
+				query.Exclude(va);
+				return query;
+			},
+			"forEachChunk",
+			sol::overload(
+				[](RegistryQuery& query, const sol::function& callback, sol::this_state s) {
+					return query.ForEachChunk(callback, DEFAULT_CHUNK_SIZE, s);
+				},
+				[](RegistryQuery& query, const sol::function& callback, size_t chunkSize, sol::this_state s) {
+					return query.ForEachChunk(callback, chunkSize, s);
+				}),
+			"fetch",
+			[](RegistryQuery& query, sol::this_state s) { return query.Fetch(s); },
+			"valid",
+			&RegistryQuery::IsValid
+		);
+	}
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <entt.hpp>
+#include <sol/sol.hpp>
+
+namespace Feather {
+
+	class Registry;
+	struct LuaComponentFunctions;
+
+	/*
+	* @brief Compiled query over the entities that have all the requested components, for systems written in Lua.
+	* Matches are handed to a single callback a chunk at a time, as an array of entity ids and one array of component
+	* references per requested component, so the per entity cost in Lua is a table index instead of a call from C++.
+	* The query and its chunk tables are kept between calls, scripts should create the query once and reuse it every frame.
+	* Component references in a chunk are only valid until the callback returns.
+	*/
+	class RegistryQuery
+	{
+	public:
+		static constexpr size_t DEFAULT_CHUNK_SIZE = 256;
+
+		RegistryQuery(Registry& registry, const sol::variadic_args& components);
+		~RegistryQuery() = default;
+
+		/*
+		* @brief Skips the entities that have any of the components.
+		*/
+		void Exclude(const sol::variadic_args& components);
+
+		/*
+		* @brief Calls callback(chunk, count) for every chunk of matching entities.
+		* chunk.entities[i] is the id of the i-th entity and chunk[c][i] its component for the c-th requested component.
+		* Entities destroyed or changed by an earlier chunk's callback are skipped.
+		* @return Returns the number of entities handed to the callback.
+		*/
+		size_t ForEachChunk(const sol::function& callback, size_t chunkSize, sol::this_state s);
+
+		/*
+		* @brief Returns every matching entity as a single chunk, with the number of entities in it.
+		*/
+		std::tuple<sol::table, size_t> Fetch(sol::this_state s);
+
+		inline bool IsValid() const { return m_bValid; }
+
+		static void CreateLuaQueryBind(sol::state& lua);
+
+	private:
+		entt::runtime_view CreateView() const;
+		void CollectEntities(const entt::runtime_view& view);
+
+		/*
+		* @brief Fills the chunk tables with the next matching entities, starting at the cursor.
+		* @return Returns the number of entities in the chunk.
+		*/
+		size_t FillChunk(const entt::runtime_view& view, size_t& cursor, size_t chunkSize, sol::this_state s);
+
+	private:
+		Registry* m_pRegistry;
+		std::vector<const LuaComponentFunctions*> m_Components;
+		std::vector<entt::sparse_set*> m_IncludedStorages;
+		std::vector<entt::sparse_set*> m_ExcludedStorages;
+		bool m_bValid{ true };
+
+		/* Reused between calls */
+		std::vector<entt::entity> m_Entities;
+		std::vector<entt::entity> m_ChunkEntities;
+		sol::table m_Chunk;
+		sol::table m_EntityArray;
+		std::vector<sol::table> m_ComponentArrays;
+		/* Number of entries currently set in the chunk arrays */
+		size_t m_NumFilled{ 0 };
+	};
+
+}
@@ -35,6 +35,54 @@ namespace Feather {
 			"objectB",
 			&ContactEvent::objectB);
 
+		lua.new_enum<EContactType>("ContactType",
+			{
+				{ "Begin", EContactType::Begin },
+				{ "End", EContactType::End },
+				{ "PreSolve", EContactType::PreSolve },
+				{ "PostSolve", EContactType::PostSolve },
+			});
+
+		lua.new_usertype<ContactRecord>(
+			"ContactRecord",
+			sol::no_constructor,
+			"entityA",
+			sol::readonly(&ContactRecord::entityA),
+			"entityB",
+			sol::readonly(&ContactRecord::entityB),
+			"type",
+			sol::readonly(&ContactRecord::type),
+			"normal",
+			sol::readonly(&ContactRecord::normal),
+			"impulse",
+			sol::readonly(&ContactRecord::impulse));
+
+		lua.new_usertype<ContactBatchEvent>(
+			"ContactBatchEvent",
+			sol::no_constructor,
+			"type_id",
+			&entt::type_hash<ContactBatchEvent>::value,
+			"size",
+			&ContactBatchEvent::Size,
+			"get",
+			[](const ContactBatchEvent& ev, size_t index, sol::this_state s) -> sol::object {
+				// Lua indices start at 1
+				if (index == 0 || index > ev.Size())
+					return sol::lua_nil_t{};
+
+				return sol::make_object(s, &(*ev.contacts)[index - 1]);
+			},
+			"for_each",
+			[](const ContactBatchEvent& ev, const sol::function& func) {
+				if (!ev.contacts)
+					return;
+
+				for (const auto& contact : *ev.contacts)
+				{
+					func(contact);
+				}
+			});
+
 		lua.new_usertype<KeyEvent>(
 			"KeyEvent",
 			"type_id",
@@ -78,6 +126,17 @@ namespace Feather {
 			"release",
 			&LuaHandler<ContactEvent>::ReleaseConnection);
 
+		lua.new_usertype<LuaHandler<ContactBatchEvent>>(
+			"ContactBatchEventHandler",
+			"type_id",
+			&entt::type_hash<LuaHandler<ContactBatchEvent>>::value,
+			"event_type",
+			&entt::type_hash<ContactBatchEvent>::value,
+			sol::call_constructor,
+			sol::factories([](const sol::function& func) { return LuaHandler<ContactBatchEvent>{.callback = func }; }),
+			"release",
+			&LuaHandler<ContactBatchEvent>::ReleaseConnection);
+
 		lua.new_usertype<LuaHandler<KeyEvent>>(
 			"KeyEventHandler",
 			"type_id",
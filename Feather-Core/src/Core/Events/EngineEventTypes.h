@@ -1,17 +1,31 @@
 #pragma once
 
 #include "Physics/UserData.h"
+#include "Physics/ContactListener.h"
 
 #include <sol/sol.hpp>
 
 namespace Feather {
 
+    /* Emitted for each contact that began during the frame's physics steps */
     struct ContactEvent
     {
         ObjectData objectA{};
         ObjectData objectB{};
     };
 
+    /*
+    * @brief Emitted once a frame with every contact recorded during the frame's physics steps, in the order they happened.
+    * Only the types enabled in the contact listener's contact filter are included.
+    * The contacts are only valid while the handlers run.
+    */
+    struct ContactBatchEvent
+    {
+        const std::vector<ContactRecord>* contacts{ nullptr };
+
+        inline size_t Size() const { return contacts ? contacts->size() : 0; }
+    };
+
     enum class EKeyEventType
     {
         Pressed,
@@ -3,6 +3,9 @@
 #include "Core/ECS/Components/ComponentSerializer.h"
 #include "Core/ECS/Registry.h"
 #include "Core/ECS/Entity.h"
+#include "Core/ECS/ECSUtils.h"
+#include "Core/Tilemap/Tilemap.h"
+#include "Core/Scripting/LuaChunkCache.h"
 #include "FileSystem/Serializers/JSONSerializer.h"
 #include "FileSystem/Serializers/LuaSerializer.h"
 #include "Logger/Logger.h"
@@ -33,6 +36,8 @@ namespace Feather {
 
 	bool TilemapLoader::LoadTilemapFromLuaTable(Registry& registry, const sol::table& tilemapTable)
 	{
+		auto& tilemap = ResetTilemap(registry);
+
 		if (!tilemapTable.valid() || tilemapTable.get_type() != sol::type::table)
 		{
 			F_ERROR("Failed to load tilemap map from table. Table is invalid");
@@ -48,7 +53,6 @@ namespace Feather {
 
 		for (const auto& [key, value] : *maybeTiles)
 		{
-			Entity newTile{ &registry, "", "" };
 			const sol::optional<sol::table> components = value.as<sol::table>()["components"];
 
 			if (!components)
@@ -57,41 +61,59 @@ namespace Feather {
 				return false;
 			}
 
-			// Transform
 			const sol::table luaTransform = (*components)["transform"];
+			sol::optional<sol::table> optLuaSprite = (*components)["sprite"];
+			sol::optional<sol::table> luaBoxCollider = (*components)["boxCollider"];
+			sol::optional<sol::table> luaCircleCollider = (*components)["circleCollider"];
+			sol::optional<sol::table> luaAnimations = (*components)["animation"];
+			sol::optional<sol::table> luaPhysics = (*components)["physics"];
+
+			// Tiles that only draw a sprite are baked into the tilemap chunks instead of becoming entities
+			if (optLuaSprite)
+			{
+				SpriteComponent sprite{};
+				DESERIALIZE_COMPONENT(*optLuaSprite, sprite);
+
+				if (Tilemap::IsStaticTile(sprite, luaBoxCollider || luaCircleCollider, luaAnimations.has_value(), luaPhysics.has_value()))
+				{
+					TransformComponent transform{};
+					DESERIALIZE_COMPONENT(luaTransform, transform);
+					tilemap.AddTile(transform, sprite);
+					continue;
+				}
+			}
+
+			Entity newTile{ &registry, "", "" };
+
+			// Transform
 			auto& transform = newTile.AddComponent<TransformComponent>();
 			DESERIALIZE_COMPONENT(luaTransform, transform);
 
 			// Sprite
-			sol::optional<sol::table> optLuaSprite = (*components)["sprite"];
 			if (optLuaSprite)
 			{
 				auto& sprite = newTile.AddComponent<SpriteComponent>();
 				DESERIALIZE_COMPONENT(*optLuaSprite, sprite);
 			}
 
-			sol::optional<sol::table> luaBoxCollider = (*components)["boxCollider"];
 			if (luaBoxCollider)
 			{
 				auto& boxCollider = newTile.AddComponent<BoxColliderComponent>();
 				DESERIALIZE_COMPONENT(*luaBoxCollider, boxCollider);
 			}
 
-			sol::optional<sol::table> luaCircleCollider = (*components)["circleCollider"];
 			if (luaCircleCollider)
 			{
 				auto& circleCollider = newTile.AddComponent<CircleColliderComponent>();
 				DESERIALIZE_COMPONENT(*luaCircleCollider, circleCollider);
 			}
 
-			sol::optional<sol::table> luaAnimations = (*components)["animation"];
 			if (luaAnimations)
 			{
 				auto& animation = newTile.AddComponent<AnimationComponent>();
 				DESERIALIZE_COMPONENT(*luaAnimations, animation);
 			}
 
-			sol::optional<sol::table> luaPhysics = (*components)["physics"];
 			if (luaPhysics)
 			{
 				auto& physics = newTile.AddComponent<PhysicsComponent>();
@@ -101,6 +123,7 @@ namespace Feather {
 			newTile.AddComponent<TileComponent>(TileComponent{ .id = static_cast<uint32_t>(newTile.GetEntity()) });
 		}
 
+		LogBakedTiles(tilemap);
 		return true;
 	}
 
@@ -256,12 +279,26 @@ namespace Feather {
 			serializer->EndObject();
 		}
 
+		if (auto* tilemap = registry.TryGetContext<std::shared_ptr<Tilemap>>())
+		{
+			(*tilemap)->ForEachTile([&](const TransformComponent& transform, const SpriteComponent& sprite) {
+				serializer->StartNewObject();
+				serializer->StartNewObject("components");
+				SERIALIZE_COMPONENT(*serializer, transform);
+				SERIALIZE_COMPONENT(*serializer, sprite);
+				serializer->EndObject();
+				serializer->EndObject();
+			});
+		}
+
 		serializer->EndArray();
 		return serializer->EndDocument();
 	}
 
 	bool TilemapLoader::LoadTilemapJSON(Registry& registry, const std::string& tilemapFile)
 	{
+		auto& bakedTiles = ResetTilemap(registry);
+
 		std::ifstream mapFile;
 		mapFile.open(tilemapFile);
 
@@ -298,16 +335,27 @@ namespace Feather {
 
 		for (const auto& tile : tilemap.GetArray())
 		{
-			Entity newTile{ &registry, "", "" };
 			const auto& components = tile["components"];
 
-			const auto& jsonTransform = components["transform"];
-			auto& transform = newTile.AddComponent<TransformComponent>();
-			DESERIALIZE_COMPONENT(jsonTransform, transform);
+			TransformComponent transform{};
+			DESERIALIZE_COMPONENT(components["transform"], transform);
 
-			const auto& jsonSprite = components["sprite"];
-			auto& sprite = newTile.AddComponent<SpriteComponent>();
-			DESERIALIZE_COMPONENT(jsonSprite, sprite);
+			SpriteComponent sprite{};
+			DESERIALIZE_COMPONENT(components["sprite"], sprite);
+
+			// Tiles that only draw a sprite are baked into the tilemap chunks instead of becoming entities
+			if (Tilemap::IsStaticTile(sprite,
+									  components.HasMember("boxCollider") || components.HasMember("circleCollider"),
+									  components.HasMember("animation"),
+									  components.HasMember("physics")))
+			{
+				bakedTiles.AddTile(transform, sprite);
+				continue;
+			}
+
+			Entity newTile{ &registry, "", "" };
+			newTile.AddComponent<TransformComponent>(transform);
+			newTile.AddComponent<SpriteComponent>(sprite);
 
 			if (components.HasMember("boxCollider"))
 			{
@@ -340,6 +388,7 @@ namespace Feather {
 			newTile.AddComponent<TileComponent>(TileComponent{ .id = static_cast<uint32_t>(newTile.GetEntity()) });
 		}
 
+		LogBakedTiles(bakedTiles);
 		mapFile.close();
 		return true;
 	}
@@ -562,6 +611,7 @@ namespace Feather {
 				const auto& jsonID = components["id"];
 				auto& id = gameObject.GetComponent<Identification>();
 				DESERIALIZE_COMPONENT(jsonID, id);
+				gameObject.GetEnttRegistry().patch<Identification>(gameObject.GetEntity());
 			}
 			if (components.HasMember("text"))
 			{
@@ -588,19 +638,7 @@ namespace Feather {
 				mapEntityToRelationship.emplace(gameObject.GetEntity(), saveRelations);
 			}
 
-			auto ids = registry.GetRegistry().view<Identification>(entt::exclude<TileComponent>);
-
-			auto findTag = [&](const std::string& sTag) {
-				auto parItr = std::ranges::find_if(ids, [&](const auto& e) {
-					Entity en{ &registry, e };
-					return en.GetName() == sTag;
-				});
-
-				if (parItr != ids.end())
-					return *parItr;
-
-				return entt::entity{ entt::null };
-			};
+			auto findTag = [&](const std::string& sTag) { return FindEntityByTag(registry, sTag); };
 
 			for (auto& [entity, saveRelations] : mapEntityToRelationship)
 			{
@@ -699,6 +737,18 @@ namespace Feather {
 			serializer->EndTable();
 		}
 
+		if (auto* tilemap = registry.TryGetContext<std::shared_ptr<Tilemap>>())
+		{
+			(*tilemap)->ForEachTile([&](const TransformComponent& transform, const SpriteComponent& sprite) {
+				serializer->StartNewTable();
+				serializer->StartNewTable("components");
+				SERIALIZE_COMPONENT(*serializer, transform);
+				SERIALIZE_COMPONENT(*serializer, sprite);
+				serializer->EndTable();
+				serializer->EndTable();
+			});
+		}
+
 		serializer->EndTable();
 		serializer->EndTable();
 
@@ -710,7 +760,7 @@ namespace Feather {
 		sol::state lua;
 		try
 		{
-			lua.safe_script_file(tilemapFile);
+			LuaChunkCache::RunFile(lua, tilemapFile);
 		}
 		catch (const sol::error& err)
 		{
@@ -718,66 +768,8 @@ namespace Feather {
 			return false;
 		}
 
-		sol::optional<sol::table> maybeTiles = lua["tilemap"];
-		if (!maybeTiles)
-		{
-			F_ERROR("Failed to load tilemap file. \"tilemap\" table is missing or invalid");
-			return false;
-		}
-
-		for (const auto& [key, value] : *maybeTiles)
-		{
-			Entity newTile{ &registry, "", "" };
-			const sol::optional<sol::table> components = value.as<sol::table>()["components"];
-
-			if (!components)
-			{
-				F_ERROR("Failed to load object map file. \"components\" table is missing or invalid");
-				return false;
-			}
-
-			// Transform
-			const sol::table luaTransform = (*components)["transform"];
-			auto& transform = newTile.AddComponent<TransformComponent>();
-			DESERIALIZE_COMPONENT(luaTransform, transform);
-
-			// Sprite
-			const sol::table luaSprite = (*components)["sprite"];
-			auto& sprite = newTile.AddComponent<SpriteComponent>();
-			DESERIALIZE_COMPONENT(luaTransform, sprite);
-
-			sol::optional<sol::table> luaBoxCollider = (*components)["boxCollider"];
-			if (luaBoxCollider)
-			{
-				auto& boxCollider = newTile.AddComponent<BoxColliderComponent>();
-				DESERIALIZE_COMPONENT(*luaBoxCollider, boxCollider);
-			}
-
-			sol::optional<sol::table> luaCircleCollider = (*components)["circleCollider"];
-			if (luaCircleCollider)
-			{
-				auto& circleCollider = newTile.AddComponent<CircleColliderComponent>();
-				DESERIALIZE_COMPONENT(*luaCircleCollider, circleCollider);
-			}
-
-			sol::optional<sol::table> luaAnimations = (*components)["animation"];
-			if (luaAnimations)
-			{
-				auto& animation = newTile.AddComponent<AnimationComponent>();
-				DESERIALIZE_COMPONENT(*luaAnimations, animation);
-			}
-
-			sol::optional<sol::table> luaPhysics = (*components)["physics"];
-			if (luaPhysics)
-			{
-				auto& physics = newTile.AddComponent<PhysicsComponent>();
-				DESERIALIZE_COMPONENT(*luaPhysics, physics);
-			}
-
-			newTile.AddComponent<TileComponent>(TileComponent{ .id = static_cast<uint32_t>(newTile.GetEntity()) });
-		}
-
-		return true;
+		// Same path as the runtime so the editor bakes the same tiles
+		return LoadTilemapFromLuaTable(registry, lua.globals());
 	}
 
 	bool TilemapLoader::SaveObjectMapLua(Registry& registry, const std::string& objectMapFile)
@@ -922,7 +914,7 @@ namespace Feather {
 
 		try
 		{
-			lua.safe_script_file(objectMapFile);
+			LuaChunkCache::RunFile(lua, objectMapFile);
 		}
 		catch (const sol::error& err)
 		{
@@ -997,6 +989,7 @@ namespace Feather {
 			{
 				auto& id = gameObject.GetComponent<Identification>();
 				DESERIALIZE_COMPONENT(*luaID, id);
+				gameObject.GetEnttRegistry().patch<Identification>(gameObject.GetEntity());
 			}
 
 			const sol::optional<sol::table> luaUI = (*components)["ui"];
@@ -1019,21 +1012,7 @@ namespace Feather {
 			}
 		}
 
-		auto ids = registry.GetRegistry().view<Identification>(entt::exclude<TileComponent>);
-
-		auto findTag = [&](const std::string& sTag) {
-				auto parItr = std::ranges::find_if(ids, [&](const auto& e) {
-					Entity en{ &registry, e };
-					return en.GetName() == sTag;
-				});
-
-				if (parItr != ids.end())
-				{
-					return *parItr;
-				}
-
-				return entt::entity{ entt::null };
-		};
+		auto findTag = [&](const std::string& sTag) { return FindEntityByTag(registry, sTag); };
 
 		for (auto& [entity, saveRelations] : mapEntityToRelationship)
 		{
@@ -1068,4 +1047,26 @@ namespace Feather {
 		return true;
 	}
 
+	Tilemap& TilemapLoader::ResetTilemap(Registry& registry)
+	{
+		if (!registry.HasContext<std::shared_ptr<Tilemap>>())
+			registry.AddToContext<std::shared_ptr<Tilemap>>(std::make_shared<Tilemap>());
+
+		auto& tilemap = registry.GetContext<std::shared_ptr<Tilemap>>();
+
+		// Tiles from the previous scene are not entities and are not removed with them
+		tilemap->Clear();
+		return *tilemap;
+	}
+
+	void TilemapLoader::LogBakedTiles(const Tilemap& tilemap)
+	{
+		if (tilemap.GetNumTiles() == 0)
+			return;
+
+		F_INFO("Baked {} static tiles into {} tilemap chunks. Baked tiles have no entity, Identification or TileComponent and can not be looked up by scripts",
+			   tilemap.GetNumTiles(),
+			   tilemap.GetNumChunks());
+	}
+
 }
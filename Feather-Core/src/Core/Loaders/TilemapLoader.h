@@ -5,6 +5,7 @@
 namespace Feather {
 
 	class Registry;
+	class Tilemap;
 
 	class TilemapLoader
 	{
@@ -35,6 +36,10 @@ namespace Feather {
 		bool SaveObjectMapLua(Registry& registry, const std::string& objectMapFile);
 		bool LoadObjectMapLua(Registry& registry, const std::string& objectMapFile);
 
+		/* Gets the tilemap of the registry, creating it if needed, and removes the tiles of the previous load */
+		Tilemap& ResetTilemap(Registry& registry);
+		void LogBakedTiles(const Tilemap& tilemap);
+
 	};
 
 	struct SaveRelationship
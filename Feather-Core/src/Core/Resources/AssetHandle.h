@@ -0,0 +1,147 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+namespace Feather {
+
+	/*
+	* @brief Generation checked index of an asset in the asset manager.
+	* Components cache it next to the asset name so the asset can be resolved without a map lookup.
+	* A default constructed handle is invalid and is filled in on the first resolve.
+	*/
+	template <typename TAsset>
+	struct AssetHandle
+	{
+		static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+		uint32_t index{ INVALID_INDEX };
+		uint32_t generation{ 0 };
+
+		inline bool IsValid() const { return index != INVALID_INDEX; }
+	};
+
+	/*
+	* @brief Interns asset names into stable slots that point at the asset manager's entries.
+	* The slots point into the nodes of the asset map, which keep their address when the asset is reloaded in place
+	* or renamed, so handles stay valid across both. Deleting an asset bumps the generation of its slot so old handles fail.
+	*/
+	template <typename TAsset>
+	class AssetSlotArray
+	{
+	public:
+		/*
+		* @brief Resolves the handle without touching the asset map.
+		* @param name Name the caller expects, a handle cached for a different name is treated as stale.
+		* @return The entry of the asset, or nullptr if the handle is stale and must be acquired again.
+		*/
+		inline const std::shared_ptr<TAsset>* Get(const AssetHandle<TAsset>& handle, std::string_view name, uint64_t frameIndex) const
+		{
+			if (handle.index >= m_Slots.size())
+				return nullptr;
+
+			const auto& slot = m_Slots[handle.index];
+			if (slot.generation != handle.generation || !slot.pAsset || !*slot.pAsset || slot.name != name)
+				return nullptr;
+
+			if (slot.pLastUsedFrame)
+				*slot.pLastUsedFrame = frameIndex;
+
+			return slot.pAsset;
+		}
+
+		/*
+		* @brief Returns the handle of the name, creating a slot for it if it does not have one yet.
+		* @param pAsset Entry of the asset in the asset map.
+		* @param pLastUsedFrame Last used frame of a packed asset, updated whenever the handle is resolved. May be null.
+		*/
+		AssetHandle<TAsset> Acquire(const std::string& name, std::shared_ptr<TAsset>* pAsset, uint64_t* pLastUsedFrame)
+		{
+			uint32_t index{ AssetHandle<TAsset>::INVALID_INDEX };
+			if (auto nameItr = m_mapSlotIndices.find(name); nameItr != m_mapSlotIndices.end())
+			{
+				index = nameItr->second;
+			}
+			else if (!m_FreeSlots.empty())
+			{
+				index = m_FreeSlots.back();
+				m_FreeSlots.pop_back();
+				m_mapSlotIndices.emplace(name, index);
+			}
+			else
+			{
+				index = static_cast<uint32_t>(m_Slots.size());
+				m_Slots.emplace_back();
+				m_mapSlotIndices.emplace(name, index);
+			}
+
+			auto& slot = m_Slots[index];
+			slot.name = name;
+			slot.pAsset = pAsset;
+			slot.pLastUsedFrame = pLastUsedFrame;
+
+			return AssetHandle<TAsset>{ .index = index, .generation = slot.generation };
+		}
+
+		/*
+		* @brief Unloads the asset but keeps the slot, the handles resolve again once the asset is reloaded.
+		*/
+		void Detach(const std::string& name)
+		{
+			if (auto nameItr = m_mapSlotIndices.find(name); nameItr != m_mapSlotIndices.end())
+				m_Slots[nameItr->second].pAsset = nullptr;
+		}
+
+		/*
+		* @brief Frees the slot of a deleted asset. Every handle to it becomes stale.
+		*/
+		void Release(const std::string& name)
+		{
+			auto nameItr = m_mapSlotIndices.find(name);
+			if (nameItr == m_mapSlotIndices.end())
+				return;
+
+			auto& slot = m_Slots[nameItr->second];
+			slot.name.clear();
+			slot.pAsset = nullptr;
+			slot.pLastUsedFrame = nullptr;
+			++slot.generation;
+
+			m_FreeSlots.push_back(nameItr->second);
+			m_mapSlotIndices.erase(nameItr);
+		}
+
+		/*
+		* @brief Moves the slot to the new name. Handles resolved with the new name stay valid.
+		*/
+		void Rename(const std::string& oldName, const std::string& newName)
+		{
+			auto nameItr = m_mapSlotIndices.find(oldName);
+			if (nameItr == m_mapSlotIndices.end())
+				return;
+
+			uint32_t index = nameItr->second;
+			m_mapSlotIndices.erase(nameItr);
+			m_mapSlotIndices.emplace(newName, index);
+			m_Slots[index].name = newName;
+		}
+
+	private:
+		struct Slot
+		{
+			std::string name{};
+			/* Points into the asset map node */
+			std::shared_ptr<TAsset>* pAsset{ nullptr };
+			uint64_t* pLastUsedFrame{ nullptr };
+			uint32_t generation{ 0 };
+		};
+
+		std::vector<Slot> m_Slots;
+		std::vector<uint32_t> m_FreeSlots;
+		std::unordered_map<std::string, uint32_t> m_mapSlotIndices;
+	};
+
+}
@@ -25,14 +25,25 @@ using namespace std::chrono_literals;
 
 namespace Feather {
 
+    namespace {
+
+        /*
+        * @brief Async texture load returned to scripts. Scripts run on the main thread, which is the thread
+        * that uploads the texture, so they poll the request instead of waiting on it.
+        */
+        struct TextureLoadRequest
+        {
+            AssetManager::TextureHandle handle;
+
+            inline bool IsReady() const { return handle.valid() && handle.wait_for(0s) == std::future_status::ready; }
+            inline bool Succeeded() const { return IsReady() && handle.get() != nullptr; }
+        };
+
+    }
+
     AssetManager::AssetManager(bool enableFilewatcher)
         : m_FileWatcherRunning{ enableFilewatcher }
     {
-        if (enableFilewatcher)
-        {
-            m_WatchThread = std::jthread(&AssetManager::FileWatcher, this);
-        }
-
 #ifdef IN_FEATHER_EDITOR
         IMG_Init(IMG_INIT_PNG);
         m_mapCursors.emplace("default", MakeSharedFromSDLType<Cursor>(SDL_GetDefaultCursor()));
@@ -41,10 +52,15 @@ namespace Feather {
 
     AssetManager::~AssetManager()
     {
+        // Stop the watcher threads before the params they mark are destroyed
         m_FileWatcherRunning = false;
-        if (m_WatchThread.joinable())
+        m_mapDirectoryWatchers.clear();
+
+        // Decodes of packed textures read from the mapped packs
+        for (auto& pendingTexture : m_PendingTextures)
         {
-            m_WatchThread.join();
+            if (pendingTexture.decodeFuture.valid())
+                pendingTexture.decodeFuture.wait();
         }
     }
 
@@ -88,19 +104,7 @@ namespace Feather {
 
         if (m_FileWatcherRunning && isSuccess)
         {
-            std::lock_guard lock{ m_AssetMutex };
-
-            fs::path path{ texturePath };
-            auto lastWrite = fs::last_write_time(path);
-            if (CheckContainsValue(m_FilewatchParams, [&](const auto& params) { return params.filepath == texturePath; }))
-            {
-                m_FilewatchParams.emplace_back(
-                    AssetWatchParams{
-                        .assetName = textureName,
-                        .filepath = texturePath,
-                        .lastWrite = lastWrite,
-                        .type = AssetType::TEXTURE });
-            }
+            WatchAssetFile(textureName, texturePath, AssetType::TEXTURE);
         }
 
         return isSuccess;
@@ -133,10 +137,23 @@ namespace Feather {
         auto texIter = m_mapTextures.find(textureName);
         if (texIter == m_mapTextures.end())
         {
+            // The texture is needed now, finish its async load instead of waiting for the upload queue
+            auto pendingItr = std::ranges::find_if(m_PendingTextures, [&](const auto& pending) { return pending.textureName == textureName; });
+            if (pendingItr != m_PendingTextures.end())
+            {
+                auto pTexture = FinishTextureLoad(*pendingItr);
+                m_PendingTextures.erase(pendingItr);
+                return pTexture;
+            }
+
+            if (LoadPackedAsset(textureName, AssetType::TEXTURE))
+                return m_mapTextures[textureName];
+
             F_ERROR("Failed to get texture '{0}': Does not exist!", textureName);
             return nullptr;
         }
 
+        TouchPackedAsset(textureName, AssetType::TEXTURE);
         return texIter->second;
     }
 
@@ -165,24 +182,13 @@ namespace Feather {
 
         if (m_FileWatcherRunning && isSuccess)
         {
-            std::lock_guard lock{ m_AssetMutex };
-
-            fs::path path{ fontPath };
-            auto lastWrite = fs::last_write_time(path);
-            if (CheckContainsValue(m_FilewatchParams, [&](const auto& params) { return params.filepath == fontPath; }))
-            {
-                m_FilewatchParams.emplace_back(
-                    AssetWatchParams{ .assetName = fontName,
-                                      .filepath = fontPath,
-                                      .lastWrite = lastWrite,
-                                      .type = AssetType::FONT });
-            }
+            WatchAssetFile(fontName, fontPath, AssetType::FONT);
         }
 
         return isSuccess;
     }
 
-    bool AssetManager::AddFontFromMemory(const std::string& fontName, unsigned char* fontData, float fontSize)
+    bool AssetManager::AddFontFromMemory(const std::string& fontName, const unsigned char* fontData, float fontSize)
     {
         if (m_mapFonts.contains(fontName))
         {
@@ -208,6 +214,9 @@ namespace Feather {
         auto fontItr = m_mapFonts.find(fontName);
         if (fontItr == m_mapFonts.end())
         {
+            if (LoadPackedAsset(fontName, AssetType::FONT))
+                return m_mapFonts[fontName];
+
             F_ERROR("Failed to get font '{0}': Does not exist!", fontName);
             return nullptr;
         }
@@ -234,29 +243,8 @@ namespace Feather {
 
         if (m_FileWatcherRunning && isSuccess)
         {
-            std::lock_guard lock{ m_AssetMutex };
-
-            fs::path pathVert{ vertexPath };
-            auto lastWriteVert = fs::last_write_time(pathVert);
-            if (CheckContainsValue(m_FilewatchParams, [&](const auto& params) { return params.filepath == vertexPath; }))
-            {
-                m_FilewatchParams.emplace_back(
-                    AssetWatchParams{ .assetName = shaderName + "_vert",
-                                      .filepath = vertexPath,
-                                      .lastWrite = lastWriteVert,
-                                      .type = AssetType::SHADER });
-            }
-
-            fs::path pathFrag{ fragmentPath };
-            auto lastWriteFrag = fs::last_write_time(pathFrag);
-            if (CheckContainsValue(m_FilewatchParams, [&](const auto& params) { return params.filepath == fragmentPath; }))
-            {
-                m_FilewatchParams.emplace_back(
-                    AssetWatchParams{ .assetName = shaderName + "_frag",
-                                      .filepath = fragmentPath,
-                                      .lastWrite = lastWriteFrag,
-                                      .type = AssetType::SHADER });
-            }
+            WatchAssetFile(shaderName + "_vert", vertexPath, AssetType::SHADER);
+            WatchAssetFile(shaderName + "_frag", fragmentPath, AssetType::SHADER);
         }
 
         return isSuccess;
@@ -288,6 +276,58 @@ namespace Feather {
         return shaderIter->second;
     }
 
+    /*
+    * @brief Slow path of the Resolve functions. Looks the asset up by name and points the handle at its slot.
+    */
+    template <typename TAsset, typename GetFunc>
+    static const std::shared_ptr<TAsset>& AcquireAsset(const std::string& name, AssetHandle<TAsset>& handle, AssetSlotArray<TAsset>& slots,
+                                                       std::map<std::string, std::shared_ptr<TAsset>>& mapAssets, uint64_t* pLastUsedFrame,
+                                                       GetFunc&& getAsset)
+    {
+        static const std::shared_ptr<TAsset> s_NullAsset{ nullptr };
+
+        auto assetItr = getAsset(name) ? mapAssets.find(name) : mapAssets.end();
+        if (assetItr == mapAssets.end())
+        {
+            handle = AssetHandle<TAsset>{};
+            return s_NullAsset;
+        }
+
+        handle = slots.Acquire(name, &assetItr->second, pLastUsedFrame);
+        return assetItr->second;
+    }
+
+    const std::shared_ptr<Texture>& AssetManager::ResolveTexture(std::string_view textureName, AssetHandle<Texture>& handle)
+    {
+        if (const auto* pTexture = m_TextureSlots.Get(handle, textureName, m_FrameIndex))
+            return *pTexture;
+
+        std::string name{ textureName };
+        auto* pPackedAsset = FindPackedAsset(name, AssetType::TEXTURE);
+        return AcquireAsset(name, handle, m_TextureSlots, m_mapTextures, pPackedAsset ? &pPackedAsset->lastUsedFrame : nullptr,
+                            [this](const std::string& assetName) { return GetTexture(assetName); });
+    }
+
+    const std::shared_ptr<Font>& AssetManager::ResolveFont(std::string_view fontName, AssetHandle<Font>& handle)
+    {
+        if (const auto* pFont = m_FontSlots.Get(handle, fontName, m_FrameIndex))
+            return *pFont;
+
+        std::string name{ fontName };
+        auto* pPackedAsset = FindPackedAsset(name, AssetType::FONT);
+        return AcquireAsset(name, handle, m_FontSlots, m_mapFonts, pPackedAsset ? &pPackedAsset->lastUsedFrame : nullptr,
+                            [this](const std::string& assetName) { return GetFont(assetName); });
+    }
+
+    const std::shared_ptr<Shader>& AssetManager::ResolveShader(std::string_view shaderName, AssetHandle<Shader>& handle)
+    {
+        if (const auto* pShader = m_ShaderSlots.Get(handle, shaderName, m_FrameIndex))
+            return *pShader;
+
+        return AcquireAsset(std::string{ shaderName }, handle, m_ShaderSlots, m_mapShaders, nullptr,
+                            [this](const std::string& assetName) { return GetShader(assetName); });
+    }
+
     bool AssetManager::AddMusic(const std::string& musicName, const std::string& filepath)
     {
         if (m_mapMusic.contains(musicName))
@@ -318,18 +358,7 @@ namespace Feather {
 
         if (m_FileWatcherRunning && isSuccess)
         {
-            std::lock_guard lock{ m_AssetMutex };
-
-            fs::path path{ filepath };
-            auto lastWrite = fs::last_write_time(path);
-            if (CheckContainsValue(m_FilewatchParams, [&](const auto& params) { return params.filepath == filepath; }))
-            {
-                m_FilewatchParams.emplace_back(
-                    AssetWatchParams{ .assetName = musicName,
-                                      .filepath = filepath,
-                                      .lastWrite = lastWrite,
-                                      .type = AssetType::MUSIC });
-            }
+            WatchAssetFile(musicName, filepath, AssetType::MUSIC);
         }
 
         return isSuccess;
@@ -378,6 +407,9 @@ namespace Feather {
         auto musicItr = m_mapMusic.find(musicName);
         if (musicItr == m_mapMusic.end())
         {
+            if (LoadPackedAsset(musicName, AssetType::MUSIC))
+                return m_mapMusic[musicName];
+
             F_ERROR("Failed to get '{0}': Does not exist!", musicName);
             return nullptr;
         }
@@ -452,19 +484,9 @@ namespace Feather {
         auto pSoundFx = std::make_shared<SoundFX>(params, SoundFXPtr{ chunk });
         auto [itr, isSuccess] = m_mapSoundFX.emplace(soundFxName, std::move(pSoundFx));
 
-        if (isSuccess)
+        if (m_FileWatcherRunning && isSuccess)
         {
-            std::lock_guard lock{ m_AssetMutex };
-            fs::path path{ filepath };
-            auto lastWrite = fs::last_write_time(path);
-            if (CheckContainsValue(m_FilewatchParams, [&](const auto& params) { return params.filepath == filepath; }))
-            {
-                m_FilewatchParams.emplace_back(
-                    AssetWatchParams{ .assetName = soundFxName,
-                                      .filepath = filepath,
-                                      .lastWrite = lastWrite,
-                                      .type = AssetType::SOUNDFX });
-            }
+            WatchAssetFile(soundFxName, filepath, AssetType::SOUNDFX);
         }
 
         return isSuccess;
@@ -533,10 +555,14 @@ namespace Feather {
         auto soundItr = m_mapSoundFX.find(soundFxName);
         if (soundItr == m_mapSoundFX.end())
         {
+            if (LoadPackedAsset(soundFxName, AssetType::SOUNDFX))
+                return m_mapSoundFX[soundFxName];
+
             F_ERROR("Failed to get sound effect '{0}': Does not exist!", soundFxName);
             return nullptr;
         }
 
+        TouchPackedAsset(soundFxName, AssetType::SOUNDFX);
         return soundItr->second;
     }
 
@@ -649,9 +675,20 @@ namespace Feather {
         switch (assetType)
         {
         case AssetType::TEXTURE:
-            isSuccess = KeyChange(m_mapTextures, oldName, newName); break;
+        {
+            // The map node is moved to the new key, so the slot keeps pointing at the texture
+            isSuccess = KeyChange(m_mapTextures, oldName, newName);
+            if (isSuccess)
+                m_TextureSlots.Rename(oldName, newName);
+            break;
+        }
         case AssetType::FONT:
-            isSuccess = KeyChange(m_mapFonts, oldName, newName); break;
+        {
+            isSuccess = KeyChange(m_mapFonts, oldName, newName);
+            if (isSuccess)
+                m_FontSlots.Rename(oldName, newName);
+            break;
+        }
         case AssetType::SOUNDFX:
             isSuccess = KeyChange(m_mapSoundFX, oldName, newName); break;
         case AssetType::MUSIC:
@@ -677,6 +714,10 @@ namespace Feather {
 
     bool AssetManager::HasAsset(const std::string& assetName, AssetType assetType)
     {
+        // Packed assets that are not resident yet are loaded on first use
+        if (FindPackedAsset(assetName, assetType))
+            return true;
+
         switch (assetType)
         {
         case AssetType::TEXTURE:
@@ -703,9 +744,17 @@ namespace Feather {
         switch (assetType)
         {
         case AssetType::TEXTURE:
-            isSuccess = std::erase_if(m_mapTextures, [&](const auto& pair) { return pair.first == assetName; }) > 0; break;
+        {
+            isSuccess = std::erase_if(m_mapTextures, [&](const auto& pair) { return pair.first == assetName; }) > 0;
+            m_TextureSlots.Release(assetName);
+            break;
+        }
         case AssetType::FONT:
-            isSuccess = std::erase_if(m_mapFonts, [&](const auto& pair) { return pair.first == assetName; }) > 0; break;
+        {
+            isSuccess = std::erase_if(m_mapFonts, [&](const auto& pair) { return pair.first == assetName; }) > 0;
+            m_FontSlots.Release(assetName);
+            break;
+        }
         case AssetType::SOUNDFX:
             isSuccess = std::erase_if(m_mapSoundFX, [&](const auto& pair) { return pair.first == assetName; }) > 0; break;
         case AssetType::MUSIC:
@@ -787,6 +836,15 @@ namespace Feather {
         auto& mainRegistry = MAIN_REGISTRY();
         auto& asset_manager = mainRegistry.GetAssetManager();
 
+        lua.new_usertype<TextureLoadRequest>(
+            "TextureLoadRequest",
+            sol::no_constructor,
+            "isReady",
+            &TextureLoadRequest::IsReady,
+            "succeeded",
+            &TextureLoadRequest::Succeeded
+        );
+
         lua.new_usertype<AssetManager>(
             "AssetManager",
             sol::no_constructor,
@@ -815,48 +873,499 @@ namespace Feather {
             [&](const std::string& fontName, const std::string& fontPath, float fontSize)
             {
                 return asset_manager.AddFont(fontName, fontPath, fontSize);
+            },
+            "addTextureAsync",
+            sol::overload(
+                [&](const std::string& assetName, const std::string& filepath, bool pixel_art)
+                {
+                    return TextureLoadRequest{ asset_manager.AddTextureAsync(assetName, filepath, pixel_art, false) };
+                },
+                [&](const std::string& assetName, const std::string& filepath, bool pixel_art, bool isTileset)
+                {
+                    return TextureLoadRequest{ asset_manager.AddTextureAsync(assetName, filepath, pixel_art, isTileset) };
+                }
+            ),
+            "loadTextureAsync",
+            [&](const std::string& assetName)
+            {
+                return TextureLoadRequest{ asset_manager.LoadTextureAsync(assetName) };
+            },
+            "getLoadProgress",
+            [&]
+            {
+                return asset_manager.GetLoadProgress();
+            },
+            "isLoading",
+            [&]
+            {
+                return asset_manager.IsLoading();
             }
         );
     }
 
-    void AssetManager::Update()
+    void AssetManager::AddAssetPack(std::shared_ptr<AssetPack> pAssetPack)
     {
-        std::shared_lock sharedLock{ m_AssetMutex };
-        auto dirtyView = m_FilewatchParams | std::views::filter([](const auto& param) { return param.isDirty; });
+        if (!pAssetPack || !pAssetPack->IsOpen())
+        {
+            F_ERROR("Failed to add asset pack: Asset pack is not open");
+            return;
+        }
 
-        if (!dirtyView.empty())
+        for (const auto& view : pAssetPack->GetAssets())
         {
-            sharedLock.unlock();
-            std::unique_lock lock{ m_AssetMutex };
-            for (auto& param : dirtyView)
+            auto& packedAssets = m_mapPackedAssets[view.type];
+            auto [itr, isSuccess] = packedAssets.try_emplace(std::string{ view.name }, PackedAsset{ .view = view });
+            if (!isSuccess)
             {
-                ReloadAsset(param);
-                param.isDirty = false;
+                F_WARN("Packed asset '{}' already exists. Skipping duplicate", view.name);
             }
         }
+
+        m_AssetPacks.push_back(std::move(pAssetPack));
     }
 
-    void AssetManager::FileWatcher()
+    void AssetManager::PreloadAssets(const std::vector<std::string>& assetNames, AssetType assetType)
     {
-        while (m_FileWatcherRunning)
+        for (const auto& assetName : assetNames)
         {
-            std::this_thread::sleep_for(2s);
+            if (auto* pPackedAsset = FindPackedAsset(assetName, assetType))
+            {
+                // Textures decode on the job system and upload within the frame budget, a texture drawn before then is finished by GetTexture
+                if (!pPackedAsset->isResident && assetType == AssetType::TEXTURE)
+                    LoadTextureAsync(assetName);
+                else if (!pPackedAsset->isResident)
+                    LoadPackedAsset(assetName, assetType);
+
+                pPackedAsset->lastUsedFrame = m_FrameIndex;
+            }
+        }
+    }
+
+    AssetManager::PackedAsset* AssetManager::FindPackedAsset(const std::string& assetName, AssetType assetType)
+    {
+        auto typeItr = m_mapPackedAssets.find(assetType);
+        if (typeItr == m_mapPackedAssets.end())
+            return nullptr;
+
+        auto assetItr = typeItr->second.find(assetName);
+        return assetItr != typeItr->second.end() ? &assetItr->second : nullptr;
+    }
+
+    bool AssetManager::LoadPackedAsset(const std::string& assetName, AssetType assetType)
+    {
+        auto* pPackedAsset = FindPackedAsset(assetName, assetType);
+        if (!pPackedAsset || pPackedAsset->isResident)
+            return false;
+
+        const auto& view = pPackedAsset->view;
+        bool isSuccess{ false };
+        size_t residentSize{ view.size };
 
-            for (auto& fileParam : m_FilewatchParams)
+        switch (assetType)
+        {
+        case AssetType::TEXTURE:
+        {
+            isSuccess = AddTextureFromMemory(assetName, view.data, view.size, (view.flags & ASSET_PACK_FLAG_PIXEL_ART) != 0);
+            if (isSuccess)
             {
-                std::shared_lock sharedLock{ m_AssetMutex };
-                fs::path path{ fileParam.filepath };
-                if (!fs::exists(path))
-                    continue;
+                const auto& pTexture = m_mapTextures[assetName];
+                residentSize = static_cast<size_t>(pTexture->GetWidth()) * pTexture->GetHeight() * 4;
+            }
+            break;
+        }
+        case AssetType::FONT:
+            isSuccess = AddFontFromMemory(assetName, view.data, view.fontSize); break;
+        case AssetType::SOUNDFX:
+        {
+            isSuccess = AddSoundFxFromMemory(assetName, view.data, view.size);
+            if (isSuccess)
+            {
+                if (auto* pChunk = m_mapSoundFX[assetName]->GetSoundFxPtr())
+                    residentSize = pChunk->alen;
+            }
+            break;
+        }
+        case AssetType::MUSIC:
+            isSuccess = AddMusicFromMemory(assetName, view.data, view.size); break;
+        default:
+            F_ASSERT(false && "Cannot load this type from an asset pack!"); break;
+        }
+
+        if (!isSuccess)
+        {
+            F_ERROR("Failed to load packed asset '{}'", assetName);
+            return false;
+        }
 
-                if (fileParam.lastWrite != fs::last_write_time(path))
+        pPackedAsset->isResident = true;
+        pPackedAsset->residentSize = residentSize;
+        pPackedAsset->lastUsedFrame = m_FrameIndex;
+        m_ResidentMemory += residentSize;
+
+        return true;
+    }
+
+    bool AssetManager::EvictPackedAsset(const std::string& assetName, PackedAsset& packedAsset)
+    {
+        switch (packedAsset.view.type)
+        {
+        case AssetType::TEXTURE:
+        {
+            auto texItr = m_mapTextures.find(assetName);
+            // Something outside of the asset manager still holds the texture
+            if (texItr == m_mapTextures.end() || texItr->second.use_count() > 1)
+                return false;
+
+            GLuint textureID = texItr->second->GetID();
+            glDeleteTextures(1, &textureID);
+            m_mapTextures.erase(texItr);
+            // Keeps the slot so cached handles resolve again once the texture is reloaded
+            m_TextureSlots.Detach(assetName);
+            break;
+        }
+        case AssetType::SOUNDFX:
+        {
+            auto soundItr = m_mapSoundFX.find(assetName);
+            if (soundItr == m_mapSoundFX.end() || soundItr->second.use_count() > 1)
+                return false;
+
+            // Freeing a chunk halts every channel playing it
+            auto* pChunk = soundItr->second->GetSoundFxPtr();
+            const int numChannels = Mix_AllocateChannels(-1);
+            for (int i = 0; i < numChannels; i++)
+            {
+                if (Mix_Playing(i) && Mix_GetChunk(i) == pChunk)
+                    return false;
+            }
+
+            m_mapSoundFX.erase(soundItr);
+            break;
+        }
+        default:
+            // Music streams from the pack and fonts are small, they stay resident
+            return false;
+        }
+
+        packedAsset.isResident = false;
+        m_ResidentMemory -= packedAsset.residentSize;
+        packedAsset.residentSize = 0;
+
+        return true;
+    }
+
+    void AssetManager::EvictPackedAssets()
+    {
+        if (m_MemoryBudget == 0 || m_ResidentMemory <= m_MemoryBudget)
+            return;
+
+        std::vector<std::pair<const std::string*, PackedAsset*>> candidates;
+        for (auto& [type, packedAssets] : m_mapPackedAssets)
+        {
+            for (auto& [assetName, packedAsset] : packedAssets)
+            {
+                // Never evict assets that were used in the current or previous frame
+                if (packedAsset.isResident && packedAsset.lastUsedFrame + 1 < m_FrameIndex)
+                    candidates.emplace_back(&assetName, &packedAsset);
+            }
+        }
+
+        std::ranges::sort(candidates, [](const auto& a, const auto& b) { return a.second->lastUsedFrame < b.second->lastUsedFrame; });
+
+        for (auto& [pAssetName, pPackedAsset] : candidates)
+        {
+            if (m_ResidentMemory <= m_MemoryBudget)
+                break;
+
+            if (EvictPackedAsset(*pAssetName, *pPackedAsset))
+            {
+                F_TRACE("Evicted packed asset '{}'", *pAssetName);
+            }
+        }
+    }
+
+    static AssetManager::TextureHandle MakeReadyTextureHandle(std::shared_ptr<Texture> pTexture)
+    {
+        std::promise<std::shared_ptr<Texture>> promise;
+        promise.set_value(std::move(pTexture));
+        return promise.get_future().share();
+    }
+
+    AssetManager::TextureHandle AssetManager::AddTextureAsync(const std::string& textureName, const std::string& texturePath, bool pixelArt, bool isTileset)
+    {
+        if (auto pendingItr = std::ranges::find_if(m_PendingTextures, [&](const auto& pending) { return pending.textureName == textureName; });
+            pendingItr != m_PendingTextures.end())
+        {
+            return pendingItr->handle;
+        }
+
+        if (m_mapTextures.contains(textureName))
+        {
+            F_ERROR("Failed to add texture '{0}': Already exists!", textureName);
+            return MakeReadyTextureHandle(nullptr);
+        }
+
+        return QueueTextureLoad(
+            PendingTexture{ .textureName = textureName, .texturePath = texturePath, .pixelArt = pixelArt, .isTileset = isTileset });
+    }
+
+    AssetManager::TextureHandle AssetManager::LoadTextureAsync(const std::string& textureName)
+    {
+        if (auto texItr = m_mapTextures.find(textureName); texItr != m_mapTextures.end())
+            return MakeReadyTextureHandle(texItr->second);
+
+        if (auto pendingItr = std::ranges::find_if(m_PendingTextures, [&](const auto& pending) { return pending.textureName == textureName; });
+            pendingItr != m_PendingTextures.end())
+        {
+            return pendingItr->handle;
+        }
+
+        auto* pPackedAsset = FindPackedAsset(textureName, AssetType::TEXTURE);
+        if (!pPackedAsset)
+        {
+            F_ERROR("Failed to load texture '{}' async: Texture is not in an asset pack", textureName);
+            return MakeReadyTextureHandle(nullptr);
+        }
+
+        return QueueTextureLoad(
+            PendingTexture{
+                .textureName = textureName,
+                .pData = pPackedAsset->view.data,
+                .dataSize = pPackedAsset->view.size,
+                .pixelArt = (pPackedAsset->view.flags & ASSET_PACK_FLAG_PIXEL_ART) != 0 });
+    }
+
+    float AssetManager::GetLoadProgress() const
+    {
+        if (m_NumAsyncRequested == 0)
+            return 1.0f;
+
+        return static_cast<float>(m_NumAsyncCompleted) / static_cast<float>(m_NumAsyncRequested);
+    }
+
+    AssetManager::TextureHandle AssetManager::QueueTextureLoad(PendingTexture&& pendingTexture)
+    {
+        pendingTexture.handle = pendingTexture.promise.get_future().share();
+        auto handle = pendingTexture.handle;
+
+        // Start a new batch for the load progress
+        if (m_PendingTextures.empty())
+        {
+            m_NumAsyncRequested = 0;
+            m_NumAsyncCompleted = 0;
+        }
+
+        ++m_NumAsyncRequested;
+
+        if (!m_JobSystem)
+        {
+            FinishTextureLoad(pendingTexture);
+            return handle;
+        }
+
+        m_PendingTextures.push_back(std::move(pendingTexture));
+
+        if (m_PendingTextures.size() <= MAX_IN_FLIGHT_DECODES)
+            SubmitTextureDecode(m_PendingTextures.back());
+
+        return handle;
+    }
+
+    void AssetManager::SubmitTextureDecode(PendingTexture& pendingTexture)
+    {
+        if (pendingTexture.decodeFuture.valid())
+            return;
+
+        pendingTexture.decodeFuture = m_JobSystem->Enqueue(
+            [texturePath = pendingTexture.texturePath, pData = pendingTexture.pData, dataSize = pendingTexture.dataSize]
+            {
+                DecodedImage image{};
+                if (pData)
+                    TextureLoader::DecodeImageFromMemory(pData, dataSize, image);
+                else
+                    TextureLoader::DecodeImage(texturePath, image);
+
+                return image;
+            });
+    }
+
+    std::shared_ptr<Texture> AssetManager::FinishTextureLoad(PendingTexture& pendingTexture)
+    {
+        DecodedImage image{};
+        if (pendingTexture.decodeFuture.valid())
+        {
+            image = pendingTexture.decodeFuture.get();
+        }
+        else if (pendingTexture.pData)
+        {
+            TextureLoader::DecodeImageFromMemory(pendingTexture.pData, pendingTexture.dataSize, image);
+        }
+        else
+        {
+            TextureLoader::DecodeImage(pendingTexture.texturePath, image);
+        }
+
+        std::shared_ptr<Texture> pTexture{ nullptr };
+
+        // The texture may have been added synchronously while it was decoding
+        if (auto texItr = m_mapTextures.find(pendingTexture.textureName); texItr != m_mapTextures.end())
+        {
+            pTexture = texItr->second;
+        }
+        else if (image.pixels)
+        {
+            pTexture = TextureLoader::CreateFromImage(image, !pendingTexture.pixelArt, pendingTexture.texturePath, pendingTexture.isTileset);
+            if (pTexture)
+            {
+                m_mapTextures.emplace(pendingTexture.textureName, pTexture);
+
+                if (auto* pPackedAsset = FindPackedAsset(pendingTexture.textureName, AssetType::TEXTURE); pPackedAsset && pendingTexture.pData)
+                {
+                    pPackedAsset->isResident = true;
+                    pPackedAsset->residentSize = static_cast<size_t>(pTexture->GetWidth()) * pTexture->GetHeight() * 4;
+                    pPackedAsset->lastUsedFrame = m_FrameIndex;
+                    m_ResidentMemory += pPackedAsset->residentSize;
+                }
+                else if (m_FileWatcherRunning && !pendingTexture.pData)
                 {
-                    sharedLock.unlock();
-                    std::unique_lock lock{ m_AssetMutex };
-                    fileParam.isDirty = true;
+                    WatchAssetFile(pendingTexture.textureName, pendingTexture.texturePath, AssetType::TEXTURE);
                 }
             }
         }
+
+        if (!pTexture)
+        {
+            F_ERROR("Failed to load texture '{}' async", pendingTexture.textureName);
+        }
+
+        pendingTexture.promise.set_value(pTexture);
+        ++m_NumAsyncCompleted;
+
+        return pTexture;
+    }
+
+    void AssetManager::UpdateAsyncLoads()
+    {
+        if (m_PendingTextures.empty())
+            return;
+
+        const auto uploadStart = std::chrono::steady_clock::now();
+        const auto uploadBudget = std::chrono::duration<double, std::milli>(m_UploadBudgetMs);
+
+        for (size_t i = 0; i < m_PendingTextures.size() && i < MAX_IN_FLIGHT_DECODES;)
+        {
+            auto& pendingTexture = m_PendingTextures[i];
+            SubmitTextureDecode(pendingTexture);
+
+            if (pendingTexture.decodeFuture.wait_for(0s) != std::future_status::ready)
+            {
+                ++i;
+                continue;
+            }
+
+            FinishTextureLoad(pendingTexture);
+            m_PendingTextures.erase(m_PendingTextures.begin() + i);
+
+            if (std::chrono::steady_clock::now() - uploadStart >= uploadBudget)
+                break;
+        }
+
+        // Keep the decode window full for the next frame
+        for (size_t i = 0; i < m_PendingTextures.size() && i < MAX_IN_FLIGHT_DECODES; i++)
+        {
+            SubmitTextureDecode(m_PendingTextures[i]);
+        }
+    }
+
+    void AssetManager::Update()
+    {
+        ++m_FrameIndex;
+        EvictPackedAssets();
+        UpdateAsyncLoads();
+
+        if (!m_HasDirtyAssets.exchange(false))
+            return;
+
+        // Reload from copies without holding the lock, reloading deletes and re-adds the watch params
+        std::vector<AssetWatchParams> dirtyParams;
+        {
+            std::lock_guard lock{ m_AssetMutex };
+            for (auto& param : m_FilewatchParams)
+            {
+                if (!param.isDirty)
+                    continue;
+
+                dirtyParams.push_back(param);
+                param.isDirty = false;
+            }
+        }
+
+        for (const auto& param : dirtyParams)
+        {
+            ReloadAsset(param);
+        }
+    }
+
+    void AssetManager::WatchAssetFile(const std::string& assetName, const std::string& filepath, AssetType type)
+    {
+        std::error_code ec;
+        fs::path watchPath = fs::absolute(fs::path{ filepath }, ec).lexically_normal();
+        auto lastWrite = fs::last_write_time(watchPath, ec);
+        if (ec)
+        {
+            F_WARN("Failed to watch '{}' at path '{}': {}", assetName, filepath, ec.message());
+            return;
+        }
+
+        std::lock_guard lock{ m_AssetMutex };
+
+        if (!CheckContainsValue(m_FilewatchParams, [&](const auto& params) { return params.filepath == filepath; }))
+            return;
+
+        m_FilewatchParams.emplace_back(
+            AssetWatchParams{ .assetName = assetName,
+                              .filepath = filepath,
+                              .watchPath = watchPath,
+                              .lastWrite = lastWrite,
+                              .type = type });
+
+        // Watchers are recursive, so a directory under an already watched root is covered
+        fs::path directory = watchPath.parent_path();
+        bool isWatched = std::ranges::any_of(m_mapDirectoryWatchers, [&](const auto& watcherPair) {
+            auto relative = directory.lexically_relative(fs::path{ watcherPair.first });
+            return !relative.empty() && *relative.begin() != "..";
+        });
+
+        if (isWatched)
+            return;
+
+        m_mapDirectoryWatchers.emplace(
+            directory.string(),
+            std::make_unique<DirectoryWatcher>(
+                directory, [this](const fs::path& path, bool modified) { OnWatchedFileChanged(path, modified); }));
+    }
+
+    void AssetManager::OnWatchedFileChanged(const fs::path& path, bool modified)
+    {
+        // Deleted files keep their loaded asset until they are written again
+        if (!modified)
+            return;
+
+        fs::path changedPath = path.lexically_normal();
+        std::error_code ec;
+        auto lastWrite = fs::last_write_time(changedPath, ec);
+        if (ec)
+            return;
+
+        std::lock_guard lock{ m_AssetMutex };
+        for (auto& fileParam : m_FilewatchParams)
+        {
+            // Saving can raise several events, only a new write time triggers a reload
+            if (fileParam.watchPath != changedPath || fileParam.lastWrite == lastWrite)
+                continue;
+
+            fileParam.isDirty = true;
+            m_HasDirtyAssets = true;
+        }
     }
 
     void AssetManager::ReloadAsset(const AssetWatchParams& assetParams)
@@ -873,40 +1382,60 @@ namespace Feather {
 
     void AssetManager::ReloadTexture(const std::string& textureName)
     {
-        auto fileParamItr = std::ranges::find_if(m_FilewatchParams, [&](const auto& param) { return param.assetName == textureName; });
+        {
+            std::lock_guard lock{ m_AssetMutex };
+            auto fileParamItr = std::ranges::find_if(m_FilewatchParams, [&](const auto& param) { return param.assetName == textureName; });
+
+            if (fileParamItr == m_FilewatchParams.end())
+            {
+                F_ERROR("Trying to reload a texture that has not been loaded?");
+                return;
+            }
 
-        if (fileParamItr == m_FilewatchParams.end())
+            std::error_code ec;
+            fileParamItr->lastWrite = fs::last_write_time(fileParamItr->watchPath, ec);
+        }
+
+        auto texItr = m_mapTextures.find(textureName);
+        if (texItr == m_mapTextures.end() || !texItr->second)
         {
-            F_ERROR("Trying to reload a texture that has not been loaded?");
+            F_ERROR("Failed to reload texture '{}': Texture is not loaded", textureName);
             return;
         }
 
-        // We are assuming that the texture is in the map.
-        // Could potentially cause a crash, will look more into this.
-        auto& pTexture = m_mapTextures[textureName];
+        auto& pTexture = texItr->second;
+
+        // The file may still be being written, keep the old texture until the new one loads
+        auto pNewTexture = TextureLoader::Create(pTexture->GetType(), pTexture->GetPath(), pTexture->IsTileset());
+        if (!pNewTexture)
+        {
+            F_ERROR("Failed to reload texture '{}', keeping the previous version", textureName);
+            return;
+        }
 
-        fileParamItr->lastWrite = fs::last_write_time(fs::path{ pTexture->GetPath() });
-        // Delete the old texture and then reload
         auto id = pTexture->GetID();
         glDeleteTextures(1, &id);
 
-        auto pNewTexture = TextureLoader::Create(pTexture->GetType(), pTexture->GetPath(), pTexture->IsTileset());
-
         pTexture = pNewTexture;
         F_TRACE("Reloaded texture: {}", textureName);
     }
 
     void AssetManager::ReloadSoundFx(const std::string& soundName)
     {
-        auto fileParamItr = std::ranges::find_if(m_FilewatchParams, [&](const auto& param) { return param.assetName == soundName; });
-
-        if (fileParamItr == m_FilewatchParams.end())
+        // Copied since deleting the asset erases its watch params
+        std::string filepath{};
         {
-            F_ERROR("Trying to reload a texture that has not been loaded?");
-            return;
-        }
+            std::lock_guard lock{ m_AssetMutex };
+            auto fileParamItr = std::ranges::find_if(m_FilewatchParams, [&](const auto& param) { return param.assetName == soundName; });
+
+            if (fileParamItr == m_FilewatchParams.end())
+            {
+                F_ERROR("Trying to reload a texture that has not been loaded?");
+                return;
+            }
 
-        fileParamItr->lastWrite = fs::last_write_time(fs::path{ fileParamItr->filepath });
+            filepath = fileParamItr->filepath;
+        }
 
         if (!DeleteAsset(soundName, AssetType::SOUNDFX))
         {
@@ -914,7 +1443,7 @@ namespace Feather {
             return;
         }
 
-        if (!AddSoundFx(soundName, fileParamItr->filepath))
+        if (!AddSoundFx(soundName, filepath))
         {
             F_ERROR("Failed to reload SoundFx: {}", soundName);
             return;
@@ -925,15 +1454,20 @@ namespace Feather {
 
     void AssetManager::ReloadMusic(const std::string& musicName)
     {
-        auto fileParamItr = std::ranges::find_if(m_FilewatchParams, [&](const auto& param) { return param.assetName == musicName; });
-
-        if (fileParamItr == m_FilewatchParams.end())
+        // Copied since deleting the asset erases its watch params
+        std::string filepath{};
         {
-            F_ERROR("Trying to music that has not been loaded?");
-            return;
-        }
+            std::lock_guard lock{ m_AssetMutex };
+            auto fileParamItr = std::ranges::find_if(m_FilewatchParams, [&](const auto& param) { return param.assetName == musicName; });
 
-        fileParamItr->lastWrite = fs::last_write_time(fs::path{ fileParamItr->filepath });
+            if (fileParamItr == m_FilewatchParams.end())
+            {
+                F_ERROR("Trying to music that has not been loaded?");
+                return;
+            }
+
+            filepath = fileParamItr->filepath;
+        }
 
         if (!DeleteAsset(musicName, AssetType::MUSIC))
         {
@@ -941,7 +1475,7 @@ namespace Feather {
             return;
         }
 
-        if (!AddMusic(musicName, fileParamItr->filepath))
+        if (!AddMusic(musicName, filepath))
         {
             F_ERROR("Failed to reload SoundFx: {}", musicName);
             return;
@@ -952,31 +1486,32 @@ namespace Feather {
 
     void AssetManager::ReloadFont(const std::string& fontName)
     {
-        auto fileParamItr = std::ranges::find_if(m_FilewatchParams, [&](const auto& param) { return param.assetName == fontName; });
-
-        if (fileParamItr == m_FilewatchParams.end())
+        // Copied so the lock is not held while the font loads
+        std::string filepath{};
         {
-            F_ERROR("Trying to music that has not been loaded?");
-            return;
-        }
-
-        fileParamItr->lastWrite = fs::last_write_time(fs::path{ fileParamItr->filepath });
+            std::lock_guard lock{ m_AssetMutex };
+            auto fileParamItr = std::ranges::find_if(m_FilewatchParams, [&](const auto& param) { return param.assetName == fontName; });
 
-        auto& pFont = m_mapFonts[fontName];
-        float fontSize = pFont->GetFontSize();
+            if (fileParamItr == m_FilewatchParams.end())
+            {
+                F_ERROR("Trying to music that has not been loaded?");
+                return;
+            }
 
-        if (!DeleteAsset(fontName, AssetType::FONT))
-        {
-            F_ERROR("Failed to reload SoundFx: {}", fontName);
-            return;
+            filepath = fileParamItr->filepath;
         }
 
-        if (!AddFont(fontName, fileParamItr->filepath, fontSize))
+        auto& pFont = m_mapFonts[fontName];
+        // Replaced in place so handles to the font stay valid
+        auto pNewFont = FontLoader::Create(filepath, pFont->GetFontSize());
+        if (!pNewFont)
         {
-            F_ERROR("Failed to reload SoundFx: {}", fontName);
+            F_ERROR("Failed to reload Font: {}", fontName);
             return;
         }
 
+        pFont = std::move(pNewFont);
+
         F_TRACE("Reloaded Font: {}", fontName);
     }
 
@@ -1,5 +1,12 @@
 #pragma once
 
+#include "Core/Resources/AssetPack.h"
+#include "Core/Resources/AssetHandle.h"
+#include "Renderer/Essentials/TextureLoader.h"
+#include "Utils/JobSystem.h"
+#include "FileSystem/Utilities/DirectoryWatcher.h"
+
+#include <deque>
 #include <sol/sol.hpp>
 #include <SDL_mixer.h>
 
@@ -10,7 +17,6 @@ namespace Feather {
 	enum class AssetType;
 
 	class Prefab;
-	class Texture;
 	class Shader;
 	class Font;
 	class Music;
@@ -31,13 +37,23 @@ namespace Feather {
 		std::vector<std::string> GetTilesetNames() const;
 
 		bool AddFont(const std::string& fontName, const std::string& fontPath, float fontSize = 32.0f);
-		bool AddFontFromMemory(const std::string& fontName, unsigned char* fontData, float fontSize = 32.0f);
+		bool AddFontFromMemory(const std::string& fontName, const unsigned char* fontData, float fontSize = 32.0f);
 		std::shared_ptr<Font> GetFont(const std::string& fontName);
 
 		bool AddShader(const std::string& shaderName, const std::string& vertexPath, const std::string& fragmentPath);
 		bool AddShaderFromMemory(const std::string& shaderName, const char* vertexShader, const char* fragmentShader);
 		std::shared_ptr<Shader> GetShader(const std::string& shaderName);
 
+		/*
+		* @brief Resolves the asset through the handle cached next to its name, used by the render loops every frame.
+		* A valid handle is checked against the name and resolved without any map lookup.
+		* A stale or default handle falls back to the Get function of the asset and is then updated.
+		* @return The asset's entry in the asset map, empty if it does not exist. Copy it to keep the asset past a reload or delete.
+		*/
+		const std::shared_ptr<Texture>& ResolveTexture(std::string_view textureName, AssetHandle<Texture>& handle);
+		const std::shared_ptr<Font>& ResolveFont(std::string_view fontName, AssetHandle<Font>& handle);
+		const std::shared_ptr<Shader>& ResolveShader(std::string_view shaderName, AssetHandle<Shader>& handle);
+
 		bool AddMusic(const std::string& musicName, const std::string& filepath);
 		bool AddMusicFromMemory(const std::string& musicName, const unsigned char* musicData, size_t dataSize);
 		std::shared_ptr<Music> GetMusic(const std::string& musicName);
@@ -76,20 +92,78 @@ namespace Feather {
 
 		static void CreateLuaAssetManager(sol::state& lua);
 
+		/*
+		* @brief Registers every asset in the pack without loading it.
+		* Packed assets are decoded and uploaded on first use.
+		*/
+		void AddAssetPack(std::shared_ptr<AssetPack> pAssetPack);
+
+		/*
+		* @brief Loads packed assets now instead of on first use. Used to preload the assets of a scene.
+		* Textures are loaded async, the other asset types are loaded before this returns.
+		*/
+		void PreloadAssets(const std::vector<std::string>& assetNames, AssetType assetType);
+
+		/*
+		* @brief Sets the memory budget in bytes for resident packed assets.
+		* Packed textures and sounds that have not been used recently are evicted when over budget.
+		* A budget of zero disables eviction.
+		*/
+		inline void SetMemoryBudget(size_t memoryBudget) { m_MemoryBudget = memoryBudget; }
+		inline size_t GetResidentMemory() const { return m_ResidentMemory; }
+
+		using TextureHandle = std::shared_future<std::shared_ptr<Texture>>;
+
+		/*
+		* @brief Decodes the texture on the job system and uploads it during Update within the upload budget.
+		* The handle becomes ready once the texture is uploaded, so it must not be waited on from the main thread.
+		* GetTexture finishes a pending load immediately if the texture is needed before then.
+		* Loads synchronously if no job system has been set.
+		*/
+		TextureHandle AddTextureAsync(const std::string& textureName, const std::string& texturePath, bool pixelArt = true, bool isTileset = false);
+
+		/*
+		* @brief Asynchronously loads a texture that was registered from an asset pack.
+		*/
+		TextureHandle LoadTextureAsync(const std::string& textureName);
+
+		/*
+		* @brief Returns the progress of the current batch of async loads from 0 to 1.
+		* Returns 1 when nothing is loading.
+		*/
+		float GetLoadProgress() const;
+		inline bool IsLoading() const { return !m_PendingTextures.empty(); }
+
+		inline void SetJobSystem(SharedJobSystem pJobSystem) { m_JobSystem = std::move(pJobSystem); }
+		/* @brief Sets the time in milliseconds Update may spend uploading async textures each frame */
+		inline void SetUploadBudget(double uploadBudgetMs) { m_UploadBudgetMs = uploadBudgetMs; }
+
+		/*
+		* @brief Finishes async loads and reloads any watched assets whose files have changed.
+		*/
 		void Update();
 
 	private:
-		void FileWatcher();
-
 		struct AssetWatchParams
 		{
 			std::string assetName{};
 			std::string filepath{};
+			/* Absolute, normalized path used to match the paths reported by the directory watchers */
+			std::filesystem::path watchPath{};
 			std::filesystem::file_time_type lastWrite;
 			AssetType type{};
 			bool isDirty{ false };
 		};
 
+		/*
+		* @brief Registers the file for hot reloading and watches its directory if it is not already watched.
+		*/
+		void WatchAssetFile(const std::string& assetName, const std::string& filepath, AssetType type);
+		/*
+		* @brief Called from the directory watcher threads. Marks the assets loaded from the path as dirty.
+		*/
+		void OnWatchedFileChanged(const std::filesystem::path& path, bool modified);
+
 		void ReloadAsset(const AssetWatchParams& assetParams);
 
 		void ReloadTexture(const std::string& textureName);
@@ -98,7 +172,52 @@ namespace Feather {
 		void ReloadFont(const std::string& fontName);
 		void ReloadShader(const std::string& shaderName);
 
+		struct PackedAsset
+		{
+			AssetPackView view{};
+			size_t residentSize{ 0 };
+			uint64_t lastUsedFrame{ 0 };
+			bool isResident{ false };
+		};
+
+		PackedAsset* FindPackedAsset(const std::string& assetName, AssetType assetType);
+		bool LoadPackedAsset(const std::string& assetName, AssetType assetType);
+		bool EvictPackedAsset(const std::string& assetName, PackedAsset& packedAsset);
+		void EvictPackedAssets();
+
+		struct PendingTexture
+		{
+			std::string textureName{};
+			std::string texturePath{};
+			/* Encoded data of a packed texture. Empty for textures loaded from a file */
+			const unsigned char* pData{ nullptr };
+			size_t dataSize{ 0 };
+			bool pixelArt{ true };
+			bool isTileset{ false };
+			/* Invalid until the decode has been submitted to the job system */
+			std::future<DecodedImage> decodeFuture;
+			std::promise<std::shared_ptr<Texture>> promise;
+			TextureHandle handle;
+		};
+
+		TextureHandle QueueTextureLoad(PendingTexture&& pendingTexture);
+		void SubmitTextureDecode(PendingTexture& pendingTexture);
+		std::shared_ptr<Texture> FinishTextureLoad(PendingTexture& pendingTexture);
+		void UpdateAsyncLoads();
+
+		inline void TouchPackedAsset(const std::string& assetName, AssetType assetType)
+		{
+			if (m_mapPackedAssets.empty())
+				return;
+
+			if (auto* pPackedAsset = FindPackedAsset(assetName, assetType))
+				pPackedAsset->lastUsedFrame = m_FrameIndex;
+		}
+
 	private:
+		/* Declared before the asset maps so packed assets that stream from memory are released before the packs are unmapped */
+		std::vector<std::shared_ptr<AssetPack>> m_AssetPacks;
+
 		std::map<std::string, std::shared_ptr<Texture>> m_mapTextures{};
 		std::map<std::string, std::shared_ptr<Shader>> m_mapShaders{};
 		std::map<std::string, std::shared_ptr<Font>> m_mapFonts{};
@@ -111,12 +230,34 @@ namespace Feather {
 		std::map<std::string, Cursor> m_mapCursors;
 #endif
 
+		/* Interned names of the assets that have been resolved through a handle */
+		AssetSlotArray<Texture> m_TextureSlots;
+		AssetSlotArray<Font> m_FontSlots;
+		AssetSlotArray<Shader> m_ShaderSlots;
+
 		std::vector<AssetWatchParams> m_FilewatchParams;
 
+		std::unordered_map<AssetType, std::unordered_map<std::string, PackedAsset>> m_mapPackedAssets;
+		size_t m_MemoryBudget{ 0 };
+		size_t m_ResidentMemory{ 0 };
+		uint64_t m_FrameIndex{ 0 };
+
+		/* Async loads in request order. Only the front MAX_IN_FLIGHT_DECODES are decoding at a time */
+		std::deque<PendingTexture> m_PendingTextures;
+		SharedJobSystem m_JobSystem{ nullptr };
+		double m_UploadBudgetMs{ 2.0 };
+		size_t m_NumAsyncRequested{ 0 };
+		size_t m_NumAsyncCompleted{ 0 };
+
+		static constexpr size_t MAX_IN_FLIGHT_DECODES = 8;
+
 		std::atomic<bool> m_FileWatcherRunning;
-		std::jthread m_WatchThread;
+		/* Set by the watcher threads when an asset has been marked dirty, lets Update skip the params otherwise */
+		std::atomic<bool> m_HasDirtyAssets{ false };
 		std::mutex m_CallbackMutex;
 		std::shared_mutex m_AssetMutex;
+		/* Recursive watchers keyed by their root directory. Declared last so their threads stop before anything else is destroyed */
+		std::map<std::string, std::unique_ptr<DirectoryWatcher>> m_mapDirectoryWatchers;
 	};
 
 }
@@ -0,0 +1,229 @@
+#include "AssetPack.h"
+
+#include "Logger/Logger.h"
+#include "Utils/FeatherUtilities.h"
+#include "Utils/JobSystem.h"
+
+#include <cstring>
+
+namespace Feather {
+
+	static uint64_t AlignPackOffset(uint64_t offset)
+	{
+		return (offset + ASSET_PACK_ALIGNMENT - 1) & ~(ASSET_PACK_ALIGNMENT - 1);
+	}
+
+	bool AssetPack::Open(const std::filesystem::path& packPath)
+	{
+		Close();
+
+		if (!m_File.Open(packPath))
+			return false;
+
+		const unsigned char* pData = m_File.GetData();
+		const size_t fileSize = m_File.GetSize();
+
+		if (fileSize < sizeof(AssetPackHeader))
+		{
+			F_ERROR("Failed to open asset pack '{}': File is too small", packPath.string());
+			Close();
+			return false;
+		}
+
+		AssetPackHeader header{};
+		std::memcpy(&header, pData, sizeof(AssetPackHeader));
+
+		if (header.magic != ASSET_PACK_MAGIC || header.version != ASSET_PACK_VERSION)
+		{
+			F_ERROR("Failed to open asset pack '{}': Invalid header or unsupported version '{}'", packPath.string(), header.version);
+			Close();
+			return false;
+		}
+
+		const uint64_t tocEnd = sizeof(AssetPackHeader) + static_cast<uint64_t>(header.numEntries) * sizeof(AssetPackEntry);
+		if (tocEnd > fileSize || header.namesOffset < tocEnd || header.namesOffset > fileSize ||
+			header.namesSize > fileSize - header.namesOffset)
+		{
+			F_ERROR("Failed to open asset pack '{}': Table of contents is out of bounds", packPath.string());
+			Close();
+			return false;
+		}
+
+		const char* pNames = reinterpret_cast<const char*>(pData + header.namesOffset);
+		m_Assets.reserve(header.numEntries);
+
+		for (uint32_t i = 0; i < header.numEntries; i++)
+		{
+			AssetPackEntry entry{};
+			std::memcpy(&entry, pData + sizeof(AssetPackHeader) + i * sizeof(AssetPackEntry), sizeof(AssetPackEntry));
+
+			// Checked without adding offset and size, which could overflow on a corrupt pack
+			if (entry.offset > fileSize || entry.size > fileSize - entry.offset ||
+				static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > header.namesSize)
+			{
+				F_ERROR("Failed to open asset pack '{}': Entry '{}' is out of bounds", packPath.string(), i);
+				Close();
+				return false;
+			}
+
+			m_Assets.emplace_back(
+				AssetPackView{
+					.name = std::string_view{ pNames + entry.nameOffset, entry.nameLength },
+					.type = static_cast<AssetType>(entry.type),
+					.flags = entry.flags,
+					.fontSize = entry.fontSize,
+					.data = pData + entry.offset,
+					.size = static_cast<size_t>(entry.size)
+				}
+			);
+		}
+
+		return true;
+	}
+
+	void AssetPack::Close()
+	{
+		m_Assets.clear();
+		m_File.Close();
+	}
+
+	void AssetPackWriter::AddAsset(const std::string& assetName, AssetType type, const std::filesystem::path& filepath, uint32_t flags, float fontSize)
+	{
+		m_Assets.emplace_back(
+			PendingAsset{ .name = assetName, .type = type, .filepath = filepath, .flags = flags, .fontSize = fontSize });
+	}
+
+	bool AssetPackWriter::Write(const std::filesystem::path& packPath, JobSystem* pJobSystem)
+	{
+		std::vector<AssetPackEntry> entries;
+		entries.reserve(m_Assets.size());
+
+		std::string names{};
+
+		for (const auto& asset : m_Assets)
+		{
+			std::error_code ec;
+			const auto fileSize = std::filesystem::file_size(asset.filepath, ec);
+			if (ec)
+			{
+				F_ERROR("Failed to add asset '{}' to pack: Unable to read '{}' - {}", asset.name, asset.filepath.string(), ec.message());
+				return false;
+			}
+
+			entries.emplace_back(
+				AssetPackEntry{
+					.size = fileSize,
+					.nameOffset = static_cast<uint32_t>(names.size()),
+					.nameLength = static_cast<uint32_t>(asset.name.size()),
+					.type = static_cast<uint32_t>(asset.type),
+					.flags = asset.flags,
+					.fontSize = asset.fontSize
+				}
+			);
+
+			names += asset.name;
+		}
+
+		AssetPackHeader header{};
+		header.numEntries = static_cast<uint32_t>(entries.size());
+		header.namesSize = static_cast<uint32_t>(names.size());
+		header.namesOffset = sizeof(AssetPackHeader) + entries.size() * sizeof(AssetPackEntry);
+		header.dataOffset = AlignPackOffset(header.namesOffset + header.namesSize);
+
+		uint64_t offset = header.dataOffset;
+		uint64_t packSize = header.dataOffset;
+		for (auto& entry : entries)
+		{
+			entry.offset = offset;
+			packSize = offset + entry.size;
+			offset = AlignPackOffset(packSize);
+		}
+
+		{
+			std::ofstream out{ packPath, std::ios::out | std::ios::binary | std::ios::trunc };
+			if (!out.is_open())
+			{
+				F_ERROR("Failed to write asset pack '{}': Unable to open file", packPath.string());
+				return false;
+			}
+
+			out.write(reinterpret_cast<const char*>(&header), sizeof(AssetPackHeader));
+			out.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(AssetPackEntry)));
+			out.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+			if (!out)
+			{
+				F_ERROR("Failed to write asset pack '{}'", packPath.string());
+				return false;
+			}
+		}
+
+		// Size the pack up front so every asset can be copied to its own offset. The padding is zero filled
+		std::error_code ec;
+		std::filesystem::resize_file(packPath, packSize, ec);
+		if (ec)
+		{
+			F_ERROR("Failed to write asset pack '{}': Unable to resize file - {}", packPath.string(), ec.message());
+			return false;
+		}
+
+		std::atomic_bool hasError{ false };
+
+		auto copyAssets = [&](size_t begin, size_t end) {
+			std::ofstream out{ packPath, std::ios::in | std::ios::out | std::ios::binary };
+			if (!out.is_open())
+			{
+				F_ERROR("Failed to write asset pack '{}': Unable to open file", packPath.string());
+				hasError = true;
+				return;
+			}
+
+			std::vector<char> buffer(1 << 16);
+
+			for (size_t i = begin; i < end && !hasError; i++)
+			{
+				std::ifstream in{ m_Assets[i].filepath, std::ios::in | std::ios::binary };
+				if (!in.is_open())
+				{
+					F_ERROR("Failed to write asset pack '{}': Unable to open '{}'", packPath.string(), m_Assets[i].filepath.string());
+					hasError = true;
+					return;
+				}
+
+				out.seekp(static_cast<std::streamoff>(entries[i].offset));
+
+				uint64_t remaining = entries[i].size;
+				while (remaining > 0)
+				{
+					const auto readSize = static_cast<std::streamsize>(std::min<uint64_t>(remaining, buffer.size()));
+					if (!in.read(buffer.data(), readSize))
+					{
+						F_ERROR("Failed to write asset pack '{}': Unable to read '{}'", packPath.string(), m_Assets[i].filepath.string());
+						hasError = true;
+						return;
+					}
+
+					out.write(buffer.data(), readSize);
+					remaining -= static_cast<uint64_t>(readSize);
+				}
+			}
+
+			if (!out)
+			{
+				F_ERROR("Failed to write asset pack '{}'", packPath.string());
+				hasError = true;
+			}
+		};
+
+		if (pJobSystem)
+			pJobSystem->ParallelFor(m_Assets.size(), 1, copyAssets);
+		else
+			copyAssets(0, m_Assets.size());
+
+		if (hasError)
+			return false;
+
+		return true;
+	}
+
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "FileSystem/Utilities/MappedFile.h"
+
+namespace Feather {
+
+	enum class AssetType;
+	class JobSystem;
+
+	/* 'FPAK' in little endian */
+	constexpr uint32_t ASSET_PACK_MAGIC = 0x4B415046;
+	constexpr uint32_t ASSET_PACK_VERSION = 1;
+	/* Every asset blob starts on this boundary */
+	constexpr uint64_t ASSET_PACK_ALIGNMENT = 16;
+
+	enum AssetPackFlags : uint32_t
+	{
+		ASSET_PACK_FLAG_NONE = 0,
+		ASSET_PACK_FLAG_PIXEL_ART = 1 << 0,
+	};
+
+	/*
+	* On disk layout of an asset pack:
+	* [AssetPackHeader][AssetPackEntry * numEntries][names][padding][aligned asset blobs]
+	*/
+	struct AssetPackHeader
+	{
+		uint32_t magic{ ASSET_PACK_MAGIC };
+		uint32_t version{ ASSET_PACK_VERSION };
+		uint32_t numEntries{ 0 };
+		uint32_t namesSize{ 0 };
+		uint64_t namesOffset{ 0 };
+		uint64_t dataOffset{ 0 };
+	};
+
+	struct AssetPackEntry
+	{
+		/* Offset of the asset data from the start of the file */
+		uint64_t offset{ 0 };
+		uint64_t size{ 0 };
+		/* Offset of the name in the names block */
+		uint32_t nameOffset{ 0 };
+		uint32_t nameLength{ 0 };
+		uint32_t type{ 0 };
+		uint32_t flags{ ASSET_PACK_FLAG_NONE };
+		float fontSize{ 0.0f };
+		uint32_t reserved{ 0 };
+	};
+
+	static_assert(sizeof(AssetPackHeader) == 32, "Asset pack header layout changed");
+	static_assert(sizeof(AssetPackEntry) == 40, "Asset pack entry layout changed");
+
+	/*
+	* View of an asset inside a mapped asset pack. The data is only valid while the pack is open.
+	*/
+	struct AssetPackView
+	{
+		std::string_view name{};
+		AssetType type{};
+		uint32_t flags{ ASSET_PACK_FLAG_NONE };
+		float fontSize{ 32.0f };
+		const unsigned char* data{ nullptr };
+		size_t size{ 0 };
+	};
+
+	/*
+	* Memory mapped asset pack. Asset data is handed out as views into the mapping, nothing is copied.
+	*/
+	class AssetPack
+	{
+	public:
+		AssetPack() = default;
+		~AssetPack() = default;
+
+		/*
+		* @brief Maps the pack and validates its header and table of contents.
+		* @return Returns true if the pack was opened successfully.
+		*/
+		bool Open(const std::filesystem::path& packPath);
+		void Close();
+
+		inline const std::vector<AssetPackView>& GetAssets() const { return m_Assets; }
+		inline size_t GetPackSize() const { return m_File.GetSize(); }
+		inline bool IsOpen() const { return m_File.IsOpen(); }
+
+	private:
+		MappedFile m_File;
+		std::vector<AssetPackView> m_Assets;
+	};
+
+	/*
+	* Builds an asset pack from files on disk. Files are streamed into the pack without loading them whole.
+	*/
+	class AssetPackWriter
+	{
+	public:
+		AssetPackWriter() = default;
+		~AssetPackWriter() = default;
+
+		void AddAsset(const std::string& assetName, AssetType type, const std::filesystem::path& filepath, uint32_t flags = ASSET_PACK_FLAG_NONE, float fontSize = 32.0f);
+
+		/*
+		* @brief Writes all added assets to the pack file.
+		* @param pJobSystem Optional job system, each asset is copied to its offset in the pack on its own job.
+		* @return Returns true if the pack was written successfully.
+		*/
+		bool Write(const std::filesystem::path& packPath, JobSystem* pJobSystem = nullptr);
+
+		inline size_t GetNumAssets() const { return m_Assets.size(); }
+
+	private:
+		struct PendingAsset
+		{
+			std::string name{};
+			AssetType type{};
+			std::filesystem::path filepath{};
+			uint32_t flags{ ASSET_PACK_FLAG_NONE };
+			float fontSize{ 32.0f };
+		};
+
+		std::vector<PendingAsset> m_Assets;
+	};
+
+}
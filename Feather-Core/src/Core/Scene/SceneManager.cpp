@@ -4,6 +4,9 @@
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/ECS/Registry.h"
 #include "Core/Loaders/TilemapLoader.h"
+#include "Core/Systems/ScriptingSystem.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/CoreUtils/CoreUtilities.h"
 #include "Utils/FeatherUtilities.h"
 
 namespace Feather {
@@ -135,6 +138,12 @@ namespace Feather {
 				tl.LoadTilemapFromLuaTable(registry, lua[sceneName + "_tilemap"]);
 				tl.LoadGameObjectsFromLuaTable(registry, lua[sceneName + "_objects"]);
 
+				PreloadSceneAssets(registry, MAIN_REGISTRY().GetAssetManager(), (*sceneManagerData)->defaultMusic);
+
+				// The old scene's objects are garbage now, collect them while the scene is switching
+				if (auto* scriptSystem = registry.TryGetContext<std::shared_ptr<ScriptingSystem>>())
+					(*scriptSystem)->RequestFullCollection();
+
 				return true;
 			},
 			"getCanvas", // Returns the canvas of the current scene or an empty canvas object
@@ -19,7 +19,9 @@ namespace Feather {
 		lua.new_usertype<ContactListener>(
 			"ContactListener",
 			sol::no_constructor,
-			"getUserData", [&](sol::this_state s) { return GetUserData(*contactListener, s); }
+			"getUserData", [&](sol::this_state s) { return GetUserData(*contactListener, s); },
+			"setContactFilter", [&](uint32_t filter) { contactListener->SetContactFilter(filter); },
+			"getContactFilter", [&] { return contactListener->GetContactFilter(); }
 		);
     }
 
@@ -0,0 +1,168 @@
+#include "LuaChunkCache.h"
+
+#include "Logger/Logger.h"
+
+namespace Feather {
+
+	namespace {
+
+		/* Table in the lua registry that maps script paths to their content hash and compiled chunk */
+		constexpr const char* CHUNK_CACHE_KEY = "FeatherChunkCache";
+		constexpr const char* CHUNK_HASH_KEY = "hash";
+		constexpr const char* CHUNK_FUNCTION_KEY = "chunk";
+
+		struct CachedBytecode
+		{
+			size_t contentHash{ 0 };
+			std::string bytecode{};
+		};
+
+		std::mutex g_BytecodeMutex;
+		std::unordered_map<std::string, CachedBytecode> g_mapScriptBytecode;
+
+		bool ReadFile(const std::string& path, std::string& outContents)
+		{
+			std::ifstream file{ path, std::ios::binary };
+			if (!file.is_open())
+				return false;
+
+			outContents.assign(std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{});
+			return true;
+		}
+
+		/* Drops the bytecode of a script that was deleted, failed to compile or could not be loaded */
+		void EvictBytecode(const std::string& scriptPath)
+		{
+			std::lock_guard lock{ g_BytecodeMutex };
+			g_mapScriptBytecode.erase(scriptPath);
+		}
+
+		int WriteBytecode(lua_State* L, const void* data, size_t size, void* userData)
+		{
+			static_cast<std::string*>(userData)->append(static_cast<const char*>(data), size);
+			return 0;
+		}
+
+	}
+
+	sol::protected_function LuaChunkCache::Load(sol::state_view lua, const std::string& scriptPath, std::string& error)
+	{
+		std::string contents{};
+		if (!ReadFile(scriptPath, contents))
+		{
+			EvictBytecode(scriptPath);
+			error = std::format("Failed to open script '{}'", scriptPath);
+			return sol::protected_function{};
+		}
+
+		const size_t contentHash = std::hash<std::string>{}(contents);
+		const auto hashKey = static_cast<lua_Integer>(contentHash);
+
+		sol::table registry = lua.registry();
+		sol::optional<sol::table> optChunkCache = registry[CHUNK_CACHE_KEY];
+		if (!optChunkCache)
+		{
+			registry[CHUNK_CACHE_KEY] = lua.create_table();
+			optChunkCache = registry[CHUNK_CACHE_KEY];
+		}
+
+		// One entry per path, the chunk name is the path and an edited script replaces its old chunk
+		sol::table chunkCache = *optChunkCache;
+		if (sol::optional<sol::table> optEntry = chunkCache.raw_get<sol::optional<sol::table>>(scriptPath))
+		{
+			sol::table entry = *optEntry;
+			if (entry.raw_get_or<lua_Integer>(CHUNK_HASH_KEY, 0) == hashKey)
+			{
+				if (sol::optional<sol::protected_function> optChunk = entry.raw_get<sol::optional<sol::protected_function>>(CHUNK_FUNCTION_KEY))
+					return *optChunk;
+			}
+		}
+
+		auto cacheChunk = [&](const sol::protected_function& chunk) {
+			chunkCache.raw_set(scriptPath, lua.create_table_with(CHUNK_HASH_KEY, hashKey, CHUNK_FUNCTION_KEY, chunk));
+		};
+
+		const std::string chunkName = "@" + scriptPath;
+
+		// Compiled by another lua state, loading the bytecode skips the parser
+		std::string bytecode{};
+		{
+			std::lock_guard lock{ g_BytecodeMutex };
+			if (auto bytecodeItr = g_mapScriptBytecode.find(scriptPath);
+				bytecodeItr != g_mapScriptBytecode.end() && bytecodeItr->second.contentHash == contentHash)
+			{
+				bytecode = bytecodeItr->second.bytecode;
+			}
+		}
+
+		if (!bytecode.empty())
+		{
+			auto loadResult = lua.load_buffer(bytecode.data(), bytecode.size(), chunkName, sol::load_mode::binary);
+			if (loadResult.valid())
+			{
+				sol::protected_function chunk = loadResult;
+				cacheChunk(chunk);
+				return chunk;
+			}
+
+			EvictBytecode(scriptPath);
+		}
+
+		auto loadResult = lua.load_buffer(contents.data(), contents.size(), chunkName);
+		if (!loadResult.valid())
+		{
+			EvictBytecode(scriptPath);
+			sol::error loadError = loadResult;
+			error = loadError.what();
+			return sol::protected_function{};
+		}
+
+		sol::protected_function chunk = loadResult;
+		cacheChunk(chunk);
+
+		if (std::string compiled = DumpBytecode(chunk); !compiled.empty())
+		{
+			std::lock_guard lock{ g_BytecodeMutex };
+			g_mapScriptBytecode.insert_or_assign(scriptPath, CachedBytecode{ .contentHash = contentHash, .bytecode = std::move(compiled) });
+		}
+
+		return chunk;
+	}
+
+	sol::protected_function_result LuaChunkCache::RunFile(sol::state_view lua, const std::string& scriptPath)
+	{
+		std::string error{};
+		auto chunk = Load(lua, scriptPath, error);
+		if (!chunk.valid())
+			throw sol::error{ error };
+
+		auto result = chunk();
+		if (!result.valid())
+		{
+			sol::error runError = result;
+			throw runError;
+		}
+
+		return result;
+	}
+
+	std::string LuaChunkCache::DumpBytecode(const sol::protected_function& function)
+	{
+		lua_State* L = function.lua_state();
+		function.push(L);
+
+		std::string bytecode{};
+		if (!lua_isfunction(L, -1) || lua_iscfunction(L, -1) || lua_dump(L, &WriteBytecode, &bytecode, 0) != 0)
+			bytecode.clear();
+
+		lua_pop(L, 1);
+		return bytecode;
+	}
+
+	void LuaChunkCache::Clear()
+	{
+		std::lock_guard lock{ g_BytecodeMutex };
+		g_mapScriptBytecode.clear();
+	}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <sol/sol.hpp>
+
+namespace Feather {
+
+	/*
+	* @brief Keeps compiled script chunks so running a script again does not parse it again.
+	* Each lua state keeps one compiled function per script path in its registry, with the hash of the contents it was
+	* compiled from. An edited script is compiled again on its next run and replaces the old function. The bytecode is also kept for the whole process,
+	* one entry per script path, so a new lua state, like the one created when entering Play mode or loading a scene, loads it instead of parsing
+	* the source. A script that is deleted or no longer compiles drops its bytecode.
+	*/
+	class LuaChunkCache
+	{
+	public:
+		/*
+		* @brief Returns the compiled chunk of the script without running it.
+		* @return Returns an invalid function and sets the error if the file could not be read or compiled.
+		*/
+		static sol::protected_function Load(sol::state_view lua, const std::string& scriptPath, std::string& error);
+
+		/*
+		* @brief Runs the script through the cache. Behaves like sol::state::safe_script_file and throws a sol::error if
+		* the script could not be loaded or failed to run.
+		*/
+		static sol::protected_function_result RunFile(sol::state_view lua, const std::string& scriptPath);
+
+		/*
+		* @brief Dumps the compiled function as Lua bytecode, keeping the debug information.
+		* @return Returns an empty string if the function is not a Lua function.
+		*/
+		static std::string DumpBytecode(const sol::protected_function& function);
+
+		/*
+		* @brief Frees the bytecode kept for the process. Functions already cached by a lua state stay until the state is closed.
+		*/
+		static void Clear();
+	};
+
+}
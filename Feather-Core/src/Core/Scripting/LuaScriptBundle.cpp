@@ -0,0 +1,181 @@
+#include "LuaScriptBundle.h"
+
+#include "LuaChunkCache.h"
+#include "Logger/Logger.h"
+
+namespace Feather {
+
+	namespace {
+
+		constexpr std::array<char, 4> BUNDLE_MAGIC{ 'F', 'L', 'B', 'C' };
+		constexpr uint32_t BUNDLE_VERSION = 1;
+
+		void WriteUInt(std::ofstream& file, uint32_t value)
+		{
+			file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+
+		bool ReadUInt(std::ifstream& file, uint32_t& value)
+		{
+			return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(value)));
+		}
+
+		bool ReadString(std::ifstream& file, std::string& value)
+		{
+			uint32_t size{ 0 };
+			if (!ReadUInt(file, size))
+				return false;
+
+			value.resize(size);
+			return static_cast<bool>(file.read(value.data(), size));
+		}
+
+	}
+
+	LuaScriptBundle::LuaScriptBundle()
+		: m_Chunks{}
+		, m_pCompiler{ nullptr }
+	{}
+
+	bool LuaScriptBundle::AddScript(const std::string& scriptPath)
+	{
+		std::ifstream file{ scriptPath, std::ios::binary };
+		if (!file.is_open())
+		{
+			F_ERROR("Failed to add script '{}' to bundle. File could not be opened", scriptPath);
+			return false;
+		}
+
+		std::string source{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+
+		// Only keep the file name, the packaged game should not show the paths of the machine it was built on
+		const std::string chunkName = "@" + std::filesystem::path{ scriptPath }.filename().string();
+
+		if (!m_pCompiler)
+			m_pCompiler = std::make_unique<sol::state>();
+
+		auto loadResult = m_pCompiler->load_buffer(source.data(), source.size(), chunkName);
+		if (!loadResult.valid())
+		{
+			sol::error error = loadResult;
+			F_ERROR("Failed to compile script '{}': {}", scriptPath, error.what());
+			return false;
+		}
+
+		sol::protected_function chunk = loadResult;
+		std::string bytecode = LuaChunkCache::DumpBytecode(chunk);
+		if (bytecode.empty())
+		{
+			F_ERROR("Failed to dump the bytecode of script '{}'", scriptPath);
+			return false;
+		}
+
+		m_Chunks.push_back(Chunk{ .name = chunkName, .bytecode = std::move(bytecode) });
+		return true;
+	}
+
+	bool LuaScriptBundle::Save(const std::string& bundlePath) const
+	{
+		std::ofstream file{ bundlePath, std::ios::binary | std::ios::trunc };
+		if (!file.is_open())
+		{
+			F_ERROR("Failed to save script bundle '{}'. File could not be opened", bundlePath);
+			return false;
+		}
+
+		file.write(BUNDLE_MAGIC.data(), BUNDLE_MAGIC.size());
+		WriteUInt(file, BUNDLE_VERSION);
+		WriteUInt(file, static_cast<uint32_t>(m_Chunks.size()));
+
+		for (const auto& chunk : m_Chunks)
+		{
+			WriteUInt(file, static_cast<uint32_t>(chunk.name.size()));
+			file.write(chunk.name.data(), chunk.name.size());
+			WriteUInt(file, static_cast<uint32_t>(chunk.bytecode.size()));
+			file.write(chunk.bytecode.data(), chunk.bytecode.size());
+		}
+
+		return static_cast<bool>(file);
+	}
+
+	bool LuaScriptBundle::Load(const std::string& bundlePath)
+	{
+		std::ifstream file{ bundlePath, std::ios::binary };
+		if (!file.is_open())
+		{
+			F_ERROR("Failed to load script bundle '{}'. File could not be opened", bundlePath);
+			return false;
+		}
+
+		std::array<char, 4> magic{};
+		uint32_t version{ 0 }, numChunks{ 0 };
+		if (!file.read(magic.data(), magic.size()) || magic != BUNDLE_MAGIC || !ReadUInt(file, version) || !ReadUInt(file, numChunks))
+		{
+			F_ERROR("Failed to load script bundle '{}'. File is not a script bundle", bundlePath);
+			return false;
+		}
+
+		if (version != BUNDLE_VERSION)
+		{
+			F_ERROR("Failed to load script bundle '{}'. Version {} is not supported", bundlePath, version);
+			return false;
+		}
+
+		std::vector<Chunk> chunks(numChunks);
+		for (auto& chunk : chunks)
+		{
+			if (!ReadString(file, chunk.name) || !ReadString(file, chunk.bytecode))
+			{
+				F_ERROR("Failed to load script bundle '{}'. File is truncated", bundlePath);
+				return false;
+			}
+		}
+
+		m_Chunks = std::move(chunks);
+		return true;
+	}
+
+	void LuaScriptBundle::Run(sol::state_view lua) const
+	{
+		for (const auto& chunk : m_Chunks)
+		{
+			auto loadResult = lua.load_buffer(chunk.bytecode.data(), chunk.bytecode.size(), chunk.name, sol::load_mode::binary);
+			if (!loadResult.valid())
+			{
+				sol::error error = loadResult;
+				throw sol::error{ std::format("Failed to load chunk '{}': {}", chunk.name, error.what()) };
+			}
+
+			sol::protected_function function = loadResult;
+			auto result = function();
+			if (!result.valid())
+			{
+				sol::error error = result;
+				throw error;
+			}
+		}
+	}
+
+	bool LuaScriptBundle::IsBundle(const std::string& path)
+	{
+		std::ifstream file{ path, std::ios::binary };
+		std::array<char, 4> magic{};
+		return file.is_open() && file.read(magic.data(), magic.size()) && magic == BUNDLE_MAGIC;
+	}
+
+	void LuaScriptBundle::RunFile(sol::state_view lua, const std::string& path)
+	{
+		if (!IsBundle(path))
+		{
+			LuaChunkCache::RunFile(lua, path);
+			return;
+		}
+
+		LuaScriptBundle bundle{};
+		if (!bundle.Load(path))
+			throw sol::error{ std::format("Failed to load script bundle '{}'", path) };
+
+		bundle.Run(lua);
+	}
+
+}
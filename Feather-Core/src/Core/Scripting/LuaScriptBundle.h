@@ -0,0 +1,56 @@
+#pragma once
+
+#include <sol/sol.hpp>
+
+namespace Feather {
+
+	/*
+	* @brief Scripts compiled to Lua bytecode in process and stored together in a single file.
+	* Built when the game is packaged and run by the runtime without parsing any source.
+	* File layout: magic, version and number of chunks, followed by the length prefixed name and bytecode of each chunk.
+	*/
+	class LuaScriptBundle
+	{
+	public:
+		LuaScriptBundle();
+		~LuaScriptBundle() = default;
+
+		/*
+		* @brief Compiles the script and appends its bytecode to the bundle.
+		* @return Returns false if the script could not be read or does not compile.
+		*/
+		bool AddScript(const std::string& scriptPath);
+
+		bool Save(const std::string& bundlePath) const;
+		bool Load(const std::string& bundlePath);
+
+		/*
+		* @brief Runs the chunks in the order they were added, the same as running each script in turn.
+		* Throws a sol::error if a chunk fails to load or run.
+		*/
+		void Run(sol::state_view lua) const;
+
+		inline size_t GetNumChunks() const { return m_Chunks.size(); }
+		inline void Clear() { m_Chunks.clear(); }
+
+		static bool IsBundle(const std::string& path);
+
+		/*
+		* @brief Runs the bundle at the path, or the script through the LuaChunkCache if the file is not a bundle.
+		* Throws a sol::error like sol::state::safe_script_file.
+		*/
+		static void RunFile(sol::state_view lua, const std::string& path);
+
+	private:
+		struct Chunk
+		{
+			std::string name{};
+			std::string bytecode{};
+		};
+
+		std::vector<Chunk> m_Chunks;
+		/* Created by the first AddScript, only used to compile so no libraries are opened */
+		std::unique_ptr<sol::state> m_pCompiler;
+	};
+
+}
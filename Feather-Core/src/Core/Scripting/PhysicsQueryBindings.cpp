@@ -0,0 +1,97 @@
+#include "PhysicsQueryBindings.h"
+
+#include "Physics/PhysicsQueries.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Utils/JobSystem.h"
+#include "Logger/Logger.h"
+
+namespace Feather {
+
+	namespace {
+
+		/* Lua indices start at 1 */
+		inline size_t ToQueryIndex(size_t luaIndex) { return luaIndex > 0 ? luaIndex - 1 : std::numeric_limits<size_t>::max(); }
+
+	}
+
+	void PhysicsQueryBinder::CreateLuaPhysicsQueryBind(sol::state& lua, entt::registry& registry)
+	{
+		lua.new_enum<EPhysicsQueryType>("PhysicsQueryType",
+			{
+				{ "RayCast", EPhysicsQueryType::RayCast },
+				{ "Overlap", EPhysicsQueryType::Overlap },
+				{ "CircleCast", EPhysicsQueryType::CircleCast },
+			});
+
+		auto execute = [&registry](PhysicsQueryBatch& batch, bool parallel) {
+			auto* pPhysicsWorld = registry.ctx().find<PhysicsWorld>();
+			if (!pPhysicsWorld || !*pPhysicsWorld)
+			{
+				F_ERROR("Failed to execute physics queries - Physics world is not in the registry!");
+				return;
+			}
+
+			JobSystem* pJobSystem{ nullptr };
+			if (parallel)
+			{
+				if (auto* pSharedJobSystem = MAIN_REGISTRY().GetRegistry()->TryGetContext<SharedJobSystem>())
+					pJobSystem = pSharedJobSystem->get();
+			}
+
+			batch.Execute(**pPhysicsWorld, pJobSystem);
+		};
+
+		// Results are read with plain return values so reading many hits does not create tables
+		lua.new_usertype<PhysicsQueryBatch>(
+			"PhysicsQueryBatch",
+			sol::call_constructor,
+			sol::constructors<PhysicsQueryBatch()>(),
+			"addRayCast",
+			[](PhysicsQueryBatch& batch, const glm::vec2& start, const glm::vec2& end) { return batch.AddRayCast(start, end) + 1; },
+			"addOverlap",
+			[](PhysicsQueryBatch& batch, const glm::vec2& lowerBounds, const glm::vec2& upperBounds) {
+				return batch.AddOverlap(lowerBounds, upperBounds) + 1;
+			},
+			"addCircleCast",
+			[](PhysicsQueryBatch& batch, const glm::vec2& start, const glm::vec2& end, float radius) {
+				return batch.AddCircleCast(start, end, radius) + 1;
+			},
+			"execute",
+			sol::overload(
+				[execute](PhysicsQueryBatch& batch) { execute(batch, false); },
+				[execute](PhysicsQueryBatch& batch, bool parallel) { execute(batch, parallel); }),
+			"clear",
+			&PhysicsQueryBatch::Clear,
+			"numQueries",
+			&PhysicsQueryBatch::GetNumQueries,
+			"numHits",
+			[](const PhysicsQueryBatch& batch, size_t query) { return batch.GetNumHits(ToQueryIndex(query)); },
+			"isHit",
+			[](const PhysicsQueryBatch& batch, size_t query) { return batch.GetNumHits(ToQueryIndex(query)) > 0; },
+			"hitEntity",
+			[](const PhysicsQueryBatch& batch, size_t query, sol::optional<size_t> hit, sol::this_state s) {
+				const auto* pHit = batch.GetHit(ToQueryIndex(query), ToQueryIndex(hit.value_or(1)));
+				return pHit ? sol::make_object(s, pHit->entityID) : sol::lua_nil_t{};
+			},
+			"getHit",
+			[](const PhysicsQueryBatch& batch, size_t query, sol::optional<size_t> hit, sol::this_state s) {
+				// Returns entityID, x, y, normalX, normalY, fraction or nil
+				sol::variadic_results results;
+				const auto* pHit = batch.GetHit(ToQueryIndex(query), ToQueryIndex(hit.value_or(1)));
+				if (!pHit)
+				{
+					results.push_back(sol::lua_nil_t{});
+					return results;
+				}
+
+				results.push_back(sol::make_object(s, pHit->entityID));
+				results.push_back(sol::make_object(s, pHit->point.x));
+				results.push_back(sol::make_object(s, pHit->point.y));
+				results.push_back(sol::make_object(s, pHit->normal.x));
+				results.push_back(sol::make_object(s, pHit->normal.y));
+				results.push_back(sol::make_object(s, pHit->fraction));
+				return results;
+			});
+	}
+
+}
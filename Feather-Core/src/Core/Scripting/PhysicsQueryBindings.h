@@ -0,0 +1,14 @@
+#pragma once
+
+#include <sol/sol.hpp>
+#include <entt.hpp>
+
+namespace Feather {
+
+	class PhysicsQueryBinder
+	{
+	public:
+		static void CreateLuaPhysicsQueryBind(sol::state& lua, entt::registry& registry);
+	};
+
+}
@@ -2,59 +2,213 @@
 
 #include "Logger/Logger.h"
 #include "Core/ECS/Registry.h"
-#include "Core/CoreUtils/CoreUtilities.h"
-
-#include <SDL.h>
+#include "Core/ECS/Components/AllComponents.h"
+#include "Core/CoreUtils/CoreEngineData.h"
 
 namespace Feather {
 
-	void AnimationSystem::Update(Registry& registry, Camera2D& camera)
+	namespace {
+
+		/* Time of the tiles playing a clip, indexed by the clip */
+		struct TileClipClock
+		{
+			float frameTime{ 0.0f };
+			int frame{ 0 };
+		};
+
+		/* Kept in the registry's context, the scene and the runtime registries animate their tiles separately */
+		struct TileAnimationClocks
+		{
+			std::vector<TileClipClock> clocks;
+		};
+
+		template <typename T>
+		void HashCombine(size_t& seed, const T& value)
+		{
+			seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		}
+
+		/* Moves the frame forward by the elapsed time, only multiplies unless the frame changes */
+		void AdvanceFrame(int& frame, float& frameTime, float deltaTime, int numFrames, int frameRate, bool isLooped)
+		{
+			if (!isLooped && frame >= numFrames - 1)
+				return;
+
+			frameTime += deltaTime;
+			int steps = static_cast<int>(frameTime * frameRate);
+			if (steps <= 0)
+				return;
+
+			frameTime -= static_cast<float>(steps) / frameRate;
+			frame += steps;
+
+			if (frame >= numFrames)
+				frame = isLooped ? frame % numFrames : numFrames - 1;
+		}
+
+	}
+
+	bool AnimationClip::Matches(const AnimationComponent& animation) const
 	{
-		auto view = registry.GetRegistry().view<AnimationComponent, SpriteComponent, TransformComponent>();
-		if (view.size_hint() < 1)
-			return;
+		return frames.size() == static_cast<size_t>(animation.numFrames) && frameRate == animation.frameRate &&
+			   isVertical == animation.isVertical && isLooped == animation.isLooped;
+	}
+
+	bool AnimationClip::Matches(const AnimationComponent& animation, const SpriteComponent& sprite) const
+	{
+		return Matches(animation) && startX == sprite.start_x && startY == sprite.start_y &&
+			   uvWidth == sprite.uvs.uv_width && uvHeight == sprite.uvs.uv_height;
+	}
+
+	void AnimationSystem::Update(Registry& registry, double deltaTime)
+	{
+		auto& reg = registry.GetRegistry();
+		m_NumUpdated = 0;
 
+		float scaledDelta = m_Paused ? 0.0f : static_cast<float>(deltaTime) * m_TimeScale;
+
+		auto view = reg.view<AnimationComponent, SpriteComponent>(entt::exclude<TileComponent>);
 		for (auto entity : view)
 		{
-			const auto& transform = view.get<TransformComponent>(entity);
-			auto& sprite = view.get<SpriteComponent>(entity);
 			auto& animation = view.get<AnimationComponent>(entity);
-
-			if (!registry.GetRegistry().all_of<UIComponent>(entity) && !EntityInView(transform, sprite.width, sprite.height, camera))
-				continue;
-
 			if (animation.numFrames <= 0)
 				continue;
-			if (!animation.isLooped && animation.currentFrame >= animation.numFrames - 1)
-				continue;
 
-			animation.currentFrame = ((SDL_GetTicks() - animation.startTime) * animation.frameRate / 1000) % animation.numFrames;
+			if (scaledDelta > 0.0f && animation.frameRate > 0)
+			{
+				AdvanceFrame(animation.currentFrame, animation.frameTime, scaledDelta,
+							 animation.numFrames, animation.frameRate, animation.isLooped);
+			}
 
-			if (animation.isVertical)
+			if (animation.currentFrame != animation.appliedFrame)
+				ApplyFrame(animation, view.get<SpriteComponent>(entity), animation.currentFrame);
+		}
+
+		auto tileView = reg.view<AnimationComponent, SpriteComponent, TileComponent>();
+		if (tileView.size_hint() < 1)
+			return;
+
+		auto* pTileClocks = reg.ctx().find<TileAnimationClocks>();
+		if (!pTileClocks)
+			pTileClocks = &reg.ctx().emplace<TileAnimationClocks>();
+
+		auto& clocks = pTileClocks->clocks;
+		clocks.resize(m_Clips.size());
+
+		// One step per clip instead of one per tile
+		if (scaledDelta > 0.0f)
+		{
+			for (size_t i = 0; i < clocks.size(); i++)
 			{
-				sprite.uvs.v = (animation.currentFrame + sprite.start_y) * sprite.uvs.uv_height;
-				sprite.uvs.u = sprite.start_x * sprite.uvs.uv_width;
+				const auto& clip = m_Clips[i];
+				if (clip.frameRate > 0)
+				{
+					AdvanceFrame(clocks[i].frame, clocks[i].frameTime, scaledDelta,
+								 static_cast<int>(clip.frames.size()), clip.frameRate, clip.isLooped);
+				}
 			}
-			else
+		}
+
+		for (auto entity : tileView)
+		{
+			auto& animation = tileView.get<AnimationComponent>(entity);
+			if (animation.numFrames <= 0)
+				continue;
+
+			// Resolve the clip against the sprite before its clock is read, so a tile given a different sheet
+			// takes the frame of its new clip and ApplyFrame does not switch clips after the frame was picked
+			auto& sprite = tileView.get<SpriteComponent>(entity);
+			if (animation.clipIndex >= clocks.size() || !m_Clips[animation.clipIndex].Matches(animation, sprite))
 			{
-				sprite.uvs.u = (animation.currentFrame + sprite.start_x) * sprite.uvs.uv_width;
-				sprite.uvs.v = sprite.start_y * sprite.uvs.uv_height;
+				animation.clipIndex = AcquireClip(animation, sprite);
+				animation.appliedFrame = -1;
+				clocks.resize(m_Clips.size());
 			}
+
+			animation.currentFrame = clocks[animation.clipIndex].frame;
+			if (animation.currentFrame != animation.appliedFrame)
+				ApplyFrame(animation, sprite, animation.currentFrame);
+		}
+	}
+
+	uint32_t AnimationSystem::AcquireClip(const AnimationComponent& animation, const SpriteComponent& sprite)
+	{
+		size_t hash{ 0 };
+		HashCombine(hash, animation.numFrames);
+		HashCombine(hash, animation.frameRate);
+		HashCombine(hash, animation.isVertical);
+		HashCombine(hash, animation.isLooped);
+		HashCombine(hash, sprite.start_x);
+		HashCombine(hash, sprite.start_y);
+		HashCombine(hash, sprite.uvs.uv_width);
+		HashCombine(hash, sprite.uvs.uv_height);
+
+		auto& clipIndices = m_mapClipIndices[hash];
+		for (uint32_t index : clipIndices)
+		{
+			if (m_Clips[index].Matches(animation, sprite))
+				return index;
+		}
+
+		AnimationClip clip{ .frameRate = animation.frameRate,
+							.startX = sprite.start_x,
+							.startY = sprite.start_y,
+							.uvWidth = sprite.uvs.uv_width,
+							.uvHeight = sprite.uvs.uv_height,
+							.isVertical = animation.isVertical,
+							.isLooped = animation.isLooped };
+
+		clip.frames.reserve(animation.numFrames);
+		for (int frame = 0; frame < animation.numFrames; frame++)
+		{
+			if (animation.isVertical)
+				clip.frames.push_back(AnimationClip::Frame{ .u = sprite.start_x * sprite.uvs.uv_width, .v = (frame + sprite.start_y) * sprite.uvs.uv_height });
+			else
+				clip.frames.push_back(AnimationClip::Frame{ .u = (frame + sprite.start_x) * sprite.uvs.uv_width, .v = sprite.start_y * sprite.uvs.uv_height });
 		}
+
+		uint32_t index = static_cast<uint32_t>(m_Clips.size());
+		m_Clips.push_back(std::move(clip));
+		clipIndices.push_back(index);
+
+		return index;
 	}
 
-	void AnimationSystem::CreateAnimationSystemLuaBind(sol::state& lua, Registry& registry)
+	void AnimationSystem::ApplyFrame(AnimationComponent& animation, SpriteComponent& sprite, int frame)
 	{
-		auto& camera = registry.GetContext<std::shared_ptr<Camera2D>>();
+		// The sprite may have been given a different sheet since the clip was resolved
+		if (animation.clipIndex >= m_Clips.size() || !m_Clips[animation.clipIndex].Matches(animation, sprite))
+			animation.clipIndex = AcquireClip(animation, sprite);
+
+		const auto& frames = m_Clips[animation.clipIndex].frames;
+		const auto& uvs = frames[std::clamp(frame, 0, static_cast<int>(frames.size()) - 1)];
 
-		F_ASSERT(camera && "A camera must exist in the current scene!");
+		sprite.uvs.u = uvs.u;
+		sprite.uvs.v = uvs.v;
+		animation.appliedFrame = frame;
+		++m_NumUpdated;
+	}
 
+	void AnimationSystem::CreateAnimationSystemLuaBind(sol::state& lua)
+	{
 		lua.new_usertype<AnimationSystem>(
 			"AnimationSystem",
 			sol::call_constructor,
 			sol::constructors<AnimationSystem()>(),
 			"update",
-			[&](AnimationSystem& system, Registry& reg) { system.Update(reg, *camera); }
+			[](AnimationSystem& system, Registry& reg) { system.Update(reg, CoreEngineData::GetInstance().GetDeltaTime()); },
+			"pause",
+			&AnimationSystem::Pause,
+			"resume",
+			&AnimationSystem::Resume,
+			"isPaused",
+			&AnimationSystem::IsPaused,
+			"setTimeScale",
+			&AnimationSystem::SetTimeScale,
+			"timeScale",
+			&AnimationSystem::GetTimeScale,
+			"numUpdated",
+			&AnimationSystem::GetNumUpdated
 		);
 	}
 
@@ -5,17 +5,80 @@
 namespace Feather {
 
 	class Registry;
-	class Camera2D;
+	struct AnimationComponent;
+	struct SpriteComponent;
 
+	/*
+	* @brief Precomputed UVs of every frame of a sprite sheet animation, shared by all the entities that play it.
+	* Clips are identified by the animation settings and the sprite's start cell and UV size, so entities using the same
+	* strip of the same sheet at the same rate resolve to the same clip.
+	*/
+	struct AnimationClip
+	{
+		struct Frame
+		{
+			float u{ 0.0f };
+			float v{ 0.0f };
+		};
+
+		std::vector<Frame> frames;
+		int frameRate{ 0 };
+		int startX{ 0 };
+		int startY{ 0 };
+		float uvWidth{ 0.0f };
+		float uvHeight{ 0.0f };
+		bool isVertical{ false };
+		bool isLooped{ false };
+
+		/* @brief Cheap check against the animation. Sprites are compared when a frame is written, tiles before their clip clock is read. */
+		bool Matches(const AnimationComponent& animation) const;
+		bool Matches(const AnimationComponent& animation, const SpriteComponent& sprite) const;
+	};
+
+	/*
+	* @brief Advances the sprite sheet animations by the engine's delta time.
+	* The UVs of the frames come from shared clips, and a sprite is only written when its frame changes.
+	* Tiles do not keep their own time, every tile playing the same clip follows one clock stored in the registry,
+	* so a tilemap's animated cells stay in step and are rewritten together.
+	*/
 	class AnimationSystem
 	{
 	public:
 		AnimationSystem() = default;
 		~AnimationSystem() = default;
 
-		void Update(Registry& registry, Camera2D& camera);
+		/*
+		* @brief Advances the animations of the registry.
+		* @param deltaTime Seconds since the last update, scaled by the time scale. Nothing advances while paused.
+		*/
+		void Update(Registry& registry, double deltaTime);
+
+		inline void Pause() { m_Paused = true; }
+		inline void Resume() { m_Paused = false; }
+		inline bool IsPaused() const { return m_Paused; }
+
+		inline void SetTimeScale(float timeScale) { m_TimeScale = std::max(timeScale, 0.0f); }
+		inline float GetTimeScale() const { return m_TimeScale; }
+
+		inline size_t GetNumClips() const { return m_Clips.size(); }
+		/* @brief Number of sprites whose frame was written in the last update. */
+		inline size_t GetNumUpdated() const { return m_NumUpdated; }
+
+		static void CreateAnimationSystemLuaBind(sol::state& lua);
+
+	private:
+		/*
+		* @brief Returns the clip matching the animation and the sprite, building its frames if no entity used it yet.
+		*/
+		uint32_t AcquireClip(const AnimationComponent& animation, const SpriteComponent& sprite);
+		void ApplyFrame(AnimationComponent& animation, SpriteComponent& sprite, int frame);
 
-		static void CreateAnimationSystemLuaBind(sol::state& lua, Registry& registry);
+	private:
+		std::vector<AnimationClip> m_Clips;
+		std::unordered_map<size_t, std::vector<uint32_t>> m_mapClipIndices;
+		float m_TimeScale{ 1.0f };
+		size_t m_NumUpdated{ 0 };
+		bool m_Paused{ false };
 	};
 
 }
@@ -7,12 +7,151 @@
 #include "Core/ECS/Components/PhysicsComponent.h"
 #include "Core/ECS/Registry.h"
 #include "Core/CoreUtils/CoreEngineData.h"
+#include "Core/CoreUtils/CoreUtilities.h"
+#include "Core/Events/EventDispatcher.h"
+#include "Core/Events/EngineEventTypes.h"
+#include "Physics/ContactListener.h"
 
 namespace Feather {
 
+	namespace {
+
+		/* Most steps taken in one frame. Frames that need more drop the extra time and the simulation slows down */
+		constexpr int MAX_PHYSICS_STEPS = 5;
+		/* Longest frame that is simulated, keeps hitches such as loading or a breakpoint from being caught up on */
+		constexpr double MAX_PHYSICS_FRAME_TIME = 0.25;
+
+		const ObjectData* GetObjectData(entt::registry& registry, std::uint32_t entityID)
+		{
+			auto entity = static_cast<entt::entity>(entityID);
+			if (!registry.valid(entity))
+				return nullptr;
+
+			auto* pPhysics = registry.try_get<PhysicsComponent>(entity);
+			if (!pPhysics || !pPhysics->GetUserData())
+				return nullptr;
+
+			return std::any_cast<ObjectData>(&pPhysics->GetUserData()->userData);
+		}
+
+		b2Vec2 Interpolate(const b2Vec2& previous, const b2Vec2& current, float alpha)
+		{
+			return previous + alpha * (current - previous);
+		}
+
+	}
+
 	PhysicsSystem::PhysicsSystem()
+		: m_Accumulator{ 0.0 }
+		, m_Alpha{ 1.0f }
 	{}
 
+	int PhysicsSystem::Step(Registry& registry, double deltaTime)
+	{
+		auto& physicsWorld = registry.GetContext<PhysicsWorld>();
+		if (!physicsWorld)
+			return 0;
+
+		auto* pContactListener = registry.TryGetContext<std::shared_ptr<ContactListener>>();
+		auto* pDispatch = registry.TryGetContext<std::shared_ptr<EventDispatcher>>();
+		ContactListener* contactListener = pContactListener ? pContactListener->get() : nullptr;
+		EventDispatcher* dispatch = pDispatch ? pDispatch->get() : nullptr;
+
+		// Only record the contact types somebody listens to
+		if (contactListener)
+		{
+			uint32_t recordFilter{ CONTACT_FILTER_NONE };
+			if (dispatch && dispatch->HasHandlers<ContactBatchEvent>())
+				recordFilter |= contactListener->GetContactFilter();
+			if (dispatch && dispatch->HasHandlers<ContactEvent>())
+				recordFilter |= static_cast<uint32_t>(EContactType::Begin);
+
+			contactListener->SetRecordFilter(recordFilter);
+		}
+
+		auto& coreEngine = CoreEngineData::GetInstance();
+		m_Accumulator += std::clamp(deltaTime, 0.0, MAX_PHYSICS_FRAME_TIME);
+
+		int numSteps{ 0 };
+		while (m_Accumulator >= TARGET_FRAME_TIME && numSteps < MAX_PHYSICS_STEPS)
+		{
+			SavePreviousTransforms(registry);
+
+			physicsWorld->Step(TARGET_FRAME_TIME_F, coreEngine.GetVelocityIterations(), coreEngine.GetPositionIterations());
+			physicsWorld->ClearForces();
+
+			m_Accumulator -= TARGET_FRAME_TIME;
+			++numSteps;
+		}
+
+		// Hit the step limit, keep only the partial step so the next frames do not keep falling behind
+		if (m_Accumulator >= TARGET_FRAME_TIME)
+			m_Accumulator = std::fmod(m_Accumulator, TARGET_FRAME_TIME);
+
+		m_Alpha = static_cast<float>(m_Accumulator / TARGET_FRAME_TIME);
+
+		if (contactListener && dispatch)
+			DispatchContactEvents(registry, *contactListener, *dispatch);
+
+		return numSteps;
+	}
+
+	void PhysicsSystem::Reset()
+	{
+		m_Accumulator = 0.0;
+		m_Alpha = 1.0f;
+	}
+
+	void PhysicsSystem::SavePreviousTransforms(Registry& registry)
+	{
+		auto physicsView = registry.GetRegistry().view<PhysicsComponent>();
+		for (auto entity : physicsView)
+		{
+			physicsView.get<PhysicsComponent>(entity).SavePreviousTransform();
+		}
+	}
+
+	void PhysicsSystem::DispatchContactEvents(Registry& registry, ContactListener& contactListener, EventDispatcher& dispatch)
+	{
+		// Handlers may destroy bodies, which ends their contacts and records them in the listener.
+		// Dispatching from our own buffer keeps those for the next frame instead of growing the buffer being read
+		m_DispatchContacts.clear();
+		m_DispatchContacts.swap(contactListener.GetContacts());
+
+		if (m_DispatchContacts.empty())
+			return;
+
+		if (dispatch.HasHandlers<ContactEvent>())
+		{
+			auto& enttRegistry = registry.GetRegistry();
+			for (const auto& contact : m_DispatchContacts)
+			{
+				if (contact.type != EContactType::Begin)
+					continue;
+
+				const auto* pObjectA = GetObjectData(enttRegistry, contact.entityA);
+				const auto* pObjectB = GetObjectData(enttRegistry, contact.entityB);
+				if (pObjectA && pObjectB)
+					dispatch.EmitEvent(ContactEvent{ .objectA = *pObjectA, .objectB = *pObjectB });
+			}
+		}
+
+		if (dispatch.HasHandlers<ContactBatchEvent>())
+		{
+			// Begin contacts may only have been recorded for the ContactEvent handlers
+			uint32_t contactFilter = contactListener.GetContactFilter();
+			if ((contactListener.GetRecordFilter() & ~contactFilter) != 0)
+			{
+				std::erase_if(m_DispatchContacts, [contactFilter](const ContactRecord& contact) {
+					return (static_cast<uint32_t>(contact.type) & contactFilter) == 0;
+				});
+			}
+
+			if (!m_DispatchContacts.empty())
+				dispatch.EmitEvent(ContactBatchEvent{ .contacts = &m_DispatchContacts });
+		}
+	}
+
 	void PhysicsSystem::Update(Registry& registry)
 	{
 		auto boxView = registry.GetRegistry().view<PhysicsComponent, TransformComponent, BoxColliderComponent>();
@@ -37,12 +176,12 @@ namespace Feather {
 			auto& transform = boxView.get<TransformComponent>(entity);
 			auto& boxCollider = boxView.get<BoxColliderComponent>(entity);
 
-			const auto& bodyPosition = RigidBody->GetPosition();
+			b2Vec2 bodyPosition = Interpolate(physics.GetPreviousPosition(), RigidBody->GetPosition(), m_Alpha);
 
 			transform.position.x = (scaledWidth + bodyPosition.x) * M2P - (boxCollider.width * transform.scale.x) / 2.0f - boxCollider.offset.x;
 			transform.position.y = (scaledHeight + bodyPosition.y) * M2P - (boxCollider.height * transform.scale.y) / 2.0f - boxCollider.offset.y;
 			if (!RigidBody->IsFixedRotation())
-				transform.rotation = glm::degrees(RigidBody->GetAngle());
+				transform.rotation = glm::degrees(glm::mix(physics.GetPreviousAngle(), RigidBody->GetAngle(), m_Alpha));
 		}
 
 		auto circleView = registry.GetRegistry().view<PhysicsComponent, TransformComponent, CircleColliderComponent>();
@@ -60,12 +199,12 @@ namespace Feather {
 			auto& transform = circleView.get<TransformComponent>(entity);
 			auto& circleCollider = circleView.get<CircleColliderComponent>(entity);
 
-			const auto& bodyPosition = RigidBody->GetPosition();
+			b2Vec2 bodyPosition = Interpolate(physics.GetPreviousPosition(), RigidBody->GetPosition(), m_Alpha);
 
 			transform.position.x = (scaledWidth + bodyPosition.x) * M2P - (circleCollider.radius * transform.scale.x) - circleCollider.offset.x;
 			transform.position.y = (scaledHeight + bodyPosition.y) * M2P - (circleCollider.radius * transform.scale.y) - circleCollider.offset.y;
 			if (!RigidBody->IsFixedRotation())
-				transform.rotation = glm::degrees(RigidBody->GetAngle());
+				transform.rotation = glm::degrees(glm::mix(physics.GetPreviousAngle(), RigidBody->GetAngle(), m_Alpha));
 		}
 	}
 
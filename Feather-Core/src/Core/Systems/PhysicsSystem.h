@@ -1,16 +1,55 @@
 #pragma once
 
+#include "Physics/ContactListener.h"
+
 namespace Feather {
 
 	class Registry;
+	class EventDispatcher;
 
+	/*
+	* @brief Steps the physics world at a fixed rate and writes the body transforms to the entities.
+	* Frame time is accumulated and consumed in steps of TARGET_FRAME_TIME_F, so the simulation runs at the same
+	* speed whatever the frame rate. Transforms are interpolated between the last two steps for rendering.
+	*/
 	class PhysicsSystem
 	{
 	public:
 		PhysicsSystem();
 		~PhysicsSystem() = default;
 
+		/*
+		* @brief Advances the physics world of the registry by the frame's delta time in fixed steps.
+		* The contacts of all steps are dispatched once afterwards, as a ContactBatchEvent and a ContactEvent
+		* for each contact that began.
+		* @param registry Registry that holds the physics world, contact listener and event dispatcher.
+		* @param deltaTime Time in seconds since the last frame.
+		* @return The number of steps taken this frame.
+		*/
+		int Step(Registry& registry, double deltaTime);
+
+		/*
+		* @brief Writes the body transforms, interpolated between the last two steps, to the transform components.
+		*/
 		void Update(Registry& registry);
+
+		/*
+		* @brief Discards the accumulated time. Call when a simulation starts.
+		*/
+		void Reset();
+
+		/* @brief How far the current frame is between the last two steps, from 0 to 1. */
+		inline float GetInterpolationAlpha() const { return m_Alpha; }
+
+	private:
+		void SavePreviousTransforms(Registry& registry);
+		void DispatchContactEvents(Registry& registry, ContactListener& contactListener, EventDispatcher& dispatch);
+
+	private:
+		/* Contacts being dispatched, swapped with the contact listener's buffer every frame */
+		std::vector<ContactRecord> m_DispatchContacts;
+		double m_Accumulator;
+		float m_Alpha;
 	};
 
 }
@@ -4,6 +4,7 @@
 #include "Core/Resources/AssetManager.h"
 #include "Core/ECS/Components/SpriteComponent.h"
 #include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/WorldTransformComponent.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/CoreUtils/CoreUtilities.h"
 #include "Core/CoreUtils/CoreEngineData.h"
@@ -26,7 +27,7 @@ namespace Feather {
 		auto& mainRegistry = MAIN_REGISTRY();
 		auto& assetManager = mainRegistry.GetAssetManager();
 
-		const auto pickingShader = assetManager.GetShader("picking");
+		const auto& pickingShader = assetManager.ResolveShader("picking", m_PickingShaderHandle);
 		auto cam_mat = camera.GetCameraMatrix();
 
 		if (!pickingShader)
@@ -40,11 +41,12 @@ namespace Feather {
 		pickingShader->SetUniformMat4("uProjection", cam_mat);
 
 		m_BatchRenderer->Begin();
-		auto spriteView = registry.GetRegistry().view<SpriteComponent, TransformComponent>(entt::exclude<TileComponent>);
+		auto& reg = registry.GetRegistry();
+		auto spriteView = reg.view<SpriteComponent, TransformComponent>(entt::exclude<TileComponent>);
 		for (auto entity : spriteView)
 		{
 			const auto& transform = spriteView.get<TransformComponent>(entity);
-			const auto& sprite = spriteView.get<SpriteComponent>(entity);
+			auto& sprite = spriteView.get<SpriteComponent>(entity);
 
 			if (!EntityInView(transform, sprite.width, sprite.height, camera))
 				continue;
@@ -52,7 +54,7 @@ namespace Feather {
 			if (sprite.textureName.empty() || sprite.isHidden)
 				continue;
 
-			auto texture = assetManager.GetTexture(sprite.textureName);
+			const auto& texture = assetManager.ResolveTexture(sprite.textureName, sprite.textureHandle);
 			if (!texture)
 			{
 				F_ERROR("Texture '{0}' was not created correctly!", sprite.textureName);
@@ -61,7 +63,7 @@ namespace Feather {
 
 			glm::vec4 spriteRect{ transform.position.x, transform.position.y, sprite.width, sprite.height };
 			glm::vec4 uvRect{ sprite.uvs.u, sprite.uvs.v, sprite.uvs.uv_width, sprite.uvs.uv_height };
-			glm::mat4 model = TRSModel(transform, sprite.width, sprite.height);
+			glm::mat4 model = WorldModel(transform, reg.try_get<WorldTransformComponent>(entity), sprite.width, sprite.height);
 
 			m_BatchRenderer->AddSprite(spriteRect, uvRect, texture->GetID(), sprite.layer, static_cast<uint32_t>(entity), sprite.color, model);
 		}
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "Core/Resources/AssetHandle.h"
+
 namespace Feather {
 
 	class Camera2D;
 	class PickingBatchRenderer;
 	class Registry;
+	class Shader;
 
 	class RenderPickingSystem
 	{
@@ -16,6 +19,7 @@ namespace Feather {
 
 	private:
 		std::unique_ptr<PickingBatchRenderer> m_BatchRenderer;
+		AssetHandle<Shader> m_PickingShaderHandle{};
 	};
 
 }
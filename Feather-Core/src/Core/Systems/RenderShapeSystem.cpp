@@ -25,7 +25,7 @@ namespace Feather {
 		auto& assetManager = MAIN_REGISTRY().GetAssetManager();
 
 		// Box
-		auto colorShader = assetManager.GetShader("color");
+		const auto& colorShader = assetManager.ResolveShader("color", m_ColorShaderHandle);
 		auto cam_mat = camera.GetCameraMatrix();
 
 		colorShader->Enable();
@@ -90,7 +90,7 @@ namespace Feather {
 		colorShader->Disable();
 
 		// Circle
-		auto circleShader = assetManager.GetShader("circle");
+		const auto& circleShader = assetManager.ResolveShader("circle", m_CircleShaderHandle);
 
 		circleShader->Enable();
 		circleShader->SetUniformMat4("uProjection", cam_mat);
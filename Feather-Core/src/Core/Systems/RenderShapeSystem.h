@@ -1,11 +1,14 @@
 #pragma once
 
+#include "Core/Resources/AssetHandle.h"
+
 namespace Feather {
 
 	class Camera2D;
 	class RectBatchRenderer;
 	class CircleBatchRenderer;
 	class Registry;
+	class Shader;
 
 	class RenderShapeSystem
 	{
@@ -18,6 +21,8 @@ namespace Feather {
 	private:
 		std::unique_ptr<Feather::RectBatchRenderer> m_RectRenderer;
 		std::unique_ptr<Feather::CircleBatchRenderer> m_CircleRenderer;
+		AssetHandle<Shader> m_ColorShaderHandle{};
+		AssetHandle<Shader> m_CircleShaderHandle{};
 	};
 
 }
@@ -5,6 +5,8 @@
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/CoreUtils/CoreUtilities.h"
+#include "Core/Tilemap/Tilemap.h"
+#include "Core/Systems/SpriteExtractor.h"
 #include "Renderer/Core/Camera2D.h"
 #include "Renderer/Core/BatchRenderer.h"
 #include "Renderer/Essentials/Shader.h"
@@ -15,6 +17,7 @@ namespace Feather {
 
 	RenderSystem::RenderSystem()
 		: m_BatchRenderer{ std::make_unique<SpriteBatchRenderer>() }
+		, m_SpriteExtractor{ std::make_unique<SpriteExtractor>() }
 	{}
 
 	RenderSystem::~RenderSystem() = default;
@@ -24,10 +27,10 @@ namespace Feather {
 		auto& mainRegistry = MAIN_REGISTRY();
 		auto& assetManager = mainRegistry.GetAssetManager();
 
-		auto spriteShader = assetManager.GetShader("basic");
+		const auto& spriteShader = assetManager.ResolveShader("basic", m_SpriteShaderHandle);
 		auto cam_mat = camera.GetCameraMatrix();
 
-		if (spriteShader->ShaderProgramID() == 0)
+		if (!spriteShader || spriteShader->ShaderProgramID() == 0)
 		{
 			F_ERROR("Sprite shader program has not been set correctly!");
 			return;
@@ -39,47 +42,11 @@ namespace Feather {
 
 		m_BatchRenderer->Begin();
 
-		auto spriteView = registry.GetRegistry().view<SpriteComponent, TransformComponent>(entt::exclude<UIComponent>);
+		m_SpriteExtractor->Extract(registry, camera, assetManager, *m_BatchRenderer);
 
-		for (const auto& entity : spriteView)
-		{
-			const auto& transform = spriteView.get<TransformComponent>(entity);
-			const auto& sprite = spriteView.get<SpriteComponent>(entity);
-
-			if (!EntityInView(transform, sprite.width, sprite.height, camera))
-				continue;
-
-			if (sprite.textureName.empty() || sprite.isHidden)
-				continue;
-
-			const auto& pTexture = assetManager.GetTexture(sprite.textureName);
-			if (!pTexture)
-			{
-				F_ERROR("Texture '{0}' was not created correctly!", sprite.textureName);
-				return;
-			}
-
-			glm::vec4 spriteRect{ transform.position.x, transform.position.y, sprite.width, sprite.height };
-			glm::vec4 uvRect{ sprite.uvs.u, sprite.uvs.v, sprite.uvs.uv_width, sprite.uvs.uv_height };
-
-			glm::mat4 model = TRSModel(transform, sprite.width, sprite.height);
-
-			if (sprite.isIsometric)
-			{
-				m_BatchRenderer->AddSpriteIso(spriteRect,
-					uvRect,
-					pTexture->GetID(),
-					sprite.isoCellX,
-					sprite.isoCellY,
-					sprite.layer,
-					model,
-					sprite.color);
-			}
-			else
-			{
-				m_BatchRenderer->AddSprite(spriteRect, uvRect, pTexture->GetID(), sprite.layer, model, sprite.color);
-			}
-		}
+		// Static tiles are drawn from their prebuilt chunks
+		if (auto* pTilemap = registry.TryGetContext<std::shared_ptr<Tilemap>>(); pTilemap && *pTilemap)
+			(*pTilemap)->AddVisibleTiles(*m_BatchRenderer, camera, assetManager);
 
 		m_BatchRenderer->End();
 		m_BatchRenderer->Render();
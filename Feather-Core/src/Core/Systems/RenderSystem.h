@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Core/Resources/AssetHandle.h"
+
 #include <sol/sol.hpp>
 
 namespace Feather {
@@ -7,6 +9,8 @@ namespace Feather {
 	class Registry;
 	class Camera2D;
 	class SpriteBatchRenderer;
+	class SpriteExtractor;
+	class Shader;
 
 	class RenderSystem
 	{
@@ -17,8 +21,13 @@ namespace Feather {
 		void Update(Registry& registry, Camera2D& camera);
 		static void CreateRenderSystemLuaBind(sol::state& lua, Registry& registry);
 
+		inline const SpriteBatchRenderer& GetBatchRenderer() const { return *m_BatchRenderer; }
+		inline const SpriteExtractor& GetSpriteExtractor() const { return *m_SpriteExtractor; }
+
 	private:
 		std::unique_ptr<SpriteBatchRenderer> m_BatchRenderer;
+		std::unique_ptr<SpriteExtractor> m_SpriteExtractor;
+		AssetHandle<Shader> m_SpriteShaderHandle{};
 	};
 
 }
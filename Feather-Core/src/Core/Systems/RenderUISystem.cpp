@@ -36,7 +36,7 @@ namespace Feather {
 		auto& mainRegistry = MAIN_REGISTRY();
 		auto& assetManager = mainRegistry.GetAssetManager();
 
-		auto spriteShader = assetManager.GetShader("basic");
+		const auto& spriteShader = assetManager.ResolveShader("basic", m_SpriteShaderHandle);
 		if (!spriteShader)
 		{
 			F_ERROR("Failed to Render UI, basic shader is invalid");
@@ -55,12 +55,12 @@ namespace Feather {
 		for (auto entity : spriteView)
 		{
 			const auto& transform = spriteView.get<TransformComponent>(entity);
-			const auto& sprite = spriteView.get<SpriteComponent>(entity);
+			auto& sprite = spriteView.get<SpriteComponent>(entity);
 
 			if (sprite.textureName.empty() || sprite.isHidden)
 				continue;
 
-			const auto& pTexture = assetManager.GetTexture(sprite.textureName);
+			const auto& pTexture = assetManager.ResolveTexture(sprite.textureName, sprite.textureHandle);
 			if (!pTexture)
 			{
 				F_ERROR("Texture '{0}' was not created correctly!", sprite.textureName);
@@ -70,7 +70,7 @@ namespace Feather {
 			glm::vec4 spriteRect{ transform.position.x, transform.position.y, sprite.width, sprite.height };
 			glm::vec4 uvRect{ sprite.uvs.u, sprite.uvs.v, sprite.uvs.uv_width, sprite.uvs.uv_height };
 
-			glm::mat4 model = TRSModel(transform, sprite.width, sprite.height);
+			glm::mat4 model = WorldModel(transform, reg.try_get<WorldTransformComponent>(entity), sprite.width, sprite.height);
 
 			m_SpriteRenderer->AddSprite(spriteRect, uvRect, pTexture->GetID(), sprite.layer, model, sprite.color);
 		}
@@ -85,7 +85,7 @@ namespace Feather {
 		if (textView.size_hint() < 1)
 			return;
 
-		auto fontShader = assetManager.GetShader("font");
+		const auto& fontShader = assetManager.ResolveShader("font", m_FontShaderHandle);
 
 		if (!fontShader)
 		{
@@ -104,7 +104,7 @@ namespace Feather {
 			if (text.fontName.empty() || text.isHidden)
 				continue;
 
-			const auto& font = assetManager.GetFont(text.fontName);
+			const auto& font = assetManager.ResolveFont(text.fontName, text.fontHandle);
 			if (!font)
 			{
 				F_ERROR("Font '{}' does not exist in the asset manager!", text.fontName);
@@ -120,7 +120,7 @@ namespace Feather {
 				text.textBoxHeight = textHeight;
 			}
 
-			glm::mat4 model = TRSModel(transform, text.textBoxWidth, text.textBoxHeight);
+			glm::mat4 model = WorldModel(transform, reg.try_get<WorldTransformComponent>(entity), text.textBoxWidth, text.textBoxHeight);
 
 			m_TextRenderer->AddText(text.textStr, font, transform.position, text.padding, text.wrap, text.color, model);
 		}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/ECS/Registry.h"
+#include "Core/Resources/AssetHandle.h"
 
 #include <sol/sol.hpp>
 
@@ -9,6 +10,7 @@ namespace Feather {
 	class Camera2D;
 	class SpriteBatchRenderer;
 	class TextBatchRenderer;
+	class Shader;
 
 	class RenderUISystem
 	{
@@ -25,6 +27,8 @@ namespace Feather {
 		std::unique_ptr<SpriteBatchRenderer> m_SpriteRenderer;
 		std::unique_ptr<TextBatchRenderer> m_TextRenderer;
 		std::unique_ptr<Camera2D> m_Camera2D;
+		AssetHandle<Shader> m_SpriteShaderHandle{};
+		AssetHandle<Shader> m_FontShaderHandle{};
 	};
 
 }
@@ -4,6 +4,7 @@
 #include "Core/ECS/Entity.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/ECS/ECSUtils.h"
+#include "Core/ECS/RegistryQuery.h"
 
 #include "Core/Scripting/GlmLuaBindings.h"
 #include "Core/Scripting/InputManager.h"
@@ -11,8 +12,11 @@
 #include "Core/Scripting/RendererBindings.h"
 #include "Core/Scripting/UserDataBindings.h"
 #include "Core/Scripting/ContactListenerBindings.h"
+#include "Core/Scripting/PhysicsQueryBindings.h"
 #include "Core/Scripting/LuaFilesystemBindings.h"
 #include "Core/Scripting/ScriptingUtilities.h"
+#include "Core/Scripting/LuaChunkCache.h"
+#include "Core/Scripting/LuaScriptBundle.h"
 
 #include "Core/Resources/AssetManager.h"
 
@@ -30,6 +34,7 @@
 #include "Core/Systems/RenderSystem.h"
 #include "Core/Systems/RenderUISystem.h"
 #include "Core/Systems/AnimationSystem.h"
+#include "Core/Systems/TransformSystem.h"
 
 #include "Core/Scene/Scene.h"
 #include "Core/Character/Character.h"
@@ -47,6 +52,10 @@ namespace Feather {
 
 	ScriptingSystem::ScriptingSystem()
 		: m_MainLoaded{ false }
+		, m_FullCollectPending{ false }
+		, m_GCConfig{}
+		, m_GCStepTime{ 0.0 }
+		, m_LuaHeapSize{ 0 }
 	{}
 
 	bool ScriptingSystem::LoadMainScript(const std::string& mainLuaFile, Registry& registry, sol::state& lua)
@@ -60,7 +69,8 @@ namespace Feather {
 
 		try
 		{
-			auto result = lua.safe_script_file(mainLuaFile);
+			// The packaged game runs the compiled bundle, the editor the main script itself
+			LuaScriptBundle::RunFile(lua, mainLuaFile);
 		}
 		catch (const sol::error& e)
 		{
@@ -103,6 +113,7 @@ namespace Feather {
 		mainScript->update = update;
 		mainScript->render = render;
 
+		ApplyGCMode(lua);
 		m_MainLoaded = true;
 
 		return true;
@@ -140,12 +151,7 @@ namespace Feather {
 					try
 					{
 						std::filesystem::path scriptPath = *optContentPath / script.as<std::string>();
-						auto result = lua.safe_script_file(scriptPath.string());
-						if (!result.valid())
-						{
-							sol::error err = result;
-							throw err;
-						}
+						LuaChunkCache::RunFile(lua, scriptPath.string());
 					}
 					catch (const sol::error& error)
 					{
@@ -184,7 +190,7 @@ namespace Feather {
 		}
 
 		if (auto* lua = registry.TryGetContext<std::shared_ptr<sol::state>>())
-			(*lua)->collect_garbage();
+			StepGarbageCollector(**lua);
 	}
 
 	void ScriptingSystem::Render(Registry& registry)
@@ -202,9 +208,67 @@ namespace Feather {
 			sol::error err = error;
 			F_ERROR("Error running the Render script: {}", err.what());
 		}
+	}
 
-		if (auto* lua = registry.TryGetContext<std::shared_ptr<sol::state>>())
-			(*lua)->collect_garbage();
+	void ScriptingSystem::SetGCConfig(const LuaGCConfig& config, sol::state& lua)
+	{
+		m_GCConfig = config;
+		m_GCConfig.stepBudgetUs = std::max(m_GCConfig.stepBudgetUs, 0);
+		m_GCConfig.stepSizeKB = std::max(m_GCConfig.stepSizeKB, 0);
+		ApplyGCMode(lua);
+	}
+
+	void ScriptingSystem::RequestFullCollection()
+	{
+		if (m_GCConfig.fullCollectOnSceneChange)
+			m_FullCollectPending = true;
+	}
+
+	void ScriptingSystem::ApplyGCMode(sol::state& lua)
+	{
+		lua_State* L = lua.lua_state();
+
+		// Zero arguments keep Lua's default pause, multipliers and step sizes
+		if (m_GCConfig.mode == ELuaGCMode::Generational)
+			lua_gc(L, LUA_GCGEN, 0, 0);
+		else
+			lua_gc(L, LUA_GCINC, 0, 0, 0);
+
+		// Lua still collects automatically as the heap grows, the per frame steps only keep it ahead
+		lua_gc(L, LUA_GCRESTART);
+	}
+
+	void ScriptingSystem::StepGarbageCollector(sol::state& lua)
+	{
+		lua_State* L = lua.lua_state();
+		const auto start = std::chrono::steady_clock::now();
+
+		if (m_FullCollectPending)
+		{
+			lua_gc(L, LUA_GCCOLLECT);
+			m_FullCollectPending = false;
+		}
+		else if (m_GCConfig.stepBudgetUs > 0)
+		{
+			if (m_GCConfig.mode == ELuaGCMode::Generational)
+			{
+				// A step in generational mode is a full minor collection, one per frame is plenty
+				lua_gc(L, LUA_GCSTEP, 0);
+			}
+			else
+			{
+				const auto budget = std::chrono::microseconds{ m_GCConfig.stepBudgetUs };
+				// lua_gc returns 1 once a step finishes a collection cycle
+				while (lua_gc(L, LUA_GCSTEP, m_GCConfig.stepSizeKB) == 0)
+				{
+					if (std::chrono::steady_clock::now() - start >= budget)
+						break;
+				}
+			}
+		}
+
+		m_GCStepTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		m_LuaHeapSize = static_cast<size_t>(lua_gc(L, LUA_GCCOUNT)) * 1024 + static_cast<size_t>(lua_gc(L, LUA_GCCOUNTB));
 	}
 
 	auto create_timer = [](sol::state& lua){
@@ -415,6 +479,7 @@ namespace Feather {
 		StateMachine::CreateLuaStateMachineBind(lua);
 
 		Registry::CreateLuaRegistryBind(lua, registry);
+		RegistryQuery::CreateLuaQueryBind(lua);
 		Entity::CreateLuaEntityBind(lua, registry);
 		TransformComponent::CreateLuaTransformBind(lua);
 		SpriteComponent::CreateSpriteLuaBind(lua);
@@ -428,6 +493,7 @@ namespace Feather {
 		if (CORE_GLOBALS().IsPhysicsEnabled())
 		{
 			ContactListenerBinder::CreateLuaContactListener(lua, registry.GetRegistry());
+			PhysicsQueryBinder::CreateLuaPhysicsQueryBind(lua, registry.GetRegistry());
 			PhysicsComponent::CreatePhysicsLuaBind(lua, registry.GetRegistry());
 		}
 	}
@@ -441,7 +507,7 @@ namespace Feather {
 			{
 				try
 				{
-					lua.safe_script_file(path);
+					LuaChunkCache::RunFile(lua, path);
 				}
 				catch (const sol::error& error)
 				{
@@ -464,12 +530,7 @@ namespace Feather {
 			{
 				try
 				{
-					auto result = lua.safe_script_file(script.as<std::string>());
-					if (!result.valid())
-					{
-						sol::error error = result;
-						throw error;
-					}
+					LuaChunkCache::RunFile(lua, script.as<std::string>());
 				}
 				catch (const sol::error& error)
 				{
@@ -526,6 +587,14 @@ namespace Feather {
 		lua.set_function("F_EnableAnimationRendering", [&] { engine.EnableAnimationRender(); });
 		lua.set_function("F_AnimationRenderingEnabled", [&] { return engine.AnimationRenderEnabled(); });
 
+		// Animation playback functions
+		auto& animationSystem = mainRegistry.GetAnimationSystem();
+		lua.set_function("F_PauseAnimations", [&] { animationSystem.Pause(); });
+		lua.set_function("F_ResumeAnimations", [&] { animationSystem.Resume(); });
+		lua.set_function("F_AnimationsPaused", [&] { return animationSystem.IsPaused(); });
+		lua.set_function("F_SetAnimationTimeScale", [&](float timeScale) { animationSystem.SetTimeScale(timeScale); });
+		lua.set_function("F_AnimationTimeScale", [&] { return animationSystem.GetTimeScale(); });
+
 		lua.set_function("F_GetProjecPath", [&] { return engine.GetProjectPath(); });
 
 		lua.new_usertype<RandomIntGenerator>(
@@ -560,6 +629,7 @@ namespace Feather {
 
 		LuaEventBinder::CreateLuaEventBindings(lua);
 		EventDispatcher::RegisterMetaEventFuncs<ContactEvent>();
+		EventDispatcher::RegisterMetaEventFuncs<ContactBatchEvent>();
 		EventDispatcher::RegisterMetaEventFuncs<KeyEvent>();
 		EventDispatcher::RegisterMetaEventFuncs<LuaEvent>();
 		EventDispatcher::RegisterMetaEventFuncs<GamepadConnectEvent>();
@@ -570,7 +640,78 @@ namespace Feather {
 	{
 		RenderSystem::CreateRenderSystemLuaBind(lua, registry);
 		RenderUISystem::CreateRenderUISystemLuaBind(lua);
-		AnimationSystem::CreateAnimationSystemLuaBind(lua, registry);
+		AnimationSystem::CreateAnimationSystemLuaBind(lua);
+		TransformSystem::CreateTransformSystemLuaBind(lua);
+		CreateLuaGCBind(lua, registry);
+	}
+
+	void ScriptingSystem::CreateLuaGCBind(sol::state& lua, Registry& registry)
+	{
+		lua.new_enum<ELuaGCMode>("LuaGCMode",
+			{
+				{ "Incremental", ELuaGCMode::Incremental },
+				{ "Generational", ELuaGCMode::Generational }
+			}
+		);
+
+		auto getScriptSystem = [&registry]() -> ScriptingSystem* {
+			auto* scriptSystem = registry.TryGetContext<std::shared_ptr<ScriptingSystem>>();
+			if (!scriptSystem || !*scriptSystem)
+			{
+				F_ERROR("Scripting system was not added to the registry context");
+				return nullptr;
+			}
+
+			return scriptSystem->get();
+		};
+
+		lua.new_usertype<ScriptingSystem>(
+			"LuaGC",
+			sol::no_constructor,
+			"setMode",
+			[&lua, getScriptSystem](ELuaGCMode mode) {
+				if (auto* scriptSystem = getScriptSystem())
+				{
+					auto config = scriptSystem->GetGCConfig();
+					config.mode = mode;
+					scriptSystem->SetGCConfig(config, lua);
+				}
+			},
+			"setStepBudget",
+			[&lua, getScriptSystem](int budgetUs, sol::optional<int> stepSizeKB) {
+				if (auto* scriptSystem = getScriptSystem())
+				{
+					auto config = scriptSystem->GetGCConfig();
+					config.stepBudgetUs = budgetUs;
+					if (stepSizeKB)
+						config.stepSizeKB = *stepSizeKB;
+					scriptSystem->SetGCConfig(config, lua);
+				}
+			},
+			"setFullCollectOnSceneChange",
+			[&lua, getScriptSystem](bool enable) {
+				if (auto* scriptSystem = getScriptSystem())
+				{
+					auto config = scriptSystem->GetGCConfig();
+					config.fullCollectOnSceneChange = enable;
+					scriptSystem->SetGCConfig(config, lua);
+				}
+			},
+			"collect",
+			[getScriptSystem] {
+				if (auto* scriptSystem = getScriptSystem())
+					scriptSystem->m_FullCollectPending = true;
+			},
+			"getHeapSize", // Returns the size of the lua heap in KB
+			[&lua] {
+				return lua_gc(lua.lua_state(), LUA_GCCOUNT);
+			},
+			"getStepTime", // Returns the time spent collecting garbage last frame in milliseconds
+			[getScriptSystem] {
+				auto* scriptSystem = getScriptSystem();
+				return scriptSystem ? scriptSystem->GetGCStepTime() : 0.0;
+			}
+		);
 	}
 
 }
@@ -7,6 +7,23 @@ namespace Feather {
 	class Registry;
 	class ProjectInfo;
 
+	enum class ELuaGCMode
+	{
+		Incremental,
+		Generational
+	};
+
+	struct LuaGCConfig
+	{
+		ELuaGCMode mode{ ELuaGCMode::Incremental };
+		/* @brief Time allowed for garbage collection steps each frame. Zero leaves collection to Lua's automatic pacing. */
+		int stepBudgetUs{ 1000 };
+		/* @brief Amount of work, in KB, performed by each incremental step. */
+		int stepSizeKB{ 0 };
+		/* @brief Perform a full collection when the scene changes, instead of during gameplay. */
+		bool fullCollectOnSceneChange{ true };
+	};
+
 	class ScriptingSystem
 	{
 	public:
@@ -18,13 +35,39 @@ namespace Feather {
 		void Update(Registry& registry);
 		void Render(Registry& registry);
 
+		/*
+		* @brief Sets the garbage collector policy and applies it to the lua state.
+		*/
+		void SetGCConfig(const LuaGCConfig& config, sol::state& lua);
+
+		/*
+		* @brief Schedules a full collection for the next update. Used on scene changes, where a
+		* stop-the-world collection will not be noticed.
+		*/
+		void RequestFullCollection();
+
+		inline const LuaGCConfig& GetGCConfig() const { return m_GCConfig; }
+		inline double GetGCStepTime() const { return m_GCStepTime; }
+		inline size_t GetLuaHeapSize() const { return m_LuaHeapSize; }
+
 		static void RegisterLuaBindings(sol::state& lua, Registry& registry);
 		static void RegisterLuaFunctions(sol::state& lua, Registry& registry);
 		static void RegisterLuaEvents(sol::state& lua, Registry& registry);
 		static void RegisterLuaSystems(sol::state& lua, Registry& registry);
+		static void CreateLuaGCBind(sol::state& lua, Registry& registry);
+
+	private:
+		void ApplyGCMode(sol::state& lua);
+		void StepGarbageCollector(sol::state& lua);
 
 	private:
 		bool m_MainLoaded;
+		bool m_FullCollectPending;
+		LuaGCConfig m_GCConfig;
+		/* @brief Time spent in the garbage collector during the last frame, in milliseconds. */
+		double m_GCStepTime;
+		/* @brief Size of the lua heap in bytes, sampled after the last collection step. */
+		size_t m_LuaHeapSize;
 	};
 
 }
@@ -0,0 +1,120 @@
+#include "SpriteExtractor.h"
+
+#include "Logger/Logger.h"
+#include "Core/ECS/Components/AllComponents.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/CoreUtils/CoreUtilities.h"
+#include "Core/Resources/AssetManager.h"
+#include "Renderer/Core/BatchRenderer.h"
+#include "Renderer/Essentials/Texture.h"
+#include "Utils/JobSystem.h"
+
+namespace Feather {
+
+	/* Number of entities of the sprite view that are culled and transformed by one job */
+	constexpr size_t SPRITE_CHUNK_SIZE = 1024;
+
+	void SpriteExtractor::Extract(Registry& registry, const Camera2D& camera, AssetManager& assetManager,
+								  SpriteBatchRenderer& batchRenderer, const EntityFilter& filter)
+	{
+		auto extractStart = std::chrono::steady_clock::now();
+
+		auto spriteView = registry.GetRegistry().view<SpriteComponent, TransformComponent>(entt::exclude<UIComponent>);
+		// Const so looking up the cached world transforms from the workers never creates a storage
+		const auto& constRegistry = registry.GetRegistry();
+
+		// Index the leading storage of the view directly so the chunks can be split without walking the view first.
+		// Iterates in the same order as the view
+		const auto* pLeading = spriteView.handle();
+		size_t numEntities = pLeading ? static_cast<size_t>(pLeading->end(0) - pLeading->begin(0)) : 0;
+		if (numEntities == 0)
+		{
+			m_ExtractTime = 0.0f;
+			return;
+		}
+
+		auto first = pLeading->begin(0);
+		size_t numChunks = (numEntities + SPRITE_CHUNK_SIZE - 1) / SPRITE_CHUNK_SIZE;
+		if (m_Chunks.size() < numChunks)
+			m_Chunks.resize(numChunks);
+
+		auto extractRange = [&](size_t begin, size_t end) {
+			auto& chunk = m_Chunks[begin / SPRITE_CHUNK_SIZE];
+			chunk.glyphs.clear();
+			chunk.sprites.clear();
+
+			for (size_t i = begin; i < end; i++)
+			{
+				entt::entity entity = first[static_cast<std::ptrdiff_t>(i)];
+				if (!spriteView.contains(entity) || (filter && !filter(entity)))
+					continue;
+
+				const auto& transform = spriteView.get<TransformComponent>(entity);
+				auto& sprite = spriteView.get<SpriteComponent>(entity);
+
+				if (!EntityInView(transform, sprite.width, sprite.height, camera))
+					continue;
+
+				if (sprite.textureName.empty() || sprite.isHidden)
+					continue;
+
+				glm::vec4 spriteRect{ transform.position.x, transform.position.y, sprite.width, sprite.height };
+				glm::vec4 uvRect{ sprite.uvs.u, sprite.uvs.v, sprite.uvs.uv_width, sprite.uvs.uv_height };
+
+				glm::mat4 model = WorldModel(transform, constRegistry.try_get<WorldTransformComponent>(entity), sprite.width, sprite.height);
+
+				int layer = sprite.isIsometric
+					? SpriteBatchRenderer::GetIsoLayer(spriteRect, sprite.isoCellX, sprite.isoCellY, sprite.layer)
+					: sprite.layer;
+
+				// The texture ID is filled in during the merge, resolving textures is not thread safe
+				chunk.glyphs.emplace_back(SpriteBatchRenderer::CreateGlyph(spriteRect, uvRect, 0, layer, model, sprite.color));
+				chunk.sprites.push_back(&sprite);
+			}
+		};
+
+		auto* pJobSystem = MAIN_REGISTRY().GetRegistry()->TryGetContext<SharedJobSystem>();
+		if (numChunks > 1 && pJobSystem && *pJobSystem)
+		{
+			(*pJobSystem)->ParallelFor(numEntities, SPRITE_CHUNK_SIZE, extractRange);
+		}
+		else
+		{
+			for (size_t begin = 0; begin < numEntities; begin += SPRITE_CHUNK_SIZE)
+			{
+				extractRange(begin, std::min(begin + SPRITE_CHUNK_SIZE, numEntities));
+			}
+		}
+
+		// Merge in chunk order to keep the submission order of a serial pass
+		for (size_t c = 0; c < numChunks; c++)
+		{
+			auto& chunk = m_Chunks[c];
+			bool hasMissingTexture{ false };
+
+			for (size_t i = 0; i < chunk.glyphs.size(); i++)
+			{
+				// The cached handle skips the texture map, only new or renamed textures are looked up by name
+				auto& sprite = *chunk.sprites[i];
+				const auto& pTexture = assetManager.ResolveTexture(sprite.textureName, sprite.textureHandle);
+				GLuint textureID = pTexture ? pTexture->GetID() : 0;
+				chunk.glyphs[i].textureID = textureID;
+
+				if (textureID == 0)
+				{
+					hasMissingTexture = true;
+					if (m_MissingTextures.insert(sprite.textureName).second)
+						F_WARN("Texture '{}' does not exist, its sprites are not drawn", sprite.textureName);
+				}
+			}
+
+			if (hasMissingTexture)
+				std::erase_if(chunk.glyphs, [](const auto& glyph) { return glyph.textureID == 0; });
+
+			batchRenderer.AddGlyphs(chunk.glyphs);
+		}
+
+		m_ExtractTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - extractStart).count();
+	}
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Renderer/Essentials/BatchTypes.h"
+
+#include <entt.hpp>
+
+namespace Feather {
+
+	class Registry;
+	class Camera2D;
+	class AssetManager;
+	class SpriteBatchRenderer;
+	struct SpriteComponent;
+
+	/*
+	* @brief Culls the sprites of a registry and builds their glyphs for the sprite batch renderer.
+	* The sprite view is split into chunks that are culled and transformed in parallel on the job system,
+	* each chunk writing to its own buffer. Textures are resolved and the chunks merged in view order on the
+	* main thread, so the submitted glyphs are the same as a serial pass would produce.
+	*/
+	class SpriteExtractor
+	{
+	public:
+		/* Called from worker threads, must only read the registry */
+		using EntityFilter = std::function<bool(entt::entity)>;
+
+		/*
+		* @brief Adds every visible sprite that passes the filter to the batch renderer.
+		* Must be called from the main thread between Begin and End of the batch renderer.
+		*/
+		void Extract(Registry& registry, const Camera2D& camera, AssetManager& assetManager,
+					 SpriteBatchRenderer& batchRenderer, const EntityFilter& filter = nullptr);
+
+		/* @brief Time in milliseconds the last Extract took, including the merge. */
+		inline float GetExtractTime() const { return m_ExtractTime; }
+
+	private:
+		struct SpriteChunk
+		{
+			std::vector<SpriteGlyph> glyphs;
+			/* Sprite of each glyph, its texture is resolved to an ID through the sprite's cached handle during the merge */
+			std::vector<SpriteComponent*> sprites;
+		};
+
+	private:
+		/* Reused between frames so the chunk buffers keep their capacity */
+		std::vector<SpriteChunk> m_Chunks;
+		/* Textures already reported missing, so a missing texture is logged once instead of every frame */
+		std::unordered_set<std::string> m_MissingTextures;
+		float m_ExtractTime{ 0.0f };
+	};
+
+}
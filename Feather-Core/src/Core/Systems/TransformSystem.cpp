@@ -0,0 +1,210 @@
+#include "TransformSystem.h"
+
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Components/AllComponents.h"
+#include "Core/CoreUtils/CoreUtilities.h"
+
+namespace Feather {
+
+	namespace {
+
+		/* Kept in the registry's context, the scene and the runtime registries track their changes separately */
+		struct DirtyTransforms
+		{
+			entt::sparse_set entities;
+		};
+
+		void MarkDirty(entt::registry& registry, entt::entity entity)
+		{
+			auto& dirty = registry.ctx().get<DirtyTransforms>().entities;
+			if (!dirty.contains(entity))
+				dirty.push(entity);
+		}
+
+		void ClearDirty(entt::registry& registry, entt::entity entity)
+		{
+			registry.ctx().get<DirtyTransforms>().entities.remove(entity);
+		}
+
+		/* Tiles that are not part of a hierarchy never move, the renderers build their model directly */
+		bool IsStaticTile(entt::registry& registry, entt::entity entity)
+		{
+			if (!registry.all_of<TileComponent>(entity))
+				return false;
+
+			const auto* pRelationship = registry.try_get<Relationship>(entity);
+			return !pRelationship || (pRelationship->parent == entt::null && pRelationship->firstChild == entt::null);
+		}
+
+		const TransformComponent* TryGetParentTransform(entt::registry& registry, entt::entity entity)
+		{
+			const auto* pRelationship = registry.try_get<Relationship>(entity);
+			if (!pRelationship || pRelationship->parent == entt::null)
+				return nullptr;
+
+			return registry.try_get<TransformComponent>(pRelationship->parent);
+		}
+
+		/* The walk only goes through parents that have a transform */
+		bool HasDirtyAncestor(entt::registry& registry, const entt::sparse_set& dirty, entt::entity entity)
+		{
+			const auto* pRelationship = registry.try_get<Relationship>(entity);
+			while (pRelationship && pRelationship->parent != entt::null)
+			{
+				if (!registry.all_of<TransformComponent>(pRelationship->parent))
+					return false;
+
+				if (dirty.contains(pRelationship->parent))
+					return true;
+
+				pRelationship = registry.try_get<Relationship>(pRelationship->parent);
+			}
+
+			return false;
+		}
+
+		DirtyTransforms& GetDirtyTransforms(entt::registry& registry)
+		{
+			if (auto* pDirty = registry.ctx().find<DirtyTransforms>())
+				return *pDirty;
+
+			auto& dirty = registry.ctx().emplace<DirtyTransforms>();
+
+			// Free functions, nothing to disconnect when the registry is destroyed
+			registry.on_construct<TransformComponent>().connect<&MarkDirty>();
+			registry.on_update<TransformComponent>().connect<&MarkDirty>();
+			registry.on_destroy<TransformComponent>().connect<&ClearDirty>();
+			registry.on_construct<SpriteComponent>().connect<&MarkDirty>();
+			registry.on_update<SpriteComponent>().connect<&MarkDirty>();
+			registry.on_construct<TextComponent>().connect<&MarkDirty>();
+			registry.on_update<TextComponent>().connect<&MarkDirty>();
+
+			// Everything created before the first update
+			for (auto entity : registry.view<TransformComponent>())
+				dirty.entities.push(entity);
+
+			return dirty;
+		}
+
+	}
+
+	void TransformSystem::Update(Registry& registry)
+	{
+		auto& reg = registry.GetRegistry();
+		m_NumUpdated = 0;
+
+		auto& dirty = GetDirtyTransforms(reg).entities;
+
+		// Scripts and physics write the transforms in place without patching them.
+		// Only compares the cached inputs of the entities that have a world transform, static tiles have none
+		auto view = reg.view<TransformComponent, WorldTransformComponent>();
+		for (auto entity : view)
+		{
+			const auto& transform = view.get<TransformComponent>(entity);
+			const auto& worldTransform = view.get<WorldTransformComponent>(entity);
+
+			if (transform.position != worldTransform.position || transform.rotation != worldTransform.rotation ||
+				transform.scale != worldTransform.scale || transform.localPosition != worldTransform.localPosition ||
+				transform.localRotation != worldTransform.localRotation)
+			{
+				if (!dirty.contains(entity))
+					dirty.push(entity);
+			}
+		}
+
+		if (dirty.empty())
+			return;
+
+		// Walk the subtrees of the dirty entities, a dirty entity below another one is reached from the top
+		for (auto entity : dirty)
+		{
+			if (!reg.valid(entity) || !reg.all_of<TransformComponent>(entity) || HasDirtyAncestor(reg, dirty, entity))
+				continue;
+
+			UpdateEntity(reg, entity, TryGetParentTransform(reg, entity), false);
+		}
+
+		dirty.clear();
+	}
+
+	void TransformSystem::UpdateEntity(entt::registry& registry, entt::entity entity, const TransformComponent* pParent, bool parentChanged)
+	{
+		if (IsStaticTile(registry, entity))
+			return;
+
+		auto& transform = registry.get<TransformComponent>(entity);
+		auto& worldTransform = registry.get_or_emplace<WorldTransformComponent>(entity);
+
+		if (pParent)
+		{
+			bool localChanged = transform.localPosition != worldTransform.localPosition ||
+								transform.localRotation != worldTransform.localRotation;
+
+			// Moved in world space, by a script or physics. Keep the new offset from the parent
+			if (!localChanged && (transform.position != worldTransform.position || transform.rotation != worldTransform.rotation))
+			{
+				transform.localPosition = transform.position - pParent->position;
+				transform.localRotation = transform.rotation - pParent->rotation;
+				localChanged = true;
+			}
+
+			if (localChanged || parentChanged)
+			{
+				transform.position = pParent->position + transform.localPosition;
+				transform.rotation = pParent->rotation + transform.localRotation;
+			}
+		}
+
+		// Roots keep it too, so a change of their local offset is picked up when they are parented
+		worldTransform.localPosition = transform.localPosition;
+		worldTransform.localRotation = transform.localRotation;
+
+		float width{ 0.0f }, height{ 0.0f };
+		if (const auto* pSprite = registry.try_get<SpriteComponent>(entity))
+		{
+			width = pSprite->width;
+			height = pSprite->height;
+		}
+		else if (const auto* pText = registry.try_get<TextComponent>(entity))
+		{
+			width = pText->textBoxWidth;
+			height = pText->textBoxHeight;
+		}
+
+		// Children only follow the position and rotation
+		bool moved = transform.position != worldTransform.position || transform.rotation != worldTransform.rotation;
+		if (!worldTransform.IsCurrent(transform, width, height))
+		{
+			worldTransform.model = TRSModel(transform, width, height);
+			worldTransform.modelSize = glm::vec2{ width, height };
+			worldTransform.position = transform.position;
+			worldTransform.rotation = transform.rotation;
+			worldTransform.scale = transform.scale;
+			++m_NumUpdated;
+		}
+
+		const auto* pRelationship = registry.try_get<Relationship>(entity);
+		if (!pRelationship)
+			return;
+
+		for (auto child = pRelationship->firstChild; child != entt::null; child = registry.get<Relationship>(child).nextSibling)
+		{
+			if (registry.all_of<TransformComponent>(child))
+				UpdateEntity(registry, child, &transform, moved);
+		}
+	}
+
+	void TransformSystem::CreateTransformSystemLuaBind(sol::state& lua)
+	{
+		lua.new_usertype<TransformSystem>(
+			"TransformSystem",
+			sol::call_constructor,
+			sol::constructors<TransformSystem()>(),
+			"update",
+			[](TransformSystem& system, Registry& reg) { system.Update(reg); },
+			"numUpdated",
+			&TransformSystem::GetNumUpdated
+		);
+	}
+
+}
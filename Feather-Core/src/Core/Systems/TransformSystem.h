@@ -0,0 +1,42 @@
+#pragma once
+
+#include <sol/sol.hpp>
+#include <entt.hpp>
+
+namespace Feather {
+
+	class Registry;
+	struct TransformComponent;
+
+	/*
+	* @brief Resolves the world transforms of the entity hierarchy once per frame.
+	* Only the subtrees of the entities that changed are walked, parents before their children. Children are placed at
+	* their parent's position and rotation plus their local offset, the same as Entity::UpdateTransform.
+	* Changes come from the registry's signals, patching a transform, sprite or text marks the entity dirty, and from
+	* comparing the transforms that scripts and physics write in place against their cached WorldTransformComponent.
+	* Tiles outside of a hierarchy get no WorldTransformComponent and are never visited, the renderers build their model.
+	*/
+	class TransformSystem
+	{
+	public:
+		TransformSystem() = default;
+		~TransformSystem() = default;
+
+		/*
+		* @brief Should run after scripts and physics have moved the entities and before rendering.
+		*/
+		void Update(Registry& registry);
+
+		/* @brief Number of entities whose world transform changed in the last update. */
+		inline size_t GetNumUpdated() const { return m_NumUpdated; }
+
+		static void CreateTransformSystemLuaBind(sol::state& lua);
+
+	private:
+		void UpdateEntity(entt::registry& registry, entt::entity entity, const TransformComponent* pParent, bool parentChanged);
+
+	private:
+		size_t m_NumUpdated{ 0 };
+	};
+
+}
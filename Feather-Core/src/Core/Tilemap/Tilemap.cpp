@@ -0,0 +1,472 @@
+#include "Tilemap.h"
+
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/SpriteComponent.h"
+#include "Core/CoreUtils/CoreUtilities.h"
+#include "Core/Resources/AssetManager.h"
+#include "Renderer/Core/BatchRenderer.h"
+#include "Renderer/Core/Camera2D.h"
+#include "Renderer/Essentials/Texture.h"
+#include "Utils/FeatherUtilities.h"
+
+namespace Feather {
+
+	bool Tilemap::IsStaticTile(const SpriteComponent& sprite, bool hasCollider, bool hasAnimation, bool hasPhysics)
+	{
+		return !sprite.isHidden && !sprite.textureName.empty() && !hasCollider && !hasAnimation && !hasPhysics;
+	}
+
+	void Tilemap::AddTile(const TransformComponent& transform, const SpriteComponent& sprite)
+	{
+		auto& chunk = GetOrCreateChunk(transform.position);
+		const bool hasTiles = std::ranges::any_of(chunk.layers, [](const auto& chunkLayer) { return !chunkLayer.tiles.empty(); });
+
+		auto layerItr = std::ranges::find_if(chunk.layers, [&](const auto& chunkLayer) { return chunkLayer.layer == sprite.layer; });
+		if (layerItr == chunk.layers.end())
+		{
+			chunk.layers.emplace_back(TilemapChunkLayer{ .layer = sprite.layer });
+			layerItr = chunk.layers.end() - 1;
+		}
+
+		layerItr->tiles.emplace_back(
+			TilemapTile{
+				.position = transform.position,
+				.scale = transform.scale,
+				.rotation = transform.rotation,
+				.spriteIndex = GetSpriteIndex(sprite),
+				.isoCellX = sprite.isoCellX,
+				.isoCellY = sprite.isoCellY
+			}
+		);
+
+		// Grow the bounds conservatively so the chunk can be culled before it is rebuilt.
+		// The radius covers any rotation of the scaled tile around its position
+		const float extent = glm::length(glm::vec2{ sprite.width * transform.scale.x, sprite.height * transform.scale.y });
+		const glm::vec4 tileBounds{ transform.position - extent, transform.position + extent };
+
+		if (!hasTiles)
+			chunk.bounds = tileBounds;
+		else
+			chunk.bounds = glm::vec4{ glm::min(glm::vec2{ chunk.bounds }, glm::vec2{ tileBounds }),
+									  glm::max(glm::vec2{ chunk.bounds.z, chunk.bounds.w }, glm::vec2{ tileBounds.z, tileBounds.w }) };
+
+		chunk.isDirty = true;
+		m_NumTiles++;
+	}
+
+	bool Tilemap::FindTile(const glm::vec2& position, int layer, TilemapTileRef& outTile) const
+	{
+		return FindInNearbyChunks(position, [&](uint32_t chunkIndex) {
+			const auto& chunk = m_Chunks[chunkIndex];
+			for (uint32_t l = 0; l < chunk.layers.size(); l++)
+			{
+				if (chunk.layers[l].layer != layer)
+					continue;
+
+				const auto& tiles = chunk.layers[l].tiles;
+				for (uint32_t t = 0; t < tiles.size(); t++)
+				{
+					const auto& tile = tiles[t];
+					const auto& sprite = m_Sprites[tile.spriteIndex];
+
+					// The size can be negative if the tile is flipped
+					const glm::vec2 size{ sprite.width * tile.scale.x, sprite.height * tile.scale.y };
+					const glm::vec2 minPos = glm::min(tile.position, tile.position + size);
+					const glm::vec2 maxPos = glm::max(tile.position, tile.position + size);
+
+					if (position.x >= minPos.x && position.x < maxPos.x && position.y >= minPos.y && position.y < maxPos.y)
+					{
+						outTile = TilemapTileRef{ .chunkIndex = chunkIndex, .layerIndex = l, .tileIndex = t };
+						return true;
+					}
+				}
+			}
+
+			return false;
+		});
+	}
+
+	bool Tilemap::FindIsoTile(const glm::vec2& position, const glm::vec2& tileSize, int layer, TilemapTileRef& outTile) const
+	{
+		// Iso tiles are matched at the center of the tile, the same as the editor's tile index
+		const int centerX = position.x + (tileSize.x / 2.0f);
+		const int centerY = position.y + (tileSize.y / 2.0f);
+
+		return FindInNearbyChunks(position, [&](uint32_t chunkIndex) {
+			const auto& chunk = m_Chunks[chunkIndex];
+			for (uint32_t l = 0; l < chunk.layers.size(); l++)
+			{
+				if (chunk.layers[l].layer != layer)
+					continue;
+
+				const auto& tiles = chunk.layers[l].tiles;
+				for (uint32_t t = 0; t < tiles.size(); t++)
+				{
+					const auto& tile = tiles[t];
+					const auto& sprite = m_Sprites[tile.spriteIndex];
+
+					const int tileCenterX = tile.position.x + (sprite.width * tile.scale.x / 2.0f);
+					const int tileCenterY = tile.position.y + (sprite.height * tile.scale.y / 2.0f);
+
+					if (tileCenterX == centerX && tileCenterY == centerY)
+					{
+						outTile = TilemapTileRef{ .chunkIndex = chunkIndex, .layerIndex = l, .tileIndex = t };
+						return true;
+					}
+				}
+			}
+
+			return false;
+		});
+	}
+
+	void Tilemap::GetTile(const TilemapTileRef& tile, TransformComponent& outTransform, SpriteComponent& outSprite) const
+	{
+		const auto& chunkLayer = m_Chunks[tile.chunkIndex].layers[tile.layerIndex];
+		const auto& tilemapTile = chunkLayer.tiles[tile.tileIndex];
+		const auto& sprite = m_Sprites[tilemapTile.spriteIndex];
+
+		outTransform = TransformComponent{ .position = tilemapTile.position, .localPosition = tilemapTile.position, .scale = tilemapTile.scale, .rotation = tilemapTile.rotation };
+
+		outSprite = SpriteComponent{
+			.textureName = m_TextureNames[sprite.textureIndex],
+			.width = sprite.width,
+			.height = sprite.height,
+			.uvs = UVs{ .u = sprite.uvs.x, .v = sprite.uvs.y, .uv_width = sprite.uvs.z, .uv_height = sprite.uvs.w },
+			.color = sprite.color,
+			.start_x = sprite.startX,
+			.start_y = sprite.startY,
+			.layer = chunkLayer.layer,
+			.isIsometric = sprite.isIsometric,
+			.isoCellX = tilemapTile.isoCellX,
+			.isoCellY = tilemapTile.isoCellY
+		};
+	}
+
+	void Tilemap::RemoveTile(const TilemapTileRef& tile)
+	{
+		auto& chunk = m_Chunks[tile.chunkIndex];
+		auto& tiles = chunk.layers[tile.layerIndex].tiles;
+
+		// The order of the tiles in a layer does not matter, their glyphs are sorted by the batch renderer
+		tiles[tile.tileIndex] = tiles.back();
+		tiles.pop_back();
+
+		chunk.isDirty = true;
+		m_NumTiles--;
+	}
+
+	void Tilemap::ForEachTile(const std::function<void(const TransformComponent&, const SpriteComponent&)>& func) const
+	{
+		TransformComponent transform{};
+		SpriteComponent sprite{};
+
+		for (uint32_t c = 0; c < m_Chunks.size(); c++)
+		{
+			for (uint32_t l = 0; l < m_Chunks[c].layers.size(); l++)
+			{
+				for (uint32_t t = 0; t < m_Chunks[c].layers[l].tiles.size(); t++)
+				{
+					GetTile(TilemapTileRef{ .chunkIndex = c, .layerIndex = l, .tileIndex = t }, transform, sprite);
+					func(transform, sprite);
+				}
+			}
+		}
+	}
+
+	void Tilemap::RemoveLayer(int layer)
+	{
+		for (auto& chunk : m_Chunks)
+		{
+			for (auto& chunkLayer : chunk.layers)
+			{
+				if (chunkLayer.layer == layer)
+				{
+					m_NumTiles -= chunkLayer.tiles.size();
+					chunk.isDirty = true;
+				}
+				else if (chunkLayer.layer > layer)
+				{
+					chunkLayer.layer--;
+					chunk.isDirty = true;
+				}
+			}
+
+			std::erase_if(chunk.layers, [layer](const auto& chunkLayer) { return chunkLayer.layer == layer; });
+		}
+	}
+
+	void Tilemap::InsertLayer(int layer)
+	{
+		for (auto& chunk : m_Chunks)
+		{
+			for (auto& chunkLayer : chunk.layers)
+			{
+				if (chunkLayer.layer >= layer)
+				{
+					chunkLayer.layer++;
+					chunk.isDirty = true;
+				}
+			}
+		}
+	}
+
+	void Tilemap::SwapLayers(int layerA, int layerB)
+	{
+		for (auto& chunk : m_Chunks)
+		{
+			for (auto& chunkLayer : chunk.layers)
+			{
+				if (chunkLayer.layer == layerA)
+				{
+					chunkLayer.layer = layerB;
+					chunk.isDirty = true;
+				}
+				else if (chunkLayer.layer == layerB)
+				{
+					chunkLayer.layer = layerA;
+					chunk.isDirty = true;
+				}
+			}
+		}
+	}
+
+	void Tilemap::Clear()
+	{
+		m_Chunks.clear();
+		m_mapChunkIndices.clear();
+		m_Sprites.clear();
+		m_mapSpriteIndices.clear();
+		m_TextureNames.clear();
+		m_TextureIDs.clear();
+		m_TextureFrames.clear();
+		m_TextureHandles.clear();
+		m_mapTextureIndices.clear();
+		m_NumTiles = 0;
+	}
+
+	void Tilemap::AddVisibleTiles(SpriteBatchRenderer& batchRenderer, const Camera2D& camera, AssetManager& assetManager,
+								  const LayerFilter& filter)
+	{
+		if (m_Chunks.empty())
+			return;
+
+		m_FrameIndex++;
+
+		const glm::vec2 cameraPos = camera.GetPosition() - camera.GetScreenOffset();
+		const float invCameraScale = 1.0f / camera.GetScale();
+
+		const float cameraLeft = cameraPos.x * invCameraScale;
+		const float cameraRight = (cameraPos.x + camera.GetWidth()) * invCameraScale;
+		const float cameraTop = cameraPos.y * invCameraScale;
+		const float cameraBottom = (cameraPos.y + camera.GetHeight()) * invCameraScale;
+
+		for (auto& chunk : m_Chunks)
+		{
+			if (chunk.bounds.z <= cameraLeft || chunk.bounds.x >= cameraRight ||
+				chunk.bounds.w <= cameraTop || chunk.bounds.y >= cameraBottom)
+			{
+				continue;
+			}
+
+			// Textures that were reloaded get new IDs, the cached glyphs must be rebuilt
+			if (!chunk.isDirty && HaveTextureIDsChanged(chunk, assetManager))
+				chunk.isDirty = true;
+
+			if (chunk.isDirty)
+				RebuildChunk(chunk, assetManager);
+
+			for (const auto& chunkLayer : chunk.layers)
+			{
+				if (!filter || filter(chunkLayer.layer))
+					batchRenderer.AddGlyphs(chunkLayer.glyphs);
+			}
+		}
+	}
+
+	TilemapChunk& Tilemap::GetOrCreateChunk(const glm::vec2& position)
+	{
+		const glm::ivec2 coords = GetChunkCoords(position);
+		const uint64_t key = GetChunkKey(coords);
+
+		if (auto chunkItr = m_mapChunkIndices.find(key); chunkItr != m_mapChunkIndices.end())
+			return m_Chunks[chunkItr->second];
+
+		m_mapChunkIndices.emplace(key, m_Chunks.size());
+		return m_Chunks.emplace_back(TilemapChunk{ .coords = coords });
+	}
+
+	bool Tilemap::FindInNearbyChunks(const glm::vec2& position, const std::function<bool(uint32_t chunkIndex)>& func) const
+	{
+		// Tiles are stored in the chunk of their position, a tile covering the position may start in a neighbour
+		const glm::ivec2 coords = GetChunkCoords(position);
+		for (int y = -1; y <= 1; y++)
+		{
+			for (int x = -1; x <= 1; x++)
+			{
+				auto chunkItr = m_mapChunkIndices.find(GetChunkKey(coords + glm::ivec2{ x, y }));
+				if (chunkItr != m_mapChunkIndices.end() && func(static_cast<uint32_t>(chunkItr->second)))
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	uint32_t Tilemap::GetSpriteIndex(const SpriteComponent& sprite)
+	{
+		uint32_t textureIndex{ 0 };
+		if (auto textureItr = m_mapTextureIndices.find(sprite.textureName); textureItr != m_mapTextureIndices.end())
+		{
+			textureIndex = textureItr->second;
+		}
+		else
+		{
+			textureIndex = static_cast<uint32_t>(m_TextureNames.size());
+			m_TextureNames.push_back(sprite.textureName);
+			m_TextureIDs.push_back(0);
+			m_TextureFrames.push_back(0);
+			m_TextureHandles.emplace_back();
+			m_mapTextureIndices.emplace(sprite.textureName, textureIndex);
+		}
+
+		TileSprite tileSprite{
+			.textureIndex = textureIndex,
+			.width = sprite.width,
+			.height = sprite.height,
+			.uvs = glm::vec4{ sprite.uvs.u, sprite.uvs.v, sprite.uvs.uv_width, sprite.uvs.uv_height },
+			.color = sprite.color,
+			.startX = sprite.start_x,
+			.startY = sprite.start_y,
+			.isIsometric = sprite.isIsometric
+		};
+
+		const size_t hash = HashSprite(tileSprite);
+		if (auto spriteItr = m_mapSpriteIndices.find(hash); spriteItr != m_mapSpriteIndices.end() && m_Sprites[spriteItr->second] == tileSprite)
+			return spriteItr->second;
+
+		const uint32_t spriteIndex = static_cast<uint32_t>(m_Sprites.size());
+		m_Sprites.push_back(tileSprite);
+		// On a hash collision the first sprite keeps the slot, the new one is just not shared
+		m_mapSpriteIndices.try_emplace(hash, spriteIndex);
+
+		return spriteIndex;
+	}
+
+	GLuint Tilemap::ResolveTextureID(uint32_t textureIndex, AssetManager& assetManager)
+	{
+		if (m_TextureFrames[textureIndex] == m_FrameIndex)
+			return m_TextureIDs[textureIndex];
+
+		// Missing textures are skipped when the chunks are built. Only unresolved names are checked by name
+		GLuint textureID{ 0 };
+		if (m_TextureHandles[textureIndex].IsValid() || assetManager.HasAsset(m_TextureNames[textureIndex], AssetType::TEXTURE))
+		{
+			if (const auto& pTexture = assetManager.ResolveTexture(m_TextureNames[textureIndex], m_TextureHandles[textureIndex]))
+				textureID = pTexture->GetID();
+		}
+
+		m_TextureIDs[textureIndex] = textureID;
+		m_TextureFrames[textureIndex] = m_FrameIndex;
+		return textureID;
+	}
+
+	bool Tilemap::HaveTextureIDsChanged(const TilemapChunk& chunk, AssetManager& assetManager)
+	{
+		for (size_t i = 0; i < chunk.textureIndices.size(); i++)
+		{
+			if (ResolveTextureID(chunk.textureIndices[i], assetManager) != chunk.textureIDs[i])
+				return true;
+		}
+
+		return false;
+	}
+
+	void Tilemap::RebuildChunk(TilemapChunk& chunk, AssetManager& assetManager)
+	{
+		bool hasGlyphs{ false };
+		glm::vec2 minPos{ 0.0f };
+		glm::vec2 maxPos{ 0.0f };
+
+		chunk.textureIndices.clear();
+		chunk.textureIDs.clear();
+
+		for (auto& chunkLayer : chunk.layers)
+		{
+			chunkLayer.glyphs.clear();
+
+			for (const auto& tile : chunkLayer.tiles)
+			{
+				const auto& sprite = m_Sprites[tile.spriteIndex];
+				const GLuint textureID = ResolveTextureID(sprite.textureIndex, assetManager);
+
+				// A chunk only uses a few textures, a linear search is enough
+				if (std::ranges::find(chunk.textureIndices, sprite.textureIndex) == chunk.textureIndices.end())
+				{
+					chunk.textureIndices.push_back(sprite.textureIndex);
+					chunk.textureIDs.push_back(textureID);
+				}
+
+				if (textureID == 0)
+					continue;
+
+				const TransformComponent transform{ .position = tile.position, .scale = tile.scale, .rotation = tile.rotation };
+				const glm::vec4 spriteRect{ tile.position.x, tile.position.y, sprite.width, sprite.height };
+
+				const int layer = sprite.isIsometric ?
+					SpriteBatchRenderer::GetIsoLayer(spriteRect, tile.isoCellX, tile.isoCellY, chunkLayer.layer) :
+					chunkLayer.layer;
+
+				const auto& glyph = chunkLayer.glyphs.emplace_back(
+					SpriteBatchRenderer::CreateGlyph(spriteRect, sprite.uvs, textureID, layer, TRSModel(transform, sprite.width, sprite.height), sprite.color));
+
+				// Tighten the bounds to the actual vertices
+				if (!hasGlyphs)
+				{
+					minPos = maxPos = glyph.topLeft.position;
+					hasGlyphs = true;
+				}
+
+				for (const auto& vertex : { glyph.topLeft, glyph.bottomLeft, glyph.topRight, glyph.bottomRight })
+				{
+					minPos = glm::min(minPos, vertex.position);
+					maxPos = glm::max(maxPos, vertex.position);
+				}
+			}
+		}
+
+		if (hasGlyphs)
+			chunk.bounds = glm::vec4{ minPos, maxPos };
+
+		chunk.isDirty = false;
+	}
+
+	glm::ivec2 Tilemap::GetChunkCoords(const glm::vec2& position)
+	{
+		return glm::ivec2{ glm::floor(position / TILEMAP_CHUNK_SIZE) };
+	}
+
+	uint64_t Tilemap::GetChunkKey(const glm::ivec2& coords)
+	{
+		return (static_cast<uint64_t>(static_cast<uint32_t>(coords.x)) << 32) | static_cast<uint32_t>(coords.y);
+	}
+
+	size_t Tilemap::HashSprite(const TileSprite& sprite)
+	{
+		size_t hash = std::hash<uint32_t>{}(sprite.textureIndex);
+		auto combine = [&hash](size_t value) { hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+
+		combine(std::hash<float>{}(sprite.width));
+		combine(std::hash<float>{}(sprite.height));
+		for (int i = 0; i < 4; i++)
+			combine(std::hash<float>{}(sprite.uvs[i]));
+
+		combine(std::hash<uint32_t>{}((sprite.color.r << 24) | (sprite.color.g << 16) | (sprite.color.b << 8) | sprite.color.a));
+		combine(std::hash<int>{}(sprite.startX));
+		combine(std::hash<int>{}(sprite.startY));
+		combine(std::hash<bool>{}(sprite.isIsometric));
+
+		return hash;
+	}
+
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "Renderer/Essentials/BatchTypes.h"
+#include "Core/Resources/AssetHandle.h"
+
+#include <glm/glm.hpp>
+
+namespace Feather {
+
+	struct TransformComponent;
+	struct SpriteComponent;
+	class SpriteBatchRenderer;
+	class Camera2D;
+	class AssetManager;
+	class Texture;
+
+	/* World size of one side of a tilemap chunk */
+	constexpr float TILEMAP_CHUNK_SIZE = 512.0f;
+
+	/*
+	* Shared sprite data for tiles. Tiles only store an index into the tilemap's palette.
+	*/
+	struct TileSprite
+	{
+		uint32_t textureIndex{ 0 };
+		float width{ 16.0f };
+		float height{ 16.0f };
+		glm::vec4 uvs{ 0.0f };
+		Color color{};
+		/* Kept so the tile can be saved and edited as a sprite again */
+		int startX{ 0 };
+		int startY{ 0 };
+		bool isIsometric{ false };
+
+		friend bool operator==(const TileSprite& a, const TileSprite& b)
+		{
+			return a.textureIndex == b.textureIndex && a.width == b.width && a.height == b.height && a.uvs == b.uvs &&
+				a.color.r == b.color.r && a.color.g == b.color.g && a.color.b == b.color.b && a.color.a == b.color.a &&
+				a.startX == b.startX && a.startY == b.startY && a.isIsometric == b.isIsometric;
+		}
+	};
+
+	/*
+	* Packed static tile. Replaces a full entity with Transform/Sprite/Tile components.
+	*/
+	struct TilemapTile
+	{
+		glm::vec2 position{ 0.0f };
+		glm::vec2 scale{ 1.0f };
+		float rotation{ 0.0f };
+		uint32_t spriteIndex{ 0 };
+		int isoCellX{ 0 };
+		int isoCellY{ 0 };
+	};
+
+	struct TilemapChunkLayer
+	{
+		int layer{ 0 };
+		std::vector<TilemapTile> tiles;
+		/* Prebuilt glyphs of the layer's tiles, kept per layer so hidden layers can be skipped */
+		std::vector<SpriteGlyph> glyphs;
+	};
+
+	/*
+	* Fixed-size region of the tilemap. Holds the tiles of every layer in the region and
+	* the prebuilt glyphs for them, which are only rebuilt when a tile in the chunk changes.
+	*/
+	struct TilemapChunk
+	{
+		glm::ivec2 coords{ 0 };
+		std::vector<TilemapChunkLayer> layers;
+		/* World space bounds of the chunk's tiles as (minX, minY, maxX, maxY) */
+		glm::vec4 bounds{ 0.0f };
+		/* Textures used by the chunk's tiles and the IDs its glyphs were built with, checked only while the chunk is visible */
+		std::vector<uint32_t> textureIndices;
+		std::vector<GLuint> textureIDs;
+		bool isDirty{ true };
+	};
+
+	/*
+	* Location of a tile in the tilemap. Only valid until the next tile is removed.
+	*/
+	struct TilemapTileRef
+	{
+		uint32_t chunkIndex{ 0 };
+		uint32_t layerIndex{ 0 };
+		uint32_t tileIndex{ 0 };
+	};
+
+	/*
+	* Static tiles of a scene stored in chunks instead of entities.
+	* Tiles with colliders, physics or animations are still loaded as entities.
+	* The editor and the runtime bake the same tiles, the editor's tile tools and commands add and remove baked tiles
+	* through FindTile/RemoveTile, which mark their chunk dirty. Baked tiles have no entity, Identification or
+	* TileComponent, so scripts cannot look them up.
+	*/
+	class Tilemap
+	{
+	public:
+		/* Returns false to skip the layer, called from the main thread */
+		using LayerFilter = std::function<bool(int layer)>;
+
+		Tilemap() = default;
+		~Tilemap() = default;
+
+		/*
+		 * @brief Checks if the tile can be baked. Hidden tiles and tiles that need to be entities can not.
+		 */
+		static bool IsStaticTile(const SpriteComponent& sprite, bool hasCollider, bool hasAnimation, bool hasPhysics);
+
+		/*
+		 * @brief Adds a static tile and marks its chunk dirty.
+		 */
+		void AddTile(const TransformComponent& transform, const SpriteComponent& sprite);
+
+		/*
+		 * @brief Finds the tile on the layer whose rect contains the position.
+		 * Tiles are looked up in the chunk of the position and its neighbours, so they can not be larger than a chunk.
+		 */
+		bool FindTile(const glm::vec2& position, int layer, TilemapTileRef& outTile) const;
+
+		/*
+		 * @brief Finds the iso tile on the layer with the same center as a tile of the given size at the position.
+		 */
+		bool FindIsoTile(const glm::vec2& position, const glm::vec2& tileSize, int layer, TilemapTileRef& outTile) const;
+
+		/*
+		 * @brief Rebuilds the transform and sprite of a tile, the sprite is on the tile's layer.
+		 */
+		void GetTile(const TilemapTileRef& tile, TransformComponent& outTransform, SpriteComponent& outSprite) const;
+
+		/*
+		 * @brief Removes the tile and marks its chunk dirty. Invalidates every other TilemapTileRef.
+		 */
+		void RemoveTile(const TilemapTileRef& tile);
+
+		/*
+		 * @brief Calls the function with the transform and sprite of every tile, used to save the tilemap.
+		 */
+		void ForEachTile(const std::function<void(const TransformComponent&, const SpriteComponent&)>& func) const;
+
+		/*
+		 * @brief Removes every tile on the layer and moves the layers above it down by one.
+		 */
+		void RemoveLayer(int layer);
+
+		/*
+		 * @brief Moves the layer and every layer above it up by one, leaving the layer empty.
+		 */
+		void InsertLayer(int layer);
+
+		void SwapLayers(int layerA, int layerB);
+
+		void Clear();
+
+		/*
+		 * @brief Adds the prebuilt glyphs of every chunk in view of the camera to the batch renderer.
+		 * Dirty chunks are rebuilt before they are added.
+		 * @param filter Optional filter of the layers to draw, used by the editor to hide layers.
+		 */
+		void AddVisibleTiles(SpriteBatchRenderer& batchRenderer, const Camera2D& camera, AssetManager& assetManager,
+							 const LayerFilter& filter = nullptr);
+
+		inline size_t GetNumTiles() const { return m_NumTiles; }
+		inline size_t GetNumChunks() const { return m_Chunks.size(); }
+		inline const std::vector<std::string>& GetTextureNames() const { return m_TextureNames; }
+
+	private:
+		TilemapChunk& GetOrCreateChunk(const glm::vec2& position);
+		/* Calls the function with the index of the chunk of the position and of its neighbours, until it returns true */
+		bool FindInNearbyChunks(const glm::vec2& position, const std::function<bool(uint32_t chunkIndex)>& func) const;
+		uint32_t GetSpriteIndex(const SpriteComponent& sprite);
+		/* Resolves the texture at most once per frame, textures that were reloaded get a new ID */
+		GLuint ResolveTextureID(uint32_t textureIndex, AssetManager& assetManager);
+		bool HaveTextureIDsChanged(const TilemapChunk& chunk, AssetManager& assetManager);
+		void RebuildChunk(TilemapChunk& chunk, AssetManager& assetManager);
+
+		static glm::ivec2 GetChunkCoords(const glm::vec2& position);
+		static uint64_t GetChunkKey(const glm::ivec2& coords);
+		static size_t HashSprite(const TileSprite& sprite);
+
+	private:
+		std::vector<TilemapChunk> m_Chunks;
+		std::unordered_map<uint64_t, size_t> m_mapChunkIndices;
+
+		std::vector<TileSprite> m_Sprites;
+		std::unordered_map<size_t, uint32_t> m_mapSpriteIndices;
+
+		std::vector<std::string> m_TextureNames;
+		std::vector<GLuint> m_TextureIDs;
+		/* Frame each texture was last resolved on */
+		std::vector<uint32_t> m_TextureFrames;
+		std::vector<AssetHandle<Texture>> m_TextureHandles;
+		std::unordered_map<std::string, uint32_t> m_mapTextureIndices;
+
+		size_t m_NumTiles{ 0 };
+		uint32_t m_FrameIndex{ 0 };
+	};
+
+}
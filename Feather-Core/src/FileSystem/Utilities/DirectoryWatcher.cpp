@@ -5,12 +5,22 @@
 #ifdef _WIN32
 #include <Windows.h>
 #else
-// TODO: Add Linux headers?
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
 #endif
 
 namespace fs = std::filesystem;
 using namespace std::chrono_literals;
 
+/* Time a path must go without new events before it is reported */
+constexpr auto WATCHER_DEBOUNCE_TIME = 50ms;
+/* Longest a path can be held back while events keep arriving */
+constexpr auto WATCHER_MAX_DELAY = 500ms;
+
 namespace Feather {
 
 	struct DirectoryWatcher::Impl
@@ -20,18 +30,31 @@ namespace Feather {
 		std::atomic_bool stopFlag{ false };
 		std::thread watcherThread;
 
+		/* Changes waiting to settle, only touched by the watcher thread. Later events for a path replace earlier ones */
+		std::map<fs::path, bool> pendingChanges;
+		std::chrono::steady_clock::time_point firstPendingTime{};
+		std::chrono::steady_clock::time_point lastEventTime{};
+
 #ifdef _WIN32
 		HANDLE directoryHandle{ nullptr };
 		HANDLE shutdownHandle{ nullptr };
 		OVERLAPPED overlapped{};
 #else
-		// TODO: Add variables for Linux?
+		int inotifyFd{ -1 };
+		/* Written by the destructor to wake the watcher thread */
+		int shutdownFd{ -1 };
+		/* Watch descriptor of each watched directory to its path */
+		std::unordered_map<int, fs::path> mapWatchPaths;
 #endif
 
 		Impl(const fs::path& path, Callback cb)
 			: rootPath{ path }
 			, callback{ std::move(cb) }
 		{
+#ifndef _WIN32
+			// Created before the thread starts so the destructor can always signal it
+			shutdownFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
 			watcherThread = std::thread([this] { Run(); });
 		}
 
@@ -39,10 +62,19 @@ namespace Feather {
 
 		void Run();
 
+		void QueueChange(const fs::path& path, bool modified);
+		/* @brief Queues every file under the directory as modified, used for new directories and missed events. */
+		void QueueDirectoryContents(const fs::path& directory);
+		bool ShouldFlush() const;
+		void FlushChanges();
+
 #ifdef _WIN32
 		void RunWindows();
 #else
 		void RunLinux();
+		void AddWatchRecursive(const fs::path& directory);
+		void RemoveWatchesUnder(const fs::path& directory);
+		void HandleEvent(const inotify_event& event);
 #endif
 	};
 
@@ -61,6 +93,9 @@ namespace Feather {
 			SetEvent(shutdownHandle);
 			CancelIoEx(directoryHandle, &overlapped);
 #else
+			uint64_t value{ 1 };
+			if (write(shutdownFd, &value, sizeof(value)) < 0)
+				F_ERROR("Failed to signal the directory watcher to shut down");
 #endif
 			watcherThread.join();
 		}
@@ -78,7 +113,11 @@ namespace Feather {
 			shutdownHandle = nullptr;
 		}
 #else
-		// TODO: Handle Linux shutdown stuff?
+		if (shutdownFd >= 0)
+		{
+			close(shutdownFd);
+			shutdownFd = -1;
+		}
 #endif
 	}
 
@@ -91,6 +130,51 @@ namespace Feather {
 #endif
 	}
 
+	void DirectoryWatcher::Impl::QueueChange(const fs::path& path, bool modified)
+	{
+		auto now = std::chrono::steady_clock::now();
+		if (pendingChanges.empty())
+			firstPendingTime = now;
+
+		pendingChanges.insert_or_assign(path, modified);
+		lastEventTime = now;
+	}
+
+	void DirectoryWatcher::Impl::QueueDirectoryContents(const fs::path& directory)
+	{
+		std::error_code ec;
+		for (auto itr = fs::recursive_directory_iterator{ directory, fs::directory_options::skip_permission_denied, ec };
+			 itr != fs::recursive_directory_iterator{}; itr.increment(ec))
+		{
+			if (ec)
+				break;
+
+			QueueChange(itr->path(), true);
+		}
+	}
+
+	bool DirectoryWatcher::Impl::ShouldFlush() const
+	{
+		if (pendingChanges.empty())
+			return false;
+
+		auto now = std::chrono::steady_clock::now();
+		return now - lastEventTime >= WATCHER_DEBOUNCE_TIME || now - firstPendingTime >= WATCHER_MAX_DELAY;
+	}
+
+	void DirectoryWatcher::Impl::FlushChanges()
+	{
+		if (callback)
+		{
+			for (const auto& [path, modified] : pendingChanges)
+			{
+				callback(path, modified);
+			}
+		}
+
+		pendingChanges.clear();
+	}
+
 #ifdef _WIN32
 	void DirectoryWatcher::Impl::RunWindows()
 	{
@@ -121,6 +205,7 @@ namespace Feather {
 		overlapped.hEvent = hEvent;
 
 		HANDLE handles[] = { hEvent, shutdownHandle };
+		bool readPending{ false };
 
 		while (!stopFlag)
 		{
@@ -132,25 +217,34 @@ namespace Feather {
 				break;
 			}
 
-			ResetEvent(hEvent);
+			// NOTE: Only one read may be outstanding, a debounce timeout leaves the current one pending
+			if (!readPending)
+			{
+				ResetEvent(hEvent);
 
-			BOOL result = ReadDirectoryChangesW(
-				hDir,
-				buffer, bufferSize,
-				TRUE,
-				FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE,
-				&bytesReturned, &overlapped, nullptr);
+				BOOL result = ReadDirectoryChangesW(
+					hDir,
+					buffer, bufferSize,
+					TRUE,
+					FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE,
+					&bytesReturned, &overlapped, nullptr);
 
-			if (!result && GetLastError() != ERROR_IO_PENDING)
-			{
-				F_ERROR("ReadDirectoryChangesW failed: {}", GetLastError());
-				break;
+				if (!result && GetLastError() != ERROR_IO_PENDING)
+				{
+					F_ERROR("ReadDirectoryChangesW failed: {}", GetLastError());
+					break;
+				}
+
+				readPending = true;
 			}
 
-			// NOTE: Wait for either read to complete or the shutdown events
-			DWORD waitStatus = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+			// NOTE: Wait for either read to complete, the shutdown event, or pending changes to settle
+			DWORD timeout = pendingChanges.empty() ? INFINITE : static_cast<DWORD>(WATCHER_DEBOUNCE_TIME.count());
+			DWORD waitStatus = WaitForMultipleObjects(2, handles, FALSE, timeout);
 			if (waitStatus == WAIT_OBJECT_0) // Overlapped event signaled
 			{
+				readPending = false;
+
 				if (!GetOverlappedResult(hDir, &overlapped, &bytesReturned, FALSE))
 				{
 					DWORD err = GetLastError();
@@ -161,37 +255,46 @@ namespace Feather {
 					break;
 				}
 
-				FILE_NOTIFY_INFORMATION* notify = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(buffer);
-				do
+				// NOTE: Zero bytes means the buffer overflowed and the changes were lost
+				if (bytesReturned == 0)
 				{
-					std::wstring filename{ notify->FileName, notify->FileNameLength / sizeof(WCHAR) };
-					fs::path changedPath = rootPath / filename;
-
-					if (callback)
+					F_WARN("Directory watcher buffer overflowed for '{}', rescanning", rootPath.string());
+					QueueDirectoryContents(rootPath);
+				}
+				else
+				{
+					FILE_NOTIFY_INFORMATION* notify = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(buffer);
+					do
 					{
+						std::wstring filename{ notify->FileName, notify->FileNameLength / sizeof(WCHAR) };
+						fs::path changedPath = rootPath / filename;
+
 						bool modified = notify->Action == FILE_ACTION_MODIFIED ||
 										notify->Action == FILE_ACTION_RENAMED_NEW_NAME ||
 										notify->Action == FILE_ACTION_ADDED;
 
-						callback(changedPath, modified);
-					}
+						QueueChange(changedPath, modified);
 
-					if (notify->NextEntryOffset == 0)
-						break;
+						if (notify->NextEntryOffset == 0)
+							break;
 
-					notify = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(reinterpret_cast<BYTE*>(notify) + notify->NextEntryOffset);
-				} while (true);
+						notify = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(reinterpret_cast<BYTE*>(notify) + notify->NextEntryOffset);
+					} while (true);
+				}
 			}
 			else if (waitStatus == WAIT_OBJECT_0 + 1) // Shutdown event signaled
 			{
 				CancelIoEx(hDir, &overlapped);
 				break;
 			}
-			else
+			else if (waitStatus != WAIT_TIMEOUT)
 			{
 				F_ERROR("WaitForMultipleObjects failed: {}", GetLastError());
 				break;
 			}
+
+			if (ShouldFlush())
+				FlushChanges();
 		}
 
 		if (hEvent)
@@ -204,6 +307,163 @@ namespace Feather {
 #else
 	void DirectoryWatcher::Impl::RunLinux()
 	{
+		inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (inotifyFd < 0 || shutdownFd < 0)
+		{
+			F_ERROR("Failed to initialize inotify: {}", std::strerror(errno));
+			if (inotifyFd >= 0)
+				close(inotifyFd);
+			inotifyFd = -1;
+			return;
+		}
+
+		AddWatchRecursive(rootPath);
+
+		// NOTE: Large enough for a burst of events, inotify_event is followed by its name
+		alignas(inotify_event) char buffer[64 * 1024];
+		pollfd fds[2] = { { inotifyFd, POLLIN, 0 }, { shutdownFd, POLLIN, 0 } };
+
+		while (!stopFlag)
+		{
+			int timeout = pendingChanges.empty() ? -1 : static_cast<int>(WATCHER_DEBOUNCE_TIME.count());
+			int ready = poll(fds, 2, timeout);
+			if (ready < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				F_ERROR("Failed to poll for directory changes: {}", std::strerror(errno));
+				break;
+			}
+
+			if (fds[1].revents & POLLIN) // Shutdown signaled
+				break;
+
+			if (fds[0].revents & POLLIN)
+			{
+				ssize_t length{ 0 };
+				while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0)
+				{
+					for (char* ptr = buffer; ptr < buffer + length;)
+					{
+						const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+						HandleEvent(*event);
+						ptr += sizeof(inotify_event) + event->len;
+					}
+				}
+
+				if (length < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+				{
+					F_ERROR("Failed to read directory changes: {}", std::strerror(errno));
+					break;
+				}
+			}
+
+			if (ShouldFlush())
+				FlushChanges();
+		}
+
+		close(inotifyFd);
+		inotifyFd = -1;
+		mapWatchPaths.clear();
+	}
+
+	void DirectoryWatcher::Impl::AddWatchRecursive(const fs::path& directory)
+	{
+		constexpr uint32_t watchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_FROM |
+									   IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR | IN_EXCL_UNLINK;
+
+		auto addWatch = [&](const fs::path& path) {
+			int wd = inotify_add_watch(inotifyFd, path.c_str(), watchMask);
+			if (wd < 0)
+			{
+				if (errno == ENOSPC)
+					F_ERROR("Failed to watch '{}': Reached the inotify watch limit, raise fs.inotify.max_user_watches", path.string());
+				else
+					F_ERROR("Failed to watch '{}': {}", path.string(), std::strerror(errno));
+
+				return;
+			}
+
+			// A directory that was renamed keeps its watch descriptor, only the path changes
+			mapWatchPaths.insert_or_assign(wd, path);
+		};
+
+		addWatch(directory);
+
+		std::error_code ec;
+		for (auto itr = fs::recursive_directory_iterator{ directory, fs::directory_options::skip_permission_denied, ec };
+			 itr != fs::recursive_directory_iterator{}; itr.increment(ec))
+		{
+			if (ec)
+				break;
+
+			if (itr->is_directory(ec) && !itr->is_symlink(ec))
+				addWatch(itr->path());
+		}
+	}
+
+	void DirectoryWatcher::Impl::RemoveWatchesUnder(const fs::path& directory)
+	{
+		std::erase_if(mapWatchPaths, [&](const auto& watchPair) {
+			const auto& [wd, path] = watchPair;
+			auto relative = path.lexically_relative(directory);
+			if (relative.empty() || *relative.begin() == "..")
+				return false;
+
+			inotify_rm_watch(inotifyFd, wd);
+			return true;
+		});
+	}
+
+	void DirectoryWatcher::Impl::HandleEvent(const inotify_event& event)
+	{
+		if (event.mask & IN_Q_OVERFLOW)
+		{
+			F_WARN("Directory watcher queue overflowed for '{}', rescanning", rootPath.string());
+			AddWatchRecursive(rootPath);
+			QueueDirectoryContents(rootPath);
+			return;
+		}
+
+		auto watchItr = mapWatchPaths.find(event.wd);
+		if (watchItr == mapWatchPaths.end())
+			return;
+
+		// The watch is removed by the kernel once its directory is deleted
+		if (event.mask & (IN_IGNORED | IN_DELETE_SELF))
+		{
+			if (event.mask & IN_IGNORED)
+				mapWatchPaths.erase(watchItr);
+
+			return;
+		}
+
+		fs::path changedPath = event.len > 0 ? watchItr->second / event.name : watchItr->second;
+
+		if (event.mask & IN_ISDIR)
+		{
+			if (event.mask & (IN_CREATE | IN_MOVED_TO))
+			{
+				// Files can be written into the new directory before its watch exists, report what is already there
+				AddWatchRecursive(changedPath);
+				QueueDirectoryContents(changedPath);
+				QueueChange(changedPath, true);
+			}
+			else if (event.mask & (IN_DELETE | IN_MOVED_FROM))
+			{
+				// If the directory was moved within the tree, the matching IN_MOVED_TO watches it again
+				RemoveWatchesUnder(changedPath);
+				QueueChange(changedPath, false);
+			}
+
+			return;
+		}
+
+		if (event.mask & (IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO))
+			QueueChange(changedPath, true);
+		else if (event.mask & (IN_DELETE | IN_MOVED_FROM))
+			QueueChange(changedPath, false);
 	}
 #endif
 
@@ -6,6 +6,11 @@
 
 namespace Feather {
 
+	/*
+	* @brief Recursively watches a directory and reports changed files on a background thread.
+	* Changes are coalesced, a path is reported once after its events have settled.
+	* The callback receives the changed path and whether it was added/modified (true) or removed (false).
+	*/
 	class DirectoryWatcher
 	{
 	public:
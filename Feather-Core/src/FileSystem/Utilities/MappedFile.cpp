@@ -0,0 +1,125 @@
+#include "MappedFile.h"
+
+#include "Logger/Logger.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Feather {
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	bool MappedFile::Open(const std::filesystem::path& filepath)
+	{
+		Close();
+
+#ifdef _WIN32
+		HANDLE fileHandle = CreateFileW(filepath.wstring().c_str(),
+										GENERIC_READ,
+										FILE_SHARE_READ,
+										nullptr,
+										OPEN_EXISTING,
+										FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+										nullptr);
+
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			F_ERROR("Failed to map file '{}': Unable to open file", filepath.string());
+			return false;
+		}
+
+		LARGE_INTEGER fileSize{};
+		if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+		{
+			F_ERROR("Failed to map file '{}': File is empty or size is unavailable", filepath.string());
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mappingHandle)
+		{
+			F_ERROR("Failed to map file '{}': Unable to create file mapping", filepath.string());
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		void* pView = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if (!pView)
+		{
+			F_ERROR("Failed to map file '{}': Unable to map view of file", filepath.string());
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		m_FileHandle = fileHandle;
+		m_MappingHandle = mappingHandle;
+		m_pData = static_cast<const unsigned char*>(pView);
+		m_Size = static_cast<size_t>(fileSize.QuadPart);
+#else
+		int fd = open(filepath.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			F_ERROR("Failed to map file '{}': Unable to open file", filepath.string());
+			return false;
+		}
+
+		struct stat fileStat{};
+		if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+		{
+			F_ERROR("Failed to map file '{}': File is empty or size is unavailable", filepath.string());
+			close(fd);
+			return false;
+		}
+
+		void* pView = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		// The mapping keeps its own reference to the file
+		close(fd);
+
+		if (pView == MAP_FAILED)
+		{
+			F_ERROR("Failed to map file '{}': mmap failed", filepath.string());
+			return false;
+		}
+
+		m_pData = static_cast<const unsigned char*>(pView);
+		m_Size = static_cast<size_t>(fileStat.st_size);
+#endif
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+#ifdef _WIN32
+		if (m_pData)
+			UnmapViewOfFile(m_pData);
+
+		if (m_MappingHandle)
+			CloseHandle(m_MappingHandle);
+
+		if (m_FileHandle)
+			CloseHandle(m_FileHandle);
+
+		m_MappingHandle = nullptr;
+		m_FileHandle = nullptr;
+#else
+		if (m_pData)
+			munmap(const_cast<unsigned char*>(m_pData), m_Size);
+#endif
+
+		m_pData = nullptr;
+		m_Size = 0;
+	}
+
+}
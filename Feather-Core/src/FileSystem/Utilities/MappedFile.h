@@ -0,0 +1,40 @@
+#pragma once
+
+#include <filesystem>
+
+namespace Feather {
+
+	/*
+	* Read only memory mapping of a file. The mapped data stays valid until the file is closed.
+	*/
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/*
+		* @brief Maps the entire file into memory. Any previously mapped file is closed first.
+		* @return Returns true if the file was mapped.
+		*/
+		bool Open(const std::filesystem::path& filepath);
+		void Close();
+
+		inline const unsigned char* GetData() const { return m_pData; }
+		inline size_t GetSize() const { return m_Size; }
+		inline bool IsOpen() const { return m_pData != nullptr; }
+
+	private:
+		const unsigned char* m_pData{ nullptr };
+		size_t m_Size{ 0 };
+
+#ifdef _WIN32
+		void* m_FileHandle{ nullptr };
+		void* m_MappingHandle{ nullptr };
+#endif
+	};
+
+}
@@ -320,6 +320,9 @@ namespace Feather {
 	{
 		std::string filename{ "" };
 
+		// Write out anything still queued so the last messages before the crash are not lost
+		F_FLUSH_LOGS();
+
 		{
 			ExtractCrashLocation();
 			std::string sTimestamp{ GetCurrentTimestamp() };
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+
+namespace Feather {
+
+	/*
+	* @brief Bounded lock-free ring buffer for many producers and a single consumer.
+	* Each slot carries a sequence number that tells producers and the consumer whose turn it is,
+	* so pushing only costs a compare-and-swap on the write position and never takes a lock.
+	* The capacity is rounded up to a power of two.
+	*/
+	template <typename TRecord>
+	class LogQueue
+	{
+	public:
+		explicit LogQueue(size_t capacity)
+		{
+			size_t roundedCapacity{ 2 };
+			while (roundedCapacity < capacity)
+				roundedCapacity <<= 1;
+
+			m_Mask = roundedCapacity - 1;
+			m_Slots = std::make_unique<Slot[]>(roundedCapacity);
+			for (size_t i = 0; i < roundedCapacity; i++)
+			{
+				m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		LogQueue(const LogQueue&) = delete;
+		LogQueue& operator=(const LogQueue&) = delete;
+
+		/*
+		* @brief Safe to call from any thread. Returns false if the queue is full.
+		*/
+		bool TryPush(TRecord&& record)
+		{
+			size_t position = m_EnqueuePos.load(std::memory_order_relaxed);
+			Slot* pSlot{ nullptr };
+
+			while (true)
+			{
+				pSlot = &m_Slots[position & m_Mask];
+				size_t sequence = pSlot->sequence.load(std::memory_order_acquire);
+				auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+				if (diff == 0)
+				{
+					if (m_EnqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+				{
+					// The consumer has not freed this slot yet
+					return false;
+				}
+				else
+				{
+					position = m_EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			pSlot->record = std::move(record);
+			pSlot->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* @brief Must only be called from the consumer thread. Returns false if the queue is empty.
+		*/
+		bool TryPop(TRecord& outRecord)
+		{
+			Slot& slot = m_Slots[m_DequeuePos & m_Mask];
+			if (slot.sequence.load(std::memory_order_acquire) != m_DequeuePos + 1)
+				return false;
+
+			outRecord = std::move(slot.record);
+			slot.sequence.store(m_DequeuePos + m_Mask + 1, std::memory_order_release);
+			++m_DequeuePos;
+			return true;
+		}
+
+		/* @brief Only exact from the consumer thread. Producers may be mid push. */
+		inline bool IsEmpty() const
+		{
+			const Slot& slot = m_Slots[m_DequeuePos & m_Mask];
+			return slot.sequence.load(std::memory_order_acquire) != m_DequeuePos + 1;
+		}
+
+		inline size_t Capacity() const { return m_Mask + 1; }
+
+	private:
+		/* Keeps the producer and consumer positions on separate cache lines */
+		static constexpr size_t CACHE_LINE_SIZE = 64;
+
+		struct Slot
+		{
+			std::atomic<size_t> sequence{ 0 };
+			TRecord record{};
+		};
+
+		std::unique_ptr<Slot[]> m_Slots{ nullptr };
+		size_t m_Mask{ 0 };
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_EnqueuePos{ 0 };
+		alignas(CACHE_LINE_SIZE) size_t m_DequeuePos{ 0 };
+	};
+
+}
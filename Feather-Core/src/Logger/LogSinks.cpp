@@ -0,0 +1,142 @@
+#include "Logger/LogSinks.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+
+constexpr WORD GREEN = 2;
+constexpr WORD RED = 4;
+constexpr WORD YELLOW = 6;
+constexpr WORD WHITE = 7;
+#endif
+
+namespace fs = std::filesystem;
+
+namespace Feather {
+
+	void ConsoleLogSink::Write(LogEntry::LogType type, std::string_view line)
+	{
+#ifdef _WIN32
+		WORD color{ WHITE };
+		switch (type)
+		{
+		case LogEntry::LogType::INFO: color = GREEN; break;
+		case LogEntry::LogType::WARN: color = YELLOW; break;
+		case LogEntry::LogType::ERR:
+		case LogEntry::LogType::CRITICAL: color = RED; break;
+		default: break;
+		}
+
+		HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+		SetConsoleTextAttribute(hConsole, color);
+		std::cout << line << "\n";
+		SetConsoleTextAttribute(hConsole, WHITE);
+#else
+		const char* color{ "\033[0m" };
+		switch (type)
+		{
+		case LogEntry::LogType::INFO: color = "\033[32m"; break;
+		case LogEntry::LogType::WARN: color = "\033[33m"; break;
+		case LogEntry::LogType::ERR:
+		case LogEntry::LogType::CRITICAL: color = "\033[31m"; break;
+		default: break;
+		}
+
+		std::cout << color << line << "\033[0m\n";
+#endif
+	}
+
+	void ConsoleLogSink::Flush()
+	{
+		std::cout.flush();
+	}
+
+	RotatingFileLogSink::RotatingFileLogSink(const std::string& filepath, size_t maxFileSize, size_t maxFiles)
+		: m_Filepath{ filepath }
+		, m_MaxFileSize{ maxFileSize }
+		, m_MaxFiles{ maxFiles }
+	{
+		std::error_code ec;
+		m_FileSize = fs::exists(m_Filepath, ec) ? static_cast<size_t>(fs::file_size(m_Filepath, ec)) : 0;
+		m_File.open(m_Filepath, std::ios::app);
+
+		if (!m_File)
+			std::cout << "Failed to open log file: " << m_Filepath << std::endl;
+	}
+
+	void RotatingFileLogSink::Write(LogEntry::LogType type, std::string_view line)
+	{
+		if (!m_File)
+			return;
+
+		if (m_MaxFileSize > 0 && m_FileSize + line.size() + 1 > m_MaxFileSize)
+			Rotate();
+
+		m_File << line << "\n";
+		m_FileSize += line.size() + 1;
+	}
+
+	void RotatingFileLogSink::Flush()
+	{
+		if (m_File)
+			m_File.flush();
+	}
+
+	void RotatingFileLogSink::Rotate()
+	{
+		m_File.close();
+
+		std::error_code ec;
+		if (m_MaxFiles > 0)
+		{
+			// Shift filename.N-1 -> filename.N, the oldest file is overwritten
+			for (size_t i = m_MaxFiles - 1; i > 0; i--)
+			{
+				fs::path source{ std::format("{}.{}", m_Filepath, i) };
+				if (fs::exists(source, ec))
+					fs::rename(source, std::format("{}.{}", m_Filepath, i + 1), ec);
+			}
+
+			fs::rename(m_Filepath, m_Filepath + ".1", ec);
+		}
+
+		m_File.open(m_Filepath, std::ios::trunc);
+		m_FileSize = 0;
+	}
+
+	HistoryLogSink::HistoryLogSink(size_t capacity)
+		: m_Entries(capacity > 0 ? capacity : 1)
+	{}
+
+	void HistoryLogSink::Write(LogEntry::LogType type, std::string_view line)
+	{
+		std::scoped_lock lock{ m_Mutex };
+
+		auto& entry = m_Entries[m_NextSequence % m_Entries.size()];
+		entry.type = type;
+		entry.log.assign(line);
+
+		++m_NextSequence;
+		m_Count = std::min(m_Count + 1, m_Entries.size());
+	}
+
+	uint64_t HistoryLogSink::CopyLogs(uint64_t sequence, std::vector<LogEntry>& outLogs) const
+	{
+		std::scoped_lock lock{ m_Mutex };
+
+		uint64_t oldestSequence = m_NextSequence - m_Count;
+		for (uint64_t i = std::max(sequence, oldestSequence); i < m_NextSequence; i++)
+		{
+			outLogs.push_back(m_Entries[i % m_Entries.size()]);
+		}
+
+		return m_NextSequence;
+	}
+
+	void HistoryLogSink::Clear()
+	{
+		std::scoped_lock lock{ m_Mutex };
+		// Keep the sequence increasing so readers do not re-read entries written after the clear
+		m_Count = 0;
+	}
+
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string_view>
+
+namespace Feather {
+
+	struct LogEntry
+	{
+		enum class LogType
+		{
+			TRACE,
+			INFO,
+			WARN,
+			ERR,
+			CRITICAL,
+			NONE
+		};
+		LogType type{ LogType::TRACE };
+		std::string log{};
+	};
+
+	/*
+	* @brief Destination for formatted log lines.
+	* Sinks are only written to from the logger thread, so they do not need to be thread safe
+	* unless they are also read from another thread.
+	*/
+	class ILogSink
+	{
+	public:
+		virtual ~ILogSink() = default;
+
+		/*
+		* @brief Writes a single formatted line. The line does not end with a newline.
+		*/
+		virtual void Write(LogEntry::LogType type, std::string_view line) = 0;
+		/*
+		* @brief Called once the logger thread has drained the queue.
+		*/
+		virtual void Flush() {}
+	};
+
+	/*
+	* @brief Writes colored log lines to the console.
+	*/
+	class ConsoleLogSink : public ILogSink
+	{
+	public:
+		virtual void Write(LogEntry::LogType type, std::string_view line) override;
+		virtual void Flush() override;
+	};
+
+	/*
+	* @brief Writes log lines to a file, rolling it over to filename.1, filename.2, ... once it reaches the max size.
+	*/
+	class RotatingFileLogSink : public ILogSink
+	{
+	public:
+		RotatingFileLogSink(const std::string& filepath, size_t maxFileSize, size_t maxFiles);
+
+		virtual void Write(LogEntry::LogType type, std::string_view line) override;
+		virtual void Flush() override;
+
+	private:
+		void Rotate();
+
+	private:
+		std::string m_Filepath;
+		std::ofstream m_File;
+		size_t m_FileSize{ 0 };
+		size_t m_MaxFileSize;
+		size_t m_MaxFiles;
+	};
+
+	/*
+	* @brief Keeps the most recent log entries in a ring buffer for the editor log display.
+	* Every entry gets an increasing sequence number so readers can fetch only what they have not seen.
+	*/
+	class HistoryLogSink : public ILogSink
+	{
+	public:
+		explicit HistoryLogSink(size_t capacity);
+
+		virtual void Write(LogEntry::LogType type, std::string_view line) override;
+
+		/*
+		* @brief Appends the retained entries starting at the sequence to the logs.
+		* Entries that have already been overwritten are skipped.
+		* @return The sequence to pass in on the next call.
+		*/
+		uint64_t CopyLogs(uint64_t sequence, std::vector<LogEntry>& outLogs) const;
+		void Clear();
+
+		inline size_t Capacity() const { return m_Entries.size(); }
+
+	private:
+		mutable std::mutex m_Mutex;
+		std::vector<LogEntry> m_Entries;
+		/* Sequence of the next entry to be written. The oldest retained entry is m_NextSequence - m_Count */
+		uint64_t m_NextSequence{ 0 };
+		size_t m_Count{ 0 };
+	};
+
+}
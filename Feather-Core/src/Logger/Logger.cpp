@@ -1,19 +1,24 @@
 #include "Logger/Logger.h"
 
+#include <ctime>
+
 namespace Feather {
 
-	Log::LogTime::LogTime(const std::string& date)
-		: time{ date.substr(11, 8) }
-	{}
+	namespace {
 
-	std::string Log::CurrentDateTime()
-	{
-		auto time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+		const char* GetLogLabel(LogEntry::LogType type)
+		{
+			switch (type)
+			{
+			case LogEntry::LogType::TRACE: return "TRACE";
+			case LogEntry::LogType::INFO: return "INFO";
+			case LogEntry::LogType::WARN: return "WARN";
+			case LogEntry::LogType::ERR: return "ERROR";
+			case LogEntry::LogType::CRITICAL: return "CRIT";
+			default: return "NONE";
+			}
+		}
 
-		char buf[30];
-		ctime_s(buf, sizeof(buf), &time);
-		LogTime logTime{ std::string{ buf } };
-		return std::format("[{0}]", logTime.time);
 	}
 
 	Log& Log::GetInstance()
@@ -22,7 +27,17 @@ namespace Feather {
 		return instance;
 	}
 
+	Log::~Log()
+	{
+		Shutdown();
+	}
+
 	void Log::Init(bool consoleLog, bool retainLogs)
+	{
+		Init(LogConfig{ .consoleLog = consoleLog, .retainLogs = retainLogs });
+	}
+
+	void Log::Init(const LogConfig& config)
 	{
 		assert(!m_Initialized && "Don not call Initialize more than once!");
 
@@ -32,70 +47,119 @@ namespace Feather {
 			return;
 		}
 
-		m_ConsoleLog = consoleLog;
-		m_RetainLogs = retainLogs;
+		m_pQueue = std::make_unique<LogQueue<LogRecord>>(config.queueCapacity);
+		m_OverflowPolicy = config.overflowPolicy;
+
+		if (config.consoleLog)
+			m_Sinks.push_back(std::make_shared<ConsoleLogSink>());
+
+		if (config.retainLogs)
+		{
+			m_pHistory = std::make_shared<HistoryLogSink>(config.historyCapacity);
+			m_Sinks.push_back(m_pHistory);
+		}
+
+		if (!config.logFile.empty())
+			m_Sinks.push_back(std::make_shared<RotatingFileLogSink>(config.logFile, config.maxFileSize, config.maxFiles));
+
+		m_Running = true;
+		m_LoggerThread = std::thread([this] { Run(); });
 		m_Initialized = true;
 	}
 
-	void Log::LuaTrace(const std::string_view message)
+	void Log::Shutdown()
 	{
-		std::scoped_lock lock{ m_Mutex };
-		assert(m_Initialized && "Logger must be initialized before it is used!");
+		if (!m_Running.exchange(false))
+			return;
 
-		if (!m_Initialized)
+		m_WakeCounter.fetch_add(1);
+		m_WakeCounter.notify_one();
+
+		if (m_LoggerThread.joinable())
+			m_LoggerThread.join();
+
+		// Pushes that saw the logger running may still be adding their record
+		while (m_ActivePushers.load() > 0)
 		{
-			std::cout << "Logger must be initialized before it is used!" << std::endl;
-			return;
+			std::this_thread::yield();
 		}
 
-		std::stringstream ss;
-		ss << CurrentDateTime() << " Lua [TRACE]: " << message << "\n";
-
-		if (m_ConsoleLog)
+		// Pick up anything pushed while the logger thread was stopping
+		std::scoped_lock lock{ m_SinkMutex };
+		LogRecord record{};
+		while (m_pQueue->TryPop(record))
 		{
-			HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-			SetConsoleTextAttribute(hConsole, WHITE);
-			std::cout << ss.str();
-			SetConsoleTextAttribute(hConsole, WHITE);
+			WriteRecord(record);
 		}
 
-		if (m_RetainLogs)
+		for (const auto& pSink : m_Sinks)
 		{
-			m_LogEntries.emplace_back(LogEntry::LogType::TRACE, ss.str());
+			pSink->Flush();
 		}
 	}
 
-	void Log::LuaInfo(const std::string_view message)
+	void Log::Flush()
 	{
-		std::scoped_lock lock{ m_Mutex };
-		assert(m_Initialized && "Logger must be initialized before it is used!");
-
-		if (!m_Initialized)
-		{
-			std::cout << "Logger must be initialized before it is used!" << std::endl;
+		if (!m_Running || std::this_thread::get_id() == m_LoggerThread.get_id())
 			return;
-		}
 
-		std::stringstream ss;
-		ss << CurrentDateTime() << " Lua [INFO]: " << message << "\n";
+		uint64_t target = m_PushedCount.load();
+		WakeLogger();
 
-		if (m_ConsoleLog)
+		while (m_Running && m_WrittenCount.load() < target)
 		{
-			HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-			SetConsoleTextAttribute(hConsole, GREEN);
-			std::cout << ss.str();
-			SetConsoleTextAttribute(hConsole, WHITE);
+			std::this_thread::yield();
 		}
+	}
 
-		if (m_RetainLogs)
-		{
-			m_LogEntries.emplace_back(LogEntry::LogType::INFO, ss.str());
-		}
+	void Log::AddSink(std::shared_ptr<ILogSink> pSink)
+	{
+		std::scoped_lock lock{ m_SinkMutex };
+		m_Sinks.push_back(std::move(pSink));
+	}
+
+	void Log::RemoveSink(const std::shared_ptr<ILogSink>& pSink)
+	{
+		std::scoped_lock lock{ m_SinkMutex };
+		std::erase(m_Sinks, pSink);
+	}
+
+	void Log::LuaTrace(const std::string_view message)
+	{
+		Push(LogEntry::LogType::TRACE, ELogSource::Lua, std::string{ message });
+	}
+
+	void Log::LuaInfo(const std::string_view message)
+	{
+		Push(LogEntry::LogType::INFO, ELogSource::Lua, std::string{ message });
 	}
 
 	void Log::LuaWarn(const std::string_view message)
 	{
-		std::scoped_lock lock{ m_Mutex };
+		Push(LogEntry::LogType::WARN, ELogSource::Lua, std::string{ message });
+	}
+
+	void Log::LuaError(const std::string_view message)
+	{
+		Push(LogEntry::LogType::ERR, ELogSource::Lua, std::string{ message });
+	}
+
+	void Log::ClearLogs()
+	{
+		if (m_pHistory)
+			m_pHistory->Clear();
+	}
+
+	uint64_t Log::GetLogs(uint64_t sequence, std::vector<LogEntry>& outLogs) const
+	{
+		if (!m_pHistory)
+			return sequence;
+
+		return m_pHistory->CopyLogs(sequence, outLogs);
+	}
+
+	void Log::Push(LogEntry::LogType type, ELogSource source, std::string&& message)
+	{
 		assert(m_Initialized && "Logger must be initialized before it is used!");
 
 		if (!m_Initialized)
@@ -104,49 +168,151 @@ namespace Feather {
 			return;
 		}
 
-		std::stringstream ss;
-		ss << CurrentDateTime() << " Lua [WARN]: " << message << "\n";
+		LogRecord record{ .type = type,
+						  .source = source,
+						  .timestamp = std::chrono::system_clock::now().time_since_epoch().count(),
+						  .message = std::move(message) };
+
+		// Shutdown waits for every push that saw the logger running before it drains the queue, so no record is left behind
+		m_ActivePushers.fetch_add(1);
 
-		if (m_ConsoleLog)
+		// After shutdown there is no logger thread, write directly
+		if (!m_Running)
 		{
-			HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-			SetConsoleTextAttribute(hConsole, YELLOW);
-			std::cout << ss.str();
-			SetConsoleTextAttribute(hConsole, WHITE);
+			m_ActivePushers.fetch_sub(1);
+			std::scoped_lock lock{ m_SinkMutex };
+			WriteRecord(record);
+			return;
 		}
 
-		if (m_RetainLogs)
+		bool mustDeliver = type == LogEntry::LogType::ERR || type == LogEntry::LogType::CRITICAL ||
+						   m_OverflowPolicy.load(std::memory_order_relaxed) == ELogOverflowPolicy::Block;
+
+		// The logger thread cannot wait on itself to make room
+		if (mustDeliver && std::this_thread::get_id() == m_LoggerThread.get_id())
+			mustDeliver = false;
+
+		while (!m_pQueue->TryPush(std::move(record)))
 		{
-			m_LogEntries.emplace_back(LogEntry::LogType::WARN, ss.str());
+			if (!mustDeliver)
+			{
+				m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				m_ActivePushers.fetch_sub(1);
+				return;
+			}
+
+			// The logger thread stopped while the queue was full, write it once shutdown has drained the queue
+			if (!m_Running)
+			{
+				m_ActivePushers.fetch_sub(1);
+				std::scoped_lock lock{ m_SinkMutex };
+				WriteRecord(record);
+				return;
+			}
+
+			WakeLogger();
+			std::this_thread::yield();
 		}
+
+		m_PushedCount.fetch_add(1, std::memory_order_relaxed);
+		WakeLogger();
+		m_ActivePushers.fetch_sub(1);
 	}
 
-	void Log::LuaError(const std::string_view message)
+	void Log::WakeLogger()
 	{
-		std::scoped_lock lock{ m_Mutex };
-		assert(m_Initialized && "Logger must be initialized before it is used!");
-
-		if (!m_Initialized)
+		// Pairs with the fence in Run, either the logger sees the new record or we see that it is waiting
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_LoggerWaiting.load(std::memory_order_relaxed))
 		{
-			std::cout << "Logger must be initialized before it is used!" << std::endl;
-			return;
+			m_WakeCounter.fetch_add(1, std::memory_order_relaxed);
+			m_WakeCounter.notify_one();
 		}
+	}
 
-		std::stringstream ss;
-		ss << CurrentDateTime() << " Lua [ERROR]: " << message << "\n";
+	void Log::Run()
+	{
+		LogRecord record{};
 
-		if (m_ConsoleLog)
+		while (true)
 		{
-			HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-			SetConsoleTextAttribute(hConsole, RED);
-			std::cout << ss.str();
-			SetConsoleTextAttribute(hConsole, WHITE);
+			uint64_t numWritten{ 0 };
+			{
+				std::scoped_lock lock{ m_SinkMutex };
+				while (m_pQueue->TryPop(record))
+				{
+					WriteRecord(record);
+					++numWritten;
+				}
+
+				uint64_t numDropped = m_DroppedCount.load(std::memory_order_relaxed);
+				if (numDropped != m_ReportedDrops)
+				{
+					WriteRecord(LogRecord{ .type = LogEntry::LogType::WARN,
+										   .timestamp = std::chrono::system_clock::now().time_since_epoch().count(),
+										   .message = std::format("Dropped {} log messages: The log queue was full", numDropped - m_ReportedDrops) });
+					m_ReportedDrops = numDropped;
+				}
+
+				if (numWritten > 0)
+				{
+					for (const auto& pSink : m_Sinks)
+					{
+						pSink->Flush();
+					}
+				}
+			}
+
+			if (numWritten > 0)
+			{
+				m_WrittenCount.fetch_add(numWritten);
+				continue;
+			}
+
+			if (!m_Running)
+				break;
+
+			uint32_t wakeCount = m_WakeCounter.load();
+			m_LoggerWaiting.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (m_pQueue->IsEmpty() && m_Running)
+				m_WakeCounter.wait(wakeCount);
+
+			m_LoggerWaiting.store(false, std::memory_order_relaxed);
 		}
+	}
 
-		if (m_RetainLogs)
+	void Log::WriteRecord(const LogRecord& record)
+	{
+		std::string line = std::format("{} {} [{}]: {}",
+									   FormatTime(record.timestamp),
+									   record.source == ELogSource::Lua ? "Lua" : "Feather",
+									   GetLogLabel(record.type),
+									   record.message);
+
+		for (const auto& pSink : m_Sinks)
 		{
-			m_LogEntries.emplace_back(LogEntry::LogType::ERR, ss.str());
+			pSink->Write(record.type, line);
 		}
 	}
 
+	const std::string& Log::FormatTime(std::chrono::system_clock::rep timestamp)
+	{
+		auto seconds = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::duration{ timestamp }).count();
+		if (seconds == m_LastTimeSeconds)
+			return m_FormattedTime;
+
+		std::time_t time = static_cast<std::time_t>(seconds);
+		std::tm localTime{};
+#ifdef _WIN32
+		localtime_s(&localTime, &time);
+#else
+		localtime_r(&time, &localTime);
+#endif
+		m_FormattedTime = std::format("[{:02}:{:02}:{:02}]", localTime.tm_hour, localTime.tm_min, localTime.tm_sec);
+		m_LastTimeSeconds = seconds;
+		return m_FormattedTime;
+	}
+
 }
@@ -1,37 +1,69 @@
 #pragma once
 
+#include "Logger/LogSinks.h"
+#include "Logger/LogQueue.h"
+
 #include <string_view>
 #include <source_location>
 #include <cassert>
 
 namespace Feather {
 
-	struct LogEntry
+	enum class ELogOverflowPolicy
 	{
-		enum class LogType
-		{
-			TRACE,
-			INFO,
-			WARN,
-			ERR,
-			CRITICAL,
-			NONE
-		};
-		LogType type{ LogType::TRACE };
-		std::string log{};
+		/* The calling thread waits for the logger thread to make room */
+		Block,
+		/* The message is dropped and counted. Errors and critical messages always block */
+		DropNewest
 	};
 
+	struct LogConfig
+	{
+		bool consoleLog{ true };
+		bool retainLogs{ true };
+		/* Number of messages that can be waiting for the logger thread. Rounded up to a power of two */
+		size_t queueCapacity{ 8192 };
+		/* Number of entries kept for the editor log display */
+		size_t historyCapacity{ 10000 };
+		ELogOverflowPolicy overflowPolicy{ ELogOverflowPolicy::DropNewest };
+		/* Writes the logs to this file when set */
+		std::string logFile{};
+		size_t maxFileSize{ 5 * 1024 * 1024 };
+		size_t maxFiles{ 3 };
+	};
+
+	/*
+	* @brief Asynchronous logger.
+	* Callers only format the message and push it onto a lock-free queue. A background thread
+	* adds the timestamp and prefix and writes each message to the sinks.
+	*/
 	class Log
 	{
 	public:
 		static Log& GetInstance();
 
-		~Log() = default;
+		~Log();
 		// Make the logger non-copyable
 		Log(const Log&) = delete;
 		Log& operator=(const Log&) = delete;
 
 		void Init(bool consoleLog = true, bool retainLogs = true);
+		void Init(const LogConfig& config);
+
+		/*
+		* @brief Drains the queue and stops the logger thread. Messages logged afterwards are written synchronously.
+		*/
+		void Shutdown();
+		/*
+		* @brief Blocks until every message logged before the call has been written to the sinks.
+		*/
+		void Flush();
+
+		/*
+		* @brief Adds a sink that is written to from the logger thread.
+		*/
+		void AddSink(std::shared_ptr<ILogSink> pSink);
+		void RemoveSink(const std::shared_ptr<ILogSink>& pSink);
 
 		template <typename... Args>
 		void Trace(const std::string_view message, Args&&... args);
@@ -49,26 +81,72 @@ namespace Feather {
 		void LuaWarn(const std::string_view message);
 		void LuaError(const std::string_view message);
 
-		inline void ClearLogs() { m_LogEntries.clear(); }
-		inline const std::vector<LogEntry>& GetLogs() { return m_LogEntries; }
+		void ClearLogs();
+		/*
+		* @brief Appends the retained logs starting at the sequence to the logs.
+		* @return The sequence to pass in on the next call.
+		*/
+		uint64_t GetLogs(uint64_t sequence, std::vector<LogEntry>& outLogs) const;
+		inline size_t GetHistoryCapacity() const { return m_pHistory ? m_pHistory->Capacity() : 0; }
+
+		inline void SetOverflowPolicy(ELogOverflowPolicy policy) { m_OverflowPolicy = policy; }
+		inline ELogOverflowPolicy GetOverflowPolicy() const { return m_OverflowPolicy; }
+		/* @brief Number of messages dropped because the queue was full */
+		inline uint64_t GetDroppedCount() const { return m_DroppedCount.load(std::memory_order_relaxed); }
 
 	private:
-		std::mutex m_Mutex;
-		std::vector<LogEntry> m_LogEntries;
+		enum class ELogSource : uint8_t
+		{
+			Feather,
+			Lua
+		};
 
-		bool m_Initialized{ false };
-		bool m_ConsoleLog{ true };
-		bool m_RetainLogs{ true };
+		struct LogRecord
+		{
+			LogEntry::LogType type{ LogEntry::LogType::NONE };
+			ELogSource source{ ELogSource::Feather };
+			/* system_clock ticks when the message was logged */
+			std::chrono::system_clock::rep timestamp{ 0 };
+			std::string message{};
+		};
 
 		Log() = default;
 
-		struct LogTime
-		{
-			std::string time;
-			LogTime(const std::string& date);
-		};
+		void Push(LogEntry::LogType type, ELogSource source, std::string&& message);
+		void Run();
+		void WriteRecord(const LogRecord& record);
+		void WakeLogger();
+
+		const std::string& FormatTime(std::chrono::system_clock::rep timestamp);
+
+	private:
+		std::unique_ptr<LogQueue<LogRecord>> m_pQueue{ nullptr };
+		std::thread m_LoggerThread;
+
+		/* Guards the sinks. Only contended when sinks are added or removed */
+		std::mutex m_SinkMutex;
+		std::vector<std::shared_ptr<ILogSink>> m_Sinks;
+		std::shared_ptr<HistoryLogSink> m_pHistory{ nullptr };
+
+		std::atomic_bool m_Running{ false };
+		/* Pushes in progress, Shutdown waits for them before its last drain */
+		std::atomic<uint32_t> m_ActivePushers{ 0 };
+		/* Set while the logger thread waits on m_WakeCounter, producers only notify when it is set */
+		std::atomic_bool m_LoggerWaiting{ false };
+		std::atomic<uint32_t> m_WakeCounter{ 0 };
+
+		std::atomic<uint64_t> m_PushedCount{ 0 };
+		std::atomic<uint64_t> m_WrittenCount{ 0 };
+		std::atomic<uint64_t> m_DroppedCount{ 0 };
+		/* Drops already reported by the logger thread */
+		uint64_t m_ReportedDrops{ 0 };
+
+		std::atomic<ELogOverflowPolicy> m_OverflowPolicy{ ELogOverflowPolicy::DropNewest };
+		bool m_Initialized{ false };
 
-		std::string CurrentDateTime();
+		/* The time only changes once a second, so the formatted string is reused */
+		std::chrono::system_clock::rep m_LastTimeSeconds{ -1 };
+		std::string m_FormattedTime{};
 	};
 
 }
@@ -90,7 +168,9 @@ namespace Feather {
 #define F_ASSERT(x) assert(x)
 
 #define F_INIT_LOGS(console, retain)	Feather::Log::GetInstance().Init(console, retain)
-#define F_GET_LOGS()					Feather::Log::GetInstance().GetLogs()
+#define F_INIT_LOGS_CONFIG(...)			Feather::Log::GetInstance().Init(__VA_ARGS__)
+#define F_GET_LOGS(sequence, logs)		Feather::Log::GetInstance().GetLogs(sequence, logs)
 #define F_CLEAR_LOGS()					Feather::Log::GetInstance().ClearLogs()
+#define F_FLUSH_LOGS()					Feather::Log::GetInstance().Flush()
 
 #include "Logger/Logger.inl"
@@ -6,106 +6,131 @@
 
 namespace Feather {
 
-	void ContactListener::BeginContact(b2Contact* contact)
-	{
-		auto* fixtureA = contact->GetFixtureA();
-		auto* fixtureB = contact->GetFixtureB();
+	namespace {
+
+		/* Starting capacity of the contact buffer, grows as needed and keeps its size between frames */
+		constexpr size_t INITIAL_CONTACT_CAPACITY = 256;
 
-		if (!fixtureA || !fixtureB || !fixtureA->GetUserData().pointer || !fixtureB->GetUserData().pointer)
+		UserData* GetObjectUserData(b2Fixture* fixture)
 		{
-			SetUserContacts(nullptr, nullptr);
-			return;
-		}
+			if (!fixture || !fixture->GetUserData().pointer)
+				return nullptr;
 
-		UserData* a_data = reinterpret_cast<UserData*>(fixtureA->GetUserData().pointer);
-		UserData* b_data = reinterpret_cast<UserData*>(fixtureB->GetUserData().pointer);
+			UserData* userData = reinterpret_cast<UserData*>(fixture->GetUserData().pointer);
 
-		constexpr auto expectedType = entt::type_hash<ObjectData>::value();
+			constexpr auto expectedType = entt::type_hash<ObjectData>::value();
+			if (!userData || userData->type_id != expectedType)
+				return nullptr;
 
-		if (!a_data || !b_data || a_data->type_id != expectedType || b_data->type_id != expectedType)
-		{
-			SetUserContacts(nullptr, nullptr);
-			return;
+			return userData;
 		}
 
-		try
+		ObjectData* GetObjectData(UserData* userData)
 		{
-			auto* a_any = std::any_cast<ObjectData>(&a_data->userData);
-			auto* b_any = std::any_cast<ObjectData>(&b_data->userData);
+			return userData ? std::any_cast<ObjectData>(&userData->userData) : nullptr;
+		}
 
-			a_any->AddContact(b_any);
-			b_any->AddContact(a_any);
+	}
 
-			SetUserContacts(a_data, b_data);
-		}
-		catch (const std::bad_any_cast& ex)
-		{
-			// Ignore this exception for now
-			//F_ERROR("Failed to cast user contacts: {}", ex.what());
-			SetUserContacts(nullptr, nullptr);
-		}
+	ContactListener::ContactListener()
+		: m_RecordFilter{ CONTACT_FILTER_NONE }
+		, m_ContactFilter{ static_cast<uint32_t>(EContactType::Begin) | static_cast<uint32_t>(EContactType::End) }
+	{
+		m_Contacts.reserve(INITIAL_CONTACT_CAPACITY);
 	}
 
-	void ContactListener::EndContact(b2Contact* contact)
+	void ContactListener::BeginContact(b2Contact* contact)
 	{
-		auto* fixtureA = contact->GetFixtureA();
-		auto* fixtureB = contact->GetFixtureB();
+		UserData* a_data = GetObjectUserData(contact->GetFixtureA());
+		UserData* b_data = GetObjectUserData(contact->GetFixtureB());
 
-		if (!fixtureA || !fixtureB || !fixtureA->GetUserData().pointer || !fixtureB->GetUserData().pointer)
+		auto* a_object = GetObjectData(a_data);
+		auto* b_object = GetObjectData(b_data);
+		if (!a_object || !b_object)
 		{
 			SetUserContacts(nullptr, nullptr);
 			return;
 		}
 
-		UserData* a_data = reinterpret_cast<UserData*>(fixtureA->GetUserData().pointer);
-		UserData* b_data = reinterpret_cast<UserData*>(fixtureB->GetUserData().pointer);
+		a_object->AddContact(b_object);
+		b_object->AddContact(a_object);
 
-		constexpr auto expectedType = entt::type_hash<ObjectData>::value();
+		SetUserContacts(a_data, b_data);
 
-		if (!a_data || !b_data || a_data->type_id != expectedType || b_data->type_id != expectedType)
+		if (IsRecorded(EContactType::Begin))
+			RecordContact(contact, *a_object, *b_object, EContactType::Begin);
+	}
+
+	void ContactListener::EndContact(b2Contact* contact)
+	{
+		SetUserContacts(nullptr, nullptr);
+
+		auto* a_object = GetObjectData(GetObjectUserData(contact->GetFixtureA()));
+		auto* b_object = GetObjectData(GetObjectUserData(contact->GetFixtureB()));
+
+		if (!a_object && b_object)
 		{
-			SetUserContacts(nullptr, nullptr);
+			b_object->ClearContacts();
 			return;
 		}
 
-		try
+		if (a_object && !b_object)
 		{
-			auto* a_any = std::any_cast<ObjectData>(&a_data->userData);
-			auto* b_any = std::any_cast<ObjectData>(&b_data->userData);
-			if (!a_any && b_any)
-			{
-				b_any->ClearContacts();
-				SetUserContacts(nullptr, nullptr);
-				return;
-			}
-
-			if (a_any && !b_any)
-			{
-				a_any->ClearContacts();
-				SetUserContacts(nullptr, nullptr);
-				return;
-			}
-
-			a_any->RemoveContact(b_any);
-			b_any->RemoveContact(a_any);
-		}
-		catch (const std::bad_any_cast& ex)
-		{
-			// Ignore this exception for now
-			//F_ERROR("Failed to cast user contacts: {}", ex.what());
+			a_object->ClearContacts();
+			return;
 		}
 
-		SetUserContacts(nullptr, nullptr);
+		if (!a_object || !b_object)
+			return;
+
+		a_object->RemoveContact(b_object);
+		b_object->RemoveContact(a_object);
+
+		if (IsRecorded(EContactType::End))
+			RecordContact(contact, *a_object, *b_object, EContactType::End);
 	}
 
 	void ContactListener::PostSolve(b2Contact* contact, const b2ContactImpulse* impulse)
 	{
-		// TODO: Could make some sol::functions that could be setup to be used
+		if (!IsRecorded(EContactType::PostSolve))
+			return;
+
+		auto* a_object = GetObjectData(GetObjectUserData(contact->GetFixtureA()));
+		auto* b_object = GetObjectData(GetObjectUserData(contact->GetFixtureB()));
+		if (!a_object || !b_object)
+			return;
+
+		float maxImpulse{ 0.0f };
+		for (int i = 0; i < impulse->count; i++)
+		{
+			maxImpulse = std::max(maxImpulse, impulse->normalImpulses[i]);
+		}
+
+		RecordContact(contact, *a_object, *b_object, EContactType::PostSolve, maxImpulse);
 	}
 
 	void ContactListener::PreSolve(b2Contact* contact, const b2Manifold* oldManifold)
 	{
-		// TODO: Could make some sol::functions that could be setup to be used
+		if (!IsRecorded(EContactType::PreSolve))
+			return;
+
+		auto* a_object = GetObjectData(GetObjectUserData(contact->GetFixtureA()));
+		auto* b_object = GetObjectData(GetObjectUserData(contact->GetFixtureB()));
+		if (a_object && b_object)
+			RecordContact(contact, *a_object, *b_object, EContactType::PreSolve);
+	}
+
+	void ContactListener::RecordContact(b2Contact* contact, const ObjectData& a_object, const ObjectData& b_object, EContactType type, float impulse)
+	{
+		b2WorldManifold worldManifold{};
+		worldManifold.normal.SetZero();
+		contact->GetWorldManifold(&worldManifold);
+
+		m_Contacts.push_back(ContactRecord{ .entityA = a_object.entityID,
+											.entityB = b_object.entityID,
+											.type = type,
+											.normal = glm::vec2{ worldManifold.normal.x, worldManifold.normal.y },
+											.impulse = impulse });
 	}
 
 	void ContactListener::SetUserContacts(UserData* a, UserData* b)
@@ -3,26 +3,82 @@
 #include "Box2DWrappers.h"
 #include "UserData.h"
 
+#include <glm/glm.hpp>
+
 namespace Feather {
 
+	/* Kind of contact callback a record came from. Values are bit flags so they can be combined into a filter */
+	enum class EContactType : uint32_t
+	{
+		Begin = 1 << 0,
+		End = 1 << 1,
+		PreSolve = 1 << 2,
+		PostSolve = 1 << 3,
+	};
+
+	constexpr uint32_t CONTACT_FILTER_NONE = 0;
+	constexpr uint32_t CONTACT_FILTER_ALL = 0xF;
+
+	/*
+	* @brief A single contact between two bodies, recorded during a physics step.
+	*/
+	struct ContactRecord
+	{
+		std::uint32_t entityA{ entt::null };
+		std::uint32_t entityB{ entt::null };
+		EContactType type{ EContactType::Begin };
+		/* World space normal pointing from A to B. Zero for End contacts that no longer touch */
+		glm::vec2 normal{ 0.0f };
+		/* Largest normal impulse of the contact points. Only set for PostSolve contacts */
+		float impulse{ 0.0f };
+	};
+
+	/*
+	* @brief Records every contact of the physics steps in a frame into a reused buffer.
+	* Only the contact types enabled in the record filter are stored, so contacts nobody listens to cost nothing
+	* beyond the contact tracking of the ObjectData.
+	*/
 	class ContactListener : public b2ContactListener
 	{
 	public:
+		ContactListener();
+
 		void BeginContact(b2Contact* contact) override;
 		void EndContact(b2Contact* contact) override;
 
 		void PostSolve(b2Contact* contact, const b2ContactImpulse* impulse) override;
 		void PreSolve(b2Contact* contact, const b2Manifold* oldManifold) override;
 
+		/*
+		* @brief Sets which contact types are recorded. Set by the physics system from the contact filter
+		* and the event handlers that are connected.
+		*/
+		inline void SetRecordFilter(uint32_t filter) { m_RecordFilter = filter; }
+		inline uint32_t GetRecordFilter() const { return m_RecordFilter; }
+
+		/*
+		* @brief Sets the contact types sent to ContactBatchEvent handlers. Defaults to Begin and End.
+		*/
+		inline void SetContactFilter(uint32_t filter) { m_ContactFilter = filter; }
+		inline uint32_t GetContactFilter() const { return m_ContactFilter; }
+
+		inline std::vector<ContactRecord>& GetContacts() { return m_Contacts; }
+
+		/* Bodies of the most recent contact that began, cleared when any contact ends. Use ContactBatchEvent for every contact */
 		UserData* GetUserDataA() { return m_UserDataA; }
 		UserData* GetUserDataB() { return m_UserDataB; }
 
 	private:
+		inline bool IsRecorded(EContactType type) const { return (m_RecordFilter & static_cast<uint32_t>(type)) != 0; }
+		void RecordContact(b2Contact* contact, const ObjectData& a_object, const ObjectData& b_object, EContactType type, float impulse = 0.0f);
 		void SetUserContacts(UserData* a, UserData* b);
 
 	private:
+		std::vector<ContactRecord> m_Contacts;
 		UserData* m_UserDataA{ nullptr };
 		UserData* m_UserDataB{ nullptr };
+		uint32_t m_RecordFilter;
+		uint32_t m_ContactFilter;
 	};
 
 }
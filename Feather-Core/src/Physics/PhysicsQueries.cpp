@@ -0,0 +1,298 @@
+#include "PhysicsQueries.h"
+
+#include "UserData.h"
+#include "Core/CoreUtils/CoreEngineData.h"
+#include "Utils/JobSystem.h"
+
+#include <box2d/b2_distance.h>
+
+namespace Feather {
+
+	namespace {
+
+		/* Number of queries handed to a job, casts are cheap so a job needs a few of them */
+		constexpr size_t QUERY_GRAIN_SIZE = 32;
+		/* Batches smaller than this run on the calling thread */
+		constexpr size_t MIN_PARALLEL_QUERIES = 2 * QUERY_GRAIN_SIZE;
+
+		std::uint32_t GetEntityID(b2Fixture* fixture)
+		{
+			UserData* pData = reinterpret_cast<UserData*>(fixture->GetUserData().pointer);
+			if (!pData || pData->type_id != entt::type_hash<ObjectData>::value())
+				return entt::null;
+
+			const auto* pObjectData = std::any_cast<ObjectData>(&pData->userData);
+			return pObjectData ? pObjectData->entityID : static_cast<std::uint32_t>(entt::null);
+		}
+
+		/* Keeps the closest fixture along the ray */
+		class ClosestRayCallback : public b2RayCastCallback
+		{
+		public:
+			float ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float fraction) override
+			{
+				std::uint32_t entityID = GetEntityID(fixture);
+				if (entityID == entt::null)
+					return -1.0f;
+
+				m_EntityID = entityID;
+				m_Point = point;
+				m_Normal = normal;
+				m_Fraction = fraction;
+
+				// Clip the ray so only closer fixtures are reported
+				return fraction;
+			}
+
+			inline bool IsHit() const { return m_EntityID != entt::null; }
+
+		public:
+			std::uint32_t m_EntityID{ entt::null };
+			b2Vec2 m_Point{ 0.0f, 0.0f };
+			b2Vec2 m_Normal{ 0.0f, 0.0f };
+			float m_Fraction{ 1.0f };
+		};
+
+		/* Collects the fixtures whose bounding boxes overlap the queried box */
+		class FixtureQueryCallback : public b2QueryCallback
+		{
+		public:
+			explicit FixtureQueryCallback(std::vector<b2Fixture*>& fixtures)
+				: m_Fixtures{ fixtures }
+			{}
+
+			bool ReportFixture(b2Fixture* fixture) override
+			{
+				m_Fixtures.push_back(fixture);
+				return true;
+			}
+
+		private:
+			std::vector<b2Fixture*>& m_Fixtures;
+		};
+
+		/* Candidate fixtures of the query being run on this thread, reused between queries */
+		thread_local std::vector<b2Fixture*> t_CandidateFixtures;
+
+	}
+
+	glm::vec2 PhysicsQueryBatch::PixelSpace::ToPixels(const b2Vec2& point) const
+	{
+		return glm::vec2{ (point.x + halfScaledSize.x) * metersToPixels, (point.y + halfScaledSize.y) * metersToPixels };
+	}
+
+	b2Vec2 PhysicsQueryBatch::ToWorld(const glm::vec2& point) const
+	{
+		auto& coreGlobals = CoreEngineData::GetInstance();
+		const float M2P = coreGlobals.MetersToPixels();
+
+		return b2Vec2{ (point.x / M2P) - coreGlobals.ScaledWidth() * 0.5f, (point.y / M2P) - coreGlobals.ScaledHeight() * 0.5f };
+	}
+
+	size_t PhysicsQueryBatch::AddRayCast(const glm::vec2& start, const glm::vec2& end)
+	{
+		m_Queries.push_back(Query{ .type = EPhysicsQueryType::RayCast, .start = ToWorld(start), .end = ToWorld(end) });
+		return m_Queries.size() - 1;
+	}
+
+	size_t PhysicsQueryBatch::AddOverlap(const glm::vec2& lowerBounds, const glm::vec2& upperBounds)
+	{
+		m_Queries.push_back(Query{ .type = EPhysicsQueryType::Overlap,
+								   .start = ToWorld(glm::min(lowerBounds, upperBounds)),
+								   .end = ToWorld(glm::max(lowerBounds, upperBounds)) });
+		return m_Queries.size() - 1;
+	}
+
+	size_t PhysicsQueryBatch::AddCircleCast(const glm::vec2& start, const glm::vec2& end, float radius)
+	{
+		m_Queries.push_back(Query{ .type = EPhysicsQueryType::CircleCast,
+								   .start = ToWorld(start),
+								   .end = ToWorld(end),
+								   .radius = radius / CoreEngineData::GetInstance().MetersToPixels() });
+		return m_Queries.size() - 1;
+	}
+
+	void PhysicsQueryBatch::Execute(const b2World& world, JobSystem* pJobSystem)
+	{
+		auto& coreGlobals = CoreEngineData::GetInstance();
+		m_PixelSpace = PixelSpace{ .metersToPixels = coreGlobals.MetersToPixels(),
+								   .halfScaledSize = b2Vec2{ coreGlobals.ScaledWidth() * 0.5f, coreGlobals.ScaledHeight() * 0.5f } };
+
+		m_Results.assign(m_Queries.size(), QueryResult{});
+		m_Hits.clear();
+
+		if (!pJobSystem || m_Queries.size() < MIN_PARALLEL_QUERIES)
+		{
+			RunQueries(world, 0, m_Queries.size(), m_Hits);
+			return;
+		}
+
+		size_t numChunks = (m_Queries.size() + QUERY_GRAIN_SIZE - 1) / QUERY_GRAIN_SIZE;
+		if (m_ChunkHits.size() < numChunks)
+			m_ChunkHits.resize(numChunks);
+
+		pJobSystem->ParallelFor(m_Queries.size(), QUERY_GRAIN_SIZE, [this, &world](size_t begin, size_t end) {
+			auto& chunkHits = m_ChunkHits[begin / QUERY_GRAIN_SIZE];
+			chunkHits.clear();
+			RunQueries(world, begin, end, chunkHits);
+		});
+
+		// The chunks stored hit indices relative to their own buffer
+		for (size_t chunk = 0; chunk < numChunks; chunk++)
+		{
+			uint32_t hitOffset = static_cast<uint32_t>(m_Hits.size());
+			size_t begin = chunk * QUERY_GRAIN_SIZE;
+			size_t end = std::min(begin + QUERY_GRAIN_SIZE, m_Queries.size());
+
+			for (size_t i = begin; i < end; i++)
+			{
+				m_Results[i].firstHit += hitOffset;
+			}
+
+			m_Hits.insert(m_Hits.end(), m_ChunkHits[chunk].begin(), m_ChunkHits[chunk].end());
+		}
+	}
+
+	void PhysicsQueryBatch::Clear()
+	{
+		m_Queries.clear();
+		m_Results.clear();
+		m_Hits.clear();
+	}
+
+	size_t PhysicsQueryBatch::GetNumHits(size_t queryIndex) const
+	{
+		return queryIndex < m_Results.size() ? m_Results[queryIndex].numHits : 0;
+	}
+
+	const PhysicsQueryHit* PhysicsQueryBatch::GetHit(size_t queryIndex, size_t hitIndex) const
+	{
+		if (hitIndex >= GetNumHits(queryIndex))
+			return nullptr;
+
+		return &m_Hits[m_Results[queryIndex].firstHit + hitIndex];
+	}
+
+	std::span<const PhysicsQueryHit> PhysicsQueryBatch::GetHits(size_t queryIndex) const
+	{
+		size_t numHits = GetNumHits(queryIndex);
+		if (numHits == 0)
+			return {};
+
+		return std::span<const PhysicsQueryHit>{ m_Hits.data() + m_Results[queryIndex].firstHit, numHits };
+	}
+
+	void PhysicsQueryBatch::RunQueries(const b2World& world, size_t begin, size_t end, std::vector<PhysicsQueryHit>& outHits)
+	{
+		auto& candidates = t_CandidateFixtures;
+
+		for (size_t i = begin; i < end; i++)
+		{
+			const auto& query = m_Queries[i];
+			auto& result = m_Results[i];
+			result.firstHit = static_cast<uint32_t>(outHits.size());
+
+			switch (query.type)
+			{
+			case EPhysicsQueryType::RayCast:
+			{
+				// Box2D asserts on zero length rays
+				if ((query.end - query.start).LengthSquared() <= b2_epsilon * b2_epsilon)
+					break;
+
+				ClosestRayCallback callback{};
+				world.RayCast(&callback, query.start, query.end);
+
+				if (callback.IsHit())
+				{
+					outHits.push_back(PhysicsQueryHit{ .entityID = callback.m_EntityID,
+													   .point = m_PixelSpace.ToPixels(callback.m_Point),
+													   .normal = glm::vec2{ callback.m_Normal.x, callback.m_Normal.y },
+													   .fraction = callback.m_Fraction });
+				}
+				break;
+			}
+			case EPhysicsQueryType::Overlap:
+			{
+				b2AABB aabb{ query.start, query.end };
+				candidates.clear();
+				FixtureQueryCallback callback{ candidates };
+				world.QueryAABB(&callback, aabb);
+
+				// The broadphase only compares bounding boxes, test the actual shapes against the box
+				b2PolygonShape box{};
+				box.SetAsBox(std::max((query.end.x - query.start.x) * 0.5f, b2_linearSlop), std::max((query.end.y - query.start.y) * 0.5f, b2_linearSlop));
+				b2Transform boxTransform{ aabb.GetCenter(), b2Rot{ 0.0f } };
+
+				for (auto* pFixture : candidates)
+				{
+					std::uint32_t entityID = GetEntityID(pFixture);
+					if (entityID == entt::null)
+						continue;
+
+					const auto* pBody = pFixture->GetBody();
+					if (!b2TestOverlap(pFixture->GetShape(), 0, &box, 0, pBody->GetTransform(), boxTransform))
+						continue;
+
+					outHits.push_back(PhysicsQueryHit{ .entityID = entityID, .point = m_PixelSpace.ToPixels(pBody->GetPosition()) });
+				}
+				break;
+			}
+			case EPhysicsQueryType::CircleCast:
+			{
+				b2Vec2 radius{ query.radius, query.radius };
+				b2AABB sweptBounds{ b2Min(query.start, query.end) - radius, b2Max(query.start, query.end) + radius };
+
+				candidates.clear();
+				FixtureQueryCallback callback{ candidates };
+				world.QueryAABB(&callback, sweptBounds);
+
+				b2CircleShape circle{};
+				circle.m_radius = query.radius;
+
+				b2ShapeCastInput input{};
+				input.proxyB.Set(&circle, 0);
+				input.transformB = b2Transform{ query.start, b2Rot{ 0.0f } };
+				input.translationB = query.end - query.start;
+
+				PhysicsQueryHit closestHit{};
+				closestHit.fraction = 2.0f;
+
+				for (auto* pFixture : candidates)
+				{
+					std::uint32_t entityID = GetEntityID(pFixture);
+					if (entityID == entt::null)
+						continue;
+
+					input.proxyA.Set(pFixture->GetShape(), 0);
+					input.transformA = pFixture->GetBody()->GetTransform();
+
+					b2ShapeCastOutput output{};
+					if (b2ShapeCast(&output, &input))
+					{
+						if (output.lambda < closestHit.fraction)
+						{
+							closestHit = PhysicsQueryHit{ .entityID = entityID,
+														  .point = m_PixelSpace.ToPixels(output.point),
+														  .normal = glm::vec2{ output.normal.x, output.normal.y },
+														  .fraction = output.lambda };
+						}
+					}
+					else if (b2TestOverlap(pFixture->GetShape(), 0, &circle, 0, input.transformA, input.transformB))
+					{
+						// Started inside the shape
+						closestHit = PhysicsQueryHit{ .entityID = entityID, .point = m_PixelSpace.ToPixels(query.start) };
+					}
+				}
+
+				if (closestHit.entityID != entt::null)
+					outHits.push_back(closestHit);
+				break;
+			}
+			}
+
+			result.numHits = static_cast<uint32_t>(outHits.size()) - result.firstHit;
+		}
+	}
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Box2DWrappers.h"
+
+#include <glm/glm.hpp>
+#include <entt.hpp>
+#include <span>
+
+namespace Feather {
+
+	class JobSystem;
+
+	enum class EPhysicsQueryType : uint8_t
+	{
+		RayCast,
+		Overlap,
+		CircleCast,
+	};
+
+	/*
+	* @brief Compact result of a physics query. Positions are in pixels, like the transforms.
+	*/
+	struct PhysicsQueryHit
+	{
+		std::uint32_t entityID{ entt::null };
+		/* Hit point for casts, the body position for overlaps */
+		glm::vec2 point{ 0.0f };
+		/* Surface normal at the hit point. Zero for overlaps and casts that start inside a shape */
+		glm::vec2 normal{ 0.0f };
+		/* Fraction of the way from the start to the end of the cast. Zero for overlaps */
+		float fraction{ 0.0f };
+	};
+
+	/*
+	* @brief Runs many ray casts, AABB overlaps and circle casts against a physics world at once.
+	* Queries are added, executed together and their hits read back by query index. The buffers keep their
+	* capacity when cleared, so a batch that is reused every frame does not allocate.
+	* The world is only read, so the queries may be spread over the job system, but never while it is being stepped.
+	* Only fixtures with ObjectData user data are reported.
+	*/
+	class PhysicsQueryBatch
+	{
+	public:
+		PhysicsQueryBatch() = default;
+
+		/*
+		* @brief Adds a ray cast that reports the closest fixture between start and end.
+		* @return Index of the query.
+		*/
+		size_t AddRayCast(const glm::vec2& start, const glm::vec2& end);
+
+		/*
+		* @brief Adds a query that reports every fixture overlapping the box.
+		* @return Index of the query.
+		*/
+		size_t AddOverlap(const glm::vec2& lowerBounds, const glm::vec2& upperBounds);
+
+		/*
+		* @brief Adds a cast of a circle from start to end that reports the first fixture it touches.
+		* @return Index of the query.
+		*/
+		size_t AddCircleCast(const glm::vec2& start, const glm::vec2& end, float radius);
+
+		/*
+		* @brief Runs every added query and replaces the previous results.
+		* @param pJobSystem If set and there are enough queries, they are split between the workers.
+		*/
+		void Execute(const b2World& world, JobSystem* pJobSystem = nullptr);
+
+		/* @brief Removes the queries and their results. */
+		void Clear();
+
+		inline size_t GetNumQueries() const { return m_Queries.size(); }
+		size_t GetNumHits(size_t queryIndex) const;
+		/* @return The hit, or nullptr if the query has no hit with that index. */
+		const PhysicsQueryHit* GetHit(size_t queryIndex, size_t hitIndex = 0) const;
+		std::span<const PhysicsQueryHit> GetHits(size_t queryIndex) const;
+
+	private:
+		/* Query in world space, meters */
+		struct Query
+		{
+			EPhysicsQueryType type{ EPhysicsQueryType::RayCast };
+			b2Vec2 start{ 0.0f, 0.0f };
+			b2Vec2 end{ 0.0f, 0.0f };
+			float radius{ 0.0f };
+		};
+
+		struct QueryResult
+		{
+			uint32_t firstHit{ 0 };
+			uint32_t numHits{ 0 };
+		};
+
+		/* Converts world positions back to pixels, read on the worker threads */
+		struct PixelSpace
+		{
+			float metersToPixels{ 1.0f };
+			b2Vec2 halfScaledSize{ 0.0f, 0.0f };
+
+			glm::vec2 ToPixels(const b2Vec2& point) const;
+		};
+
+		void RunQueries(const b2World& world, size_t begin, size_t end, std::vector<PhysicsQueryHit>& outHits);
+		b2Vec2 ToWorld(const glm::vec2& point) const;
+
+	private:
+		std::vector<Query> m_Queries;
+		std::vector<QueryResult> m_Results;
+		std::vector<PhysicsQueryHit> m_Hits;
+		/* Hits of each range of queries when run on the job system, merged into m_Hits */
+		std::vector<std::vector<PhysicsQueryHit>> m_ChunkHits;
+		PixelSpace m_PixelSpace;
+	};
+
+}
@@ -0,0 +1,155 @@
+#include "StreamingBuffer.h"
+
+#include "Logger/Logger.h"
+
+/* Time in nanoseconds to block on a fence before checking it again */
+constexpr GLuint64 FENCE_WAIT_TIMEOUT = 1'000'000;
+/* Size of each segment of the shared streaming buffer */
+constexpr GLsizeiptr SHARED_SEGMENT_SIZE = 4 * 1024 * 1024;
+
+namespace Feather {
+
+	void* OpenGLStreamingBufferAPI::CreateMappedBuffer(GLsizeiptr size, GLuint& buffer)
+	{
+		if (!GLAD_GL_VERSION_4_4)
+		{
+			F_ERROR("Failed to create streaming buffer: OpenGL 4.4 buffer storage is not supported!");
+			return nullptr;
+		}
+
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		glCreateBuffers(1, &buffer);
+		glNamedBufferStorage(buffer, size, nullptr, flags);
+		return glMapNamedBufferRange(buffer, 0, size, flags);
+	}
+
+	void OpenGLStreamingBufferAPI::DeleteBuffer(GLuint buffer)
+	{
+		glUnmapNamedBuffer(buffer);
+		glDeleteBuffers(1, &buffer);
+	}
+
+	GLsync OpenGLStreamingBufferAPI::InsertFence()
+	{
+		return glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	GLenum OpenGLStreamingBufferAPI::ClientWaitFence(GLsync fence, GLuint64 timeout)
+	{
+		return glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+	}
+
+	void OpenGLStreamingBufferAPI::DeleteFence(GLsync fence)
+	{
+		glDeleteSync(fence);
+	}
+
+	StreamingBuffer::StreamingBuffer(GLsizeiptr segmentSize, std::unique_ptr<StreamingBufferAPI> api)
+		: m_API{ std::move(api) }
+		, m_Fences{}
+		, m_MappedData{ nullptr }
+		, m_BufferID{ 0 }
+		, m_SegmentSize{ segmentSize }
+		, m_Head{ 0 }
+		, m_CurrentSegment{ 0 }
+		, m_StallCount{ 0 }
+	{
+		m_MappedData = static_cast<GLubyte*>(m_API->CreateMappedBuffer(m_SegmentSize * NUM_SEGMENTS, m_BufferID));
+
+		if (!m_MappedData)
+		{
+			F_ERROR("Failed to map streaming buffer of size '{}'", m_SegmentSize * NUM_SEGMENTS);
+		}
+	}
+
+	StreamingBuffer::~StreamingBuffer()
+	{
+		for (auto& fence : m_Fences)
+		{
+			if (fence)
+				m_API->DeleteFence(fence);
+		}
+
+		if (m_BufferID)
+			m_API->DeleteBuffer(m_BufferID);
+	}
+
+	StreamingAllocation StreamingBuffer::Allocate(GLsizeiptr size, GLsizeiptr stride)
+	{
+		// The allocation plus worst case alignment padding must fit inside a single segment
+		if (!m_MappedData || size <= 0 || stride <= 0 || size + stride > m_SegmentSize)
+			return StreamingAllocation{};
+
+		auto alignUp = [stride](GLintptr offset) { return ((offset + stride - 1) / stride) * stride; };
+
+		GLintptr offset = alignUp(m_Head);
+		GLintptr segmentEnd = static_cast<GLintptr>(m_CurrentSegment + 1) * m_SegmentSize;
+
+		if (offset + size > segmentEnd)
+		{
+			AdvanceSegment();
+			offset = alignUp(m_Head);
+		}
+
+		m_Head = offset + size;
+
+		return StreamingAllocation{
+			.data = m_MappedData + offset,
+			.offset = offset,
+			.baseVertex = static_cast<GLint>(offset / stride)
+		};
+	}
+
+	std::shared_ptr<StreamingBuffer> StreamingBuffer::GetShared()
+	{
+		// Held weakly so the buffer is released with the last batcher, while the GL context is still alive
+		static std::weak_ptr<StreamingBuffer> s_SharedBuffer;
+
+		auto pBuffer = s_SharedBuffer.lock();
+		if (!pBuffer)
+		{
+			pBuffer = std::make_shared<StreamingBuffer>(SHARED_SEGMENT_SIZE);
+			s_SharedBuffer = pBuffer;
+		}
+
+		return pBuffer;
+	}
+
+	void StreamingBuffer::AdvanceSegment()
+	{
+		// Fence the draws that read from the segment we are leaving
+		m_Fences[m_CurrentSegment] = m_API->InsertFence();
+
+		m_CurrentSegment = (m_CurrentSegment + 1) % NUM_SEGMENTS;
+		m_Head = static_cast<GLintptr>(m_CurrentSegment) * m_SegmentSize;
+
+		WaitForSegment(m_CurrentSegment);
+	}
+
+	void StreamingBuffer::WaitForSegment(size_t segment)
+	{
+		GLsync fence = m_Fences[segment];
+		if (!fence)
+			return;
+
+		GLenum result = m_API->ClientWaitFence(fence, 0);
+		if (result == GL_TIMEOUT_EXPIRED)
+		{
+			m_StallCount++;
+			do
+			{
+				result = m_API->ClientWaitFence(fence, FENCE_WAIT_TIMEOUT);
+			} while (result == GL_TIMEOUT_EXPIRED);
+		}
+
+		if (result == GL_WAIT_FAILED)
+		{
+			F_ERROR("Failed to wait on streaming buffer segment '{}' fence", segment);
+		}
+
+		m_API->DeleteFence(fence);
+		m_Fences[segment] = nullptr;
+	}
+
+}
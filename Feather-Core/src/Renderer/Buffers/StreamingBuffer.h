@@ -0,0 +1,114 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <array>
+#include <memory>
+
+namespace Feather {
+
+	/*
+	* Thin interface over the GL calls used by the StreamingBuffer.
+	* The ring allocation and fence bookkeeping only talk to the GPU through this,
+	* so they can be driven by a mock implementation without a GL context.
+	*/
+	class StreamingBufferAPI
+	{
+	public:
+		virtual ~StreamingBufferAPI() = default;
+
+		/*
+		 * @brief Creates an immutable buffer of the given size and maps it persistently for writing.
+		 * @param GLsizeiptr size is the size of the buffer in bytes
+		 * @param GLuint& buffer receives the buffer ID
+		 * @return Returns the mapped pointer or nullptr on failure
+		 */
+		virtual void* CreateMappedBuffer(GLsizeiptr size, GLuint& buffer) = 0;
+		virtual void DeleteBuffer(GLuint buffer) = 0;
+
+		virtual GLsync InsertFence() = 0;
+		/*
+		 * @brief Waits on the fence for up to timeout nanoseconds.
+		 * @return Returns GL_ALREADY_SIGNALED, GL_CONDITION_SATISFIED, GL_TIMEOUT_EXPIRED or GL_WAIT_FAILED
+		 */
+		virtual GLenum ClientWaitFence(GLsync fence, GLuint64 timeout) = 0;
+		virtual void DeleteFence(GLsync fence) = 0;
+	};
+
+	/*
+	* StreamingBufferAPI implementation using GL 4.4 buffer storage and sync objects.
+	*/
+	class OpenGLStreamingBufferAPI : public StreamingBufferAPI
+	{
+	public:
+		virtual void* CreateMappedBuffer(GLsizeiptr size, GLuint& buffer) override;
+		virtual void DeleteBuffer(GLuint buffer) override;
+
+		virtual GLsync InsertFence() override;
+		virtual GLenum ClientWaitFence(GLsync fence, GLuint64 timeout) override;
+		virtual void DeleteFence(GLsync fence) override;
+	};
+
+	struct StreamingAllocation
+	{
+		void* data{ nullptr };
+		/* Byte offset of the allocation from the start of the buffer */
+		GLintptr offset{ 0 };
+		/* Offset of the allocation in vertices, to be used as the base vertex or first vertex of a draw */
+		GLint baseVertex{ 0 };
+	};
+
+	/*
+	* Persistently mapped vertex buffer shared by the batch renderers.
+	* The buffer is split into NUM_SEGMENTS segments that are filled in order. When an allocation moves
+	* past the end of a segment a fence is placed behind the draws that used it, and the next segment is
+	* only reused once its fence has been signaled. Allocations must be drawn before the next allocation,
+	* which holds for the batchers since End() is always followed by Render().
+	*/
+	class StreamingBuffer
+	{
+	public:
+		static constexpr size_t NUM_SEGMENTS = 3;
+
+		StreamingBuffer(GLsizeiptr segmentSize, std::unique_ptr<StreamingBufferAPI> api = std::make_unique<OpenGLStreamingBufferAPI>());
+		~StreamingBuffer();
+
+		// Make the streaming buffer non-copyable
+		StreamingBuffer(const StreamingBuffer&) = delete;
+		StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+		/*
+		 * @brief Reserves size bytes, aligned to a multiple of stride from the start of the buffer.
+		 * @return Returns the allocation. The data is nullptr if the allocation does not fit in a segment or the buffer failed to map.
+		 */
+		StreamingAllocation Allocate(GLsizeiptr size, GLsizeiptr stride);
+
+		inline GLuint GetID() const { return m_BufferID; }
+		inline GLsizeiptr GetSegmentSize() const { return m_SegmentSize; }
+		inline size_t GetCurrentSegment() const { return m_CurrentSegment; }
+		inline GLintptr GetHead() const { return m_Head; }
+		/* Number of times an allocation had to block waiting on the GPU */
+		inline size_t GetStallCount() const { return m_StallCount; }
+
+		/*
+		 * @brief Returns the streaming buffer shared by all batchers, creating it if no batcher currently holds it.
+		 * Requires a current GL context.
+		 */
+		static std::shared_ptr<StreamingBuffer> GetShared();
+
+	private:
+		void AdvanceSegment();
+		void WaitForSegment(size_t segment);
+
+	private:
+		std::unique_ptr<StreamingBufferAPI> m_API;
+		std::array<GLsync, NUM_SEGMENTS> m_Fences;
+		GLubyte* m_MappedData;
+		GLuint m_BufferID;
+		GLsizeiptr m_SegmentSize;
+		GLintptr m_Head;
+		size_t m_CurrentSegment;
+		size_t m_StallCount;
+	};
+
+}
@@ -1,6 +1,6 @@
 #include "BatchRenderer.h"
 
-#include <algorithm>
+#include <chrono>
 
 namespace Feather {
 
@@ -13,12 +13,22 @@ namespace Feather {
 	void SpriteBatchRenderer::End()
 	{
 		if (m_Glyphs.empty())
+		{
+			m_SortTime = 0.0f;
 			return;
+		}
 		
-		// Sort sprites by layer
-		std::sort(m_Glyphs.begin(), m_Glyphs.end(), [&](const auto& a, const auto& b) {
-			return a->layer < b->layer;
-		});
+		auto sortStart = std::chrono::steady_clock::now();
+
+		// Sort packed (layer, texture) keys so sprites sharing a texture within a layer end up in the same batch.
+		// The radix sort is stable, sprites with equal keys keep their submission order
+		m_SortKeys.clear();
+		for (uint32_t i = 0; i < m_Glyphs.size(); i++)
+			m_SortKeys.emplace_back(DrawKey{ .key = MakeDrawKey(m_Glyphs[i].layer, m_Glyphs[i].textureID), .index = i });
+
+		RadixSortDrawKeys(m_SortKeys, m_SortScratch);
+
+		m_SortTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - sortStart).count();
 
 		GenerateBatches();
 	}
@@ -32,8 +42,8 @@ namespace Feather {
 
 		for (const auto& batch : m_Batches)
 		{
-			glBindTextureUnit(0, batch->textureID);
-			glDrawElements(GL_TRIANGLES, batch->numIndices, GL_UNSIGNED_INT, (void*)(sizeof(GLuint) * batch->offset));
+			glBindTextureUnit(0, batch.textureID);
+			glDrawElementsBaseVertex(GL_TRIANGLES, batch.numIndices, GL_UNSIGNED_INT, (void*)(sizeof(GLuint) * batch.offset), GetBaseVertex());
 		}
 
 		DisableVAO();
@@ -41,66 +51,50 @@ namespace Feather {
 
 	void SpriteBatchRenderer::AddSprite(const glm::vec4& spriteRect, const glm::vec4 uvRect, GLuint textureID, int layer, glm::mat4 model, const Color& color)
 	{
-		m_Glyphs.emplace_back(
-			std::make_unique<SpriteGlyph>(
-				SpriteGlyph{
-					.topLeft = Vertex{
-						.position = model * glm::vec4{ spriteRect.x, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x, uvRect.y + uvRect.w },
-						.color = color
-					},
-					.bottomLeft = Vertex{
-						.position = model * glm::vec4{ spriteRect.x, spriteRect.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x, uvRect.y },
-						.color = color
-					},
-					.topRight = Vertex{
-						.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
-					  .uvs = glm::vec2{uvRect.x + uvRect.z, uvRect.y + uvRect.w},
-					  .color = color
-					},
-					.bottomRight = Vertex{
-						.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y },
-						.color = color
-					},
-					.layer = layer,
-					.textureID = textureID
-				}
-			)
-		);
+		m_Glyphs.emplace_back(CreateGlyph(spriteRect, uvRect, textureID, layer, model, color));
 	}
 
 	void SpriteBatchRenderer::AddSpriteIso(const glm::vec4& spriteRect, const glm::vec4 uvRect, GLuint textureID, int cellX, int cellY, int layer, glm::mat4 model, const Color& color)
 	{
-		m_Glyphs.emplace_back(
-			std::make_unique<SpriteGlyph>(
-				SpriteGlyph{
-					.topLeft = Vertex{
-						.position = model * glm::vec4{ spriteRect.x, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x, uvRect.y + uvRect.w },
-						.color = color
-					},
-					.bottomLeft = Vertex{
-						.position = model * glm::vec4{ spriteRect.x, spriteRect.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x, uvRect.y },
-						.color = color
-					},
-					.topRight = Vertex{
-						.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y + uvRect.w },
-						.color = color
-					},
-					.bottomRight = Vertex{
-						.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y },
-						.color = color
-					},
-					.layer = cellY + cellX + static_cast<int>(layer * spriteRect.w),
-					.textureID = textureID
-				}
-			)
-		);
+		m_Glyphs.emplace_back(CreateGlyph(spriteRect, uvRect, textureID, GetIsoLayer(spriteRect, cellX, cellY, layer), model, color));
+	}
+
+	void SpriteBatchRenderer::AddGlyphs(const std::vector<SpriteGlyph>& glyphs)
+	{
+		m_Glyphs.insert(m_Glyphs.end(), glyphs.begin(), glyphs.end());
+	}
+
+	SpriteGlyph SpriteBatchRenderer::CreateGlyph(const glm::vec4& spriteRect, const glm::vec4& uvRect, GLuint textureID, int layer, const glm::mat4& model, const Color& color)
+	{
+		return SpriteGlyph{
+			.topLeft = Vertex{
+				.position = model * glm::vec4{ spriteRect.x, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
+				.uvs = glm::vec2{ uvRect.x, uvRect.y + uvRect.w },
+				.color = color
+			},
+			.bottomLeft = Vertex{
+				.position = model * glm::vec4{ spriteRect.x, spriteRect.y, 0.0f, 1.0f },
+				.uvs = glm::vec2{ uvRect.x, uvRect.y },
+				.color = color
+			},
+			.topRight = Vertex{
+				.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
+				.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y + uvRect.w },
+				.color = color
+			},
+			.bottomRight = Vertex{
+				.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y, 0.0f, 1.0f },
+				.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y },
+				.color = color
+			},
+			.layer = layer,
+			.textureID = textureID
+		};
+	}
+
+	int SpriteBatchRenderer::GetIsoLayer(const glm::vec4& spriteRect, int cellX, int cellY, int layer)
+	{
+		return cellY + cellX + static_cast<int>(layer * spriteRect.w);
 	}
 
 	void SpriteBatchRenderer::Initialize()
@@ -112,44 +106,45 @@ namespace Feather {
 
 	void SpriteBatchRenderer::GenerateBatches()
 	{
-		std::vector<Vertex> vertices;
-		vertices.resize((m_Glyphs.size() > MAX_SPRITES ? MAX_SPRITES : m_Glyphs.size()) * NUM_SPRITE_VERTICES);
+		size_t remaining = m_SortKeys.size();
+		Vertex* vertices = MapVertices<Vertex>(std::min(remaining, MAX_SPRITES) * NUM_SPRITE_VERTICES);
+		if (!vertices)
+			return;
 
 		GLuint prevTextureID{ 0 };
 
-		for (const auto& sprite : m_Glyphs)
+		for (const auto& key : m_SortKeys)
 		{
+			const auto& sprite = m_Glyphs[key.index];
+
 			if (m_CurrentObject == 0)
-				m_Batches.emplace_back(std::make_unique<Batch>(Batch{ .numIndices = NUM_SPRITE_INDICES, .offset = m_Offset, .textureID = sprite->textureID }));
-			else if (sprite->textureID != prevTextureID)
-				m_Batches.emplace_back(std::make_unique<Batch>(Batch{ .numIndices = NUM_SPRITE_INDICES, .offset = m_Offset, .textureID = sprite->textureID }));
+				m_Batches.emplace_back(Batch{ .numIndices = NUM_SPRITE_INDICES, .offset = m_Offset, .textureID = sprite.textureID });
+			else if (sprite.textureID != prevTextureID)
+				m_Batches.emplace_back(Batch{ .numIndices = NUM_SPRITE_INDICES, .offset = m_Offset, .textureID = sprite.textureID });
 			else
-				m_Batches.back()->numIndices += NUM_SPRITE_INDICES;
+				m_Batches.back().numIndices += NUM_SPRITE_INDICES;
 
-			vertices[m_CurrentVertex++] = sprite->topLeft;
-			vertices[m_CurrentVertex++] = sprite->topRight;
-			vertices[m_CurrentVertex++] = sprite->bottomRight;
-			vertices[m_CurrentVertex++] = sprite->bottomLeft;
+			vertices[m_CurrentVertex++] = sprite.topLeft;
+			vertices[m_CurrentVertex++] = sprite.topRight;
+			vertices[m_CurrentVertex++] = sprite.bottomRight;
+			vertices[m_CurrentVertex++] = sprite.bottomLeft;
 
-			prevTextureID = sprite->textureID;
+			prevTextureID = sprite.textureID;
 			m_Offset += NUM_SPRITE_INDICES;
 			m_CurrentObject++;
+			remaining--;
 
 			if (m_CurrentObject == MAX_SPRITES)
 			{
-				Flush(vertices);
-			}
-		}
-
-		// Buffer remaining data
-		if (!vertices.empty() && !m_Batches.empty())
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, GetVBO());
+				Flush();
 
-			glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
-			glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(Vertex), vertices.data());
-
-			glBindBuffer(GL_ARRAY_BUFFER, 0);
+				if (remaining > 0)
+				{
+					vertices = MapVertices<Vertex>(std::min(remaining, MAX_SPRITES) * NUM_SPRITE_VERTICES);
+					if (!vertices)
+						return;
+				}
+			}
 		}
 	}
 
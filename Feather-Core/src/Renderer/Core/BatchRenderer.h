@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Batcher.h"
+#include "DrawKey.h"
 #include "../Essentials/BatchTypes.h"
 
 namespace Feather {
@@ -14,15 +15,41 @@ namespace Feather {
 		virtual void End() override;
 		virtual void Render() override;
 
+		/*
+		 * @brief Returns the time in milliseconds spent sorting the draw keys in the last call to End.
+		 */
+		inline float GetSortTime() const { return m_SortTime; }
+
 		void AddSprite(const glm::vec4& spriteRect, const glm::vec4 uvRect, GLuint textureID, int layer = 0,
 					   glm::mat4 model = glm::mat4{ 1.0f }, const Color& color = Color{ .r = 255, .g = 255, .b = 255, .a = 255 });
 
 		void AddSpriteIso(const glm::vec4& spriteRect, const glm::vec4 uvRect, GLuint textureID, int cellX, int cellY, int layer = 0,
 						  glm::mat4 model = glm::mat4{ 1.0f }, const Color& color = Color{ .r = 255, .g = 255, .b = 255, .a = 255 });
 
+		/*
+		 * @brief Appends prebuilt glyphs, e.g. the cached vertices of a tilemap chunk.
+		 */
+		void AddGlyphs(const std::vector<SpriteGlyph>& glyphs);
+
+		/*
+		 * @brief Builds the transformed glyph for a sprite without adding it to the batch.
+		 */
+		static SpriteGlyph CreateGlyph(const glm::vec4& spriteRect, const glm::vec4& uvRect, GLuint textureID, int layer,
+									   const glm::mat4& model, const Color& color);
+
+		/*
+		 * @brief Returns the sort layer of an isometric sprite, the cell depth is folded into the layer.
+		 */
+		static int GetIsoLayer(const glm::vec4& spriteRect, int cellX, int cellY, int layer);
+
 	private:
 		void Initialize();
 		virtual void GenerateBatches() override;
+
+	private:
+		std::vector<DrawKey> m_SortKeys;
+		std::vector<DrawKey> m_SortScratch;
+		float m_SortTime{ 0.0f };
 	};
 
 }
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../Essentials/Vertex.h"
+#include "../Buffers/StreamingBuffer.h"
+
+#include "Logger/Logger.h"
 
 #include <vector>
 #include <memory>
@@ -26,34 +29,51 @@ namespace Feather {
 		virtual void End() = 0;
 		virtual void Render() = 0;
 
+		/*
+		 * @brief Returns the number of batches (draw calls) generated since the last Begin, including flushed batches.
+		 */
+		inline size_t GetBatchCount() const { return m_FlushedBatchCount + m_Batches.size(); }
+
 	protected:
 		void SetVertexAttribute(GLuint layoutPosition, GLuint numComponents, GLenum type, GLsizeiptr stride, void* offset, GLboolean normalized = GL_FALSE);
 		void SetVertexIAttribute(GLuint layoutPosition, GLuint numComponents, GLenum type, GLsizei stride, void* offset);
 
-		inline GLuint GetVBO() const { return m_VBO; }
+		inline GLuint GetVBO() const { return m_StreamingBuffer->GetID(); }
 		inline GLuint GetIBO() const { return m_IBO; }
+		inline GLint GetBaseVertex() const { return m_BaseVertex; }
 		inline void EnableVAO() { glBindVertexArray(m_VAO); }
 		inline void DisableVAO() { glBindVertexArray(0); }
 
 		virtual void GenerateBatches() = 0;
 
+		/*
+		 * @brief Reserves space for the vertices in the shared streaming buffer and sets the base vertex used by Render.
+		 * Vertices are written straight into the returned mapped memory, there is no separate upload.
+		 * @return Returns the mapped vertices or nullptr if they could not be allocated
+		 */
 		template <typename TVertex>
-		void Flush(std::vector<TVertex>& vertices);
+		TVertex* MapVertices(size_t numVertices);
+
+		void Flush();
 
 	protected:
-		std::vector<std::unique_ptr<TGlyph>> m_Glyphs;
-		std::vector<std::unique_ptr<TBatch>> m_Batches;
+		// Glyphs and batches are stored by value and cleared (not freed) in Begin(),
+		// so their capacity is reused from frame to frame
+		std::vector<TGlyph> m_Glyphs;
+		std::vector<TBatch> m_Batches;
 		int m_CurrentObject;
 		int m_CurrentVertex;
 		GLuint m_Offset;
+		size_t m_FlushedBatchCount;
 
 	private:
 		void Initialize();
 
 	private:
+		std::shared_ptr<StreamingBuffer> m_StreamingBuffer;
 		GLuint m_VAO;
-		GLuint m_VBO;
 		GLuint m_IBO;
+		GLint m_BaseVertex;
 		bool m_UseIBO;
 	};
 
@@ -69,9 +89,11 @@ namespace Feather {
 		, m_CurrentObject{ 0 }
 		, m_CurrentVertex{ 0 }
 		, m_Offset{ 0 }
+		, m_FlushedBatchCount{ 0 }
+		, m_StreamingBuffer{ StreamingBuffer::GetShared() }
 		, m_VAO{ 0 }
-		, m_VBO{ 0 }
 		, m_IBO{ 0 }
+		, m_BaseVertex{ 0 }
 		, m_UseIBO{ useIBO }
 	{
 		Initialize();
@@ -81,7 +103,6 @@ namespace Feather {
 	inline Batcher<TBatch, TGlyph>::~Batcher()
 	{
 		if (m_VAO) glDeleteVertexArrays(1, &m_VAO);
-		if (m_VBO) glDeleteBuffers(1, &m_VBO);
 		if (m_IBO) glDeleteBuffers(1, &m_IBO);
 	}
 
@@ -93,17 +114,15 @@ namespace Feather {
 		m_CurrentObject = 0;
 		m_CurrentVertex = 0;
 		m_Offset = 0;
+		m_FlushedBatchCount = 0;
 	}
 
 	template<typename TBatch, typename TGlyph>
 	inline void Batcher<TBatch, TGlyph>::Initialize()
 	{
 		glGenVertexArrays(1, &m_VAO);
-		glGenBuffers(1, &m_VBO);
 
 		glBindVertexArray(m_VAO);
-		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-		glBufferData(GL_ARRAY_BUFFER, MAX_VERTICES * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
 
 		if (!m_UseIBO)
 		{
@@ -134,33 +153,45 @@ namespace Feather {
 	inline void Batcher<TBatch, TGlyph>::SetVertexAttribute(GLuint layoutPosition, GLuint numComponents, GLenum type, GLsizeiptr stride, void* offset, GLboolean normalized)
 	{
 		glBindVertexArray(m_VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, GetVBO());
 		glVertexAttribPointer(layoutPosition, numComponents, type, normalized, stride, offset);
 		glEnableVertexAttribArray(layoutPosition);
 		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
 	template <typename TBatch, typename TGlyph>
 	inline void Batcher<TBatch, TGlyph>::SetVertexIAttribute(GLuint layoutPosition, GLuint numComponents, GLenum type, GLsizei stride, void* offset)
 	{
 		glBindVertexArray(m_VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, GetVBO());
 		glVertexAttribIPointer(layoutPosition, numComponents, type, stride, offset);
 		glEnableVertexAttribArray(layoutPosition);
 		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
 	template <typename TBatch, typename TGlyph>
 	template <typename TVertex>
-	inline void Batcher<TBatch, TGlyph>::Flush(std::vector<TVertex>& vertices)
+	inline TVertex* Batcher<TBatch, TGlyph>::MapVertices(size_t numVertices)
 	{
-		glBindBuffer(GL_ARRAY_BUFFER, GetVBO());
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(TVertex), nullptr, GL_DYNAMIC_DRAW);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(TVertex), vertices.data());
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		auto allocation = m_StreamingBuffer->Allocate(numVertices * sizeof(TVertex), sizeof(TVertex));
+		if (!allocation.data)
+		{
+			F_ERROR("Failed to allocate '{}' vertices from the streaming buffer", numVertices);
+			return nullptr;
+		}
 
+		m_BaseVertex = allocation.baseVertex;
+		return static_cast<TVertex*>(allocation.data);
+	}
+
+	template <typename TBatch, typename TGlyph>
+	inline void Batcher<TBatch, TGlyph>::Flush()
+	{
 		Render();
+		m_FlushedBatchCount += m_Batches.size();
 		m_Batches.clear();
-		vertices.clear();
-		vertices.resize(MAX_SPRITES * NUM_SPRITE_VERTICES);
 		m_CurrentObject = 0;
 		m_CurrentVertex = 0;
 		m_Offset = 0;
@@ -26,7 +26,7 @@ namespace Feather {
 
 		for (const auto& batch : m_Batches)
 		{
-			glDrawElements(GL_TRIANGLES, batch->numIndices, GL_UNSIGNED_INT, (void*)(sizeof(GLuint) * batch->offset));
+			glDrawElementsBaseVertex(GL_TRIANGLES, batch.numIndices, GL_UNSIGNED_INT, (void*)(sizeof(GLuint) * batch.offset), GetBaseVertex());
 		}
 
 		DisableVAO();
@@ -35,34 +35,32 @@ namespace Feather {
 	void CircleBatchRenderer::AddCircle(const glm::vec4& destRect, const Color& color, float thickness, glm::mat4 model)
 	{
 		m_Glyphs.emplace_back(
-			std::make_unique<CircleGlyph>(
-				CircleGlyph{
-					.topLeft = CircleVertex{
-						.position = model * glm::vec4{ destRect.x, destRect.y + destRect.w, 0.0f, 1.0f },
-						.uvs = glm::vec2{ 1.0f, 1.0f },
-						.color = color,
-						.lineThickness = thickness
-					},
-					.bottomLeft = CircleVertex{
-						.position = model * glm::vec4{ destRect.x, destRect.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ 1.0f, -1.0f },
-						.color = color,
-						.lineThickness = thickness
-					},
-					.topRight = CircleVertex{
-						.position = model * glm::vec4{ destRect.x + destRect.z, destRect.y + destRect.w, 0.0f, 1.0f },
-						.uvs = glm::vec2{ -1.0f, 1.0f },
-						.color = color,
-						.lineThickness = thickness
-					},
-					.bottomRight = CircleVertex{
-						.position = model * glm::vec4{ destRect.x + destRect.z, destRect.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ -1.0f, -1.0f },
-						.color = color,
-						.lineThickness = thickness
-					},
-				}
-			)
+			CircleGlyph{
+				.topLeft = CircleVertex{
+					.position = model * glm::vec4{ destRect.x, destRect.y + destRect.w, 0.0f, 1.0f },
+					.uvs = glm::vec2{ 1.0f, 1.0f },
+					.color = color,
+					.lineThickness = thickness
+				},
+				.bottomLeft = CircleVertex{
+					.position = model * glm::vec4{ destRect.x, destRect.y, 0.0f, 1.0f },
+					.uvs = glm::vec2{ 1.0f, -1.0f },
+					.color = color,
+					.lineThickness = thickness
+				},
+				.topRight = CircleVertex{
+					.position = model * glm::vec4{ destRect.x + destRect.z, destRect.y + destRect.w, 0.0f, 1.0f },
+					.uvs = glm::vec2{ -1.0f, 1.0f },
+					.color = color,
+					.lineThickness = thickness
+				},
+				.bottomRight = CircleVertex{
+					.position = model * glm::vec4{ destRect.x + destRect.z, destRect.y, 0.0f, 1.0f },
+					.uvs = glm::vec2{ -1.0f, -1.0f },
+					.color = color,
+					.lineThickness = thickness
+				},
+			}
 		);
 	}
 
@@ -70,69 +68,69 @@ namespace Feather {
 	{
 		glm::mat4 model{ 1.0f };
 		m_Glyphs.emplace_back(
-			std::make_unique<CircleGlyph>(
-				CircleGlyph{
-					.topLeft = CircleVertex{
-						.position = model * glm::vec4{ circle.position.x, circle.position.y + circle.radius, 0.0f, 1.0f },
-						.uvs = glm::vec2{ 1.0f, 1.0f },
-						.color = circle.color,
-						.lineThickness = circle.lineThickness
-					},
-					.bottomLeft = CircleVertex{
-						.position = model * glm::vec4{ circle.position.x, circle.position.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ 1.0f, -1.0f },
-						.color = circle.color,
-						.lineThickness = circle.lineThickness
-					},
-					.topRight = CircleVertex{
-						.position = model * glm::vec4{ circle.position.x + circle.radius, circle.position.y + circle.radius, 0.0f, 1.0f },
-						.uvs = glm::vec2{ -1.0f, 1.0f },
-						.color = circle.color,
-						.lineThickness = circle.lineThickness
-					},
-					.bottomRight = CircleVertex{
-						.position = model * glm::vec4{ circle.position.x + circle.radius, circle.position.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ -1.0f, -1.0f },
-						.color = circle.color,
-						.lineThickness = circle.lineThickness
-					},
-				}
-			)
+			CircleGlyph{
+				.topLeft = CircleVertex{
+					.position = model * glm::vec4{ circle.position.x, circle.position.y + circle.radius, 0.0f, 1.0f },
+					.uvs = glm::vec2{ 1.0f, 1.0f },
+					.color = circle.color,
+					.lineThickness = circle.lineThickness
+				},
+				.bottomLeft = CircleVertex{
+					.position = model * glm::vec4{ circle.position.x, circle.position.y, 0.0f, 1.0f },
+					.uvs = glm::vec2{ 1.0f, -1.0f },
+					.color = circle.color,
+					.lineThickness = circle.lineThickness
+				},
+				.topRight = CircleVertex{
+					.position = model * glm::vec4{ circle.position.x + circle.radius, circle.position.y + circle.radius, 0.0f, 1.0f },
+					.uvs = glm::vec2{ -1.0f, 1.0f },
+					.color = circle.color,
+					.lineThickness = circle.lineThickness
+				},
+				.bottomRight = CircleVertex{
+					.position = model * glm::vec4{ circle.position.x + circle.radius, circle.position.y, 0.0f, 1.0f },
+					.uvs = glm::vec2{ -1.0f, -1.0f },
+					.color = circle.color,
+					.lineThickness = circle.lineThickness
+				},
+			}
 		);
 	}
 
 	void CircleBatchRenderer::GenerateBatches()
 	{
-		std::vector<CircleVertex> vertices;
-		vertices.resize(m_Glyphs.size() * NUM_SPRITE_VERTICES);
+		size_t remaining = m_Glyphs.size();
+		CircleVertex* vertices = MapVertices<CircleVertex>(std::min(remaining, MAX_SPRITES) * NUM_SPRITE_VERTICES);
+		if (!vertices)
+			return;
 
 		for (const auto& circle : m_Glyphs)
 		{
 			if (m_CurrentObject == 0)
-				m_Batches.emplace_back(std::make_unique<RectBatch>(RectBatch{ .numIndices = NUM_SPRITE_INDICES, .offset = m_Offset }));
+				m_Batches.emplace_back(RectBatch{ .numIndices = NUM_SPRITE_INDICES, .offset = m_Offset });
 			else
-				m_Batches.back()->numIndices += NUM_SPRITE_INDICES;
+				m_Batches.back().numIndices += NUM_SPRITE_INDICES;
 
-			vertices[m_CurrentVertex++] = circle->topLeft;
-			vertices[m_CurrentVertex++] = circle->topRight;
-			vertices[m_CurrentVertex++] = circle->bottomRight;
-			vertices[m_CurrentVertex++] = circle->bottomLeft;
+			vertices[m_CurrentVertex++] = circle.topLeft;
+			vertices[m_CurrentVertex++] = circle.topRight;
+			vertices[m_CurrentVertex++] = circle.bottomRight;
+			vertices[m_CurrentVertex++] = circle.bottomLeft;
 
 			m_Offset += NUM_SPRITE_INDICES;
 			m_CurrentObject++;
+			remaining--;
 
 			if (m_CurrentObject == MAX_SPRITES)
 			{
-				Flush(vertices);
-			}
-		}
+				Flush();
 
-		if (!vertices.empty() && !m_Batches.empty())
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, GetVBO());
-			glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(CircleVertex), nullptr, GL_DYNAMIC_DRAW);
-			glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(CircleVertex), vertices.data());
-			glBindBuffer(GL_ARRAY_BUFFER, 0);
+				if (remaining > 0)
+				{
+					vertices = MapVertices<CircleVertex>(std::min(remaining, MAX_SPRITES) * NUM_SPRITE_VERTICES);
+					if (!vertices)
+						return;
+				}
+			}
 		}
 	}
 
@@ -0,0 +1,57 @@
+#include "DrawKey.h"
+
+#include <array>
+
+namespace Feather {
+
+	void RadixSortDrawKeys(std::vector<DrawKey>& keys, std::vector<DrawKey>& scratch)
+	{
+		const size_t count = keys.size();
+		if (count < 2)
+			return;
+
+		scratch.resize(count);
+
+		constexpr size_t NUM_PASSES = sizeof(uint64_t);
+		constexpr size_t NUM_BUCKETS = 256;
+
+		// Build all histograms in a single pass over the keys
+		std::array<std::array<uint32_t, NUM_BUCKETS>, NUM_PASSES> histograms{};
+		for (const auto& drawKey : keys)
+		{
+			for (size_t pass = 0; pass < NUM_PASSES; pass++)
+				histograms[pass][(drawKey.key >> (pass * 8)) & 0xFF]++;
+		}
+
+		DrawKey* src = keys.data();
+		DrawKey* dst = scratch.data();
+
+		for (size_t pass = 0; pass < NUM_PASSES; pass++)
+		{
+			auto& histogram = histograms[pass];
+			const size_t shift = pass * 8;
+
+			// Every key has the same byte for this pass, nothing to reorder
+			if (histogram[(src[0].key >> shift) & 0xFF] == count)
+				continue;
+
+			uint32_t offset{ 0 };
+			for (auto& bucket : histogram)
+			{
+				uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; i++)
+				dst[histogram[(src[i].key >> shift) & 0xFF]++] = src[i];
+
+			std::swap(src, dst);
+		}
+
+		// An odd number of passes leaves the result in the scratch buffer
+		if (src != keys.data())
+			keys.swap(scratch);
+	}
+
+}
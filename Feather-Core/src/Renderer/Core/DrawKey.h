@@ -0,0 +1,37 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <vector>
+#include <cstdint>
+
+namespace Feather {
+
+	/*
+	* Packed 64-bit sort key for a glyph. The upper 32 bits hold the draw layer (biased so negative
+	* layers sort first), the lower 32 bits hold the texture ID. Isometric sprites fold their cell
+	* depth into the layer before the key is built.
+	* The index refers to the glyph's position in the batcher's glyph storage.
+	*/
+	struct DrawKey
+	{
+		uint64_t key{ 0 };
+		uint32_t index{ 0 };
+	};
+
+	constexpr uint64_t MakeDrawKey(int layer, GLuint textureID)
+	{
+		const uint64_t biasedLayer = static_cast<uint32_t>(layer) ^ 0x80000000u;
+		return (biasedLayer << 32) | static_cast<uint64_t>(textureID);
+	}
+
+	/*
+	* @brief Stable LSD radix sort of the draw keys, 8 bits per pass.
+	* Passes where every key shares the same byte are skipped, so in practice only the bytes
+	* that actually vary (a few layer bits and the low texture ID bits) are sorted.
+	* @param keys the keys to sort, sorted in place.
+	* @param scratch buffer reused between calls to avoid allocations.
+	*/
+	void RadixSortDrawKeys(std::vector<DrawKey>& keys, std::vector<DrawKey>& scratch);
+
+}
@@ -21,7 +21,7 @@ namespace Feather {
 		glEnable(GL_LINE_SMOOTH);
 		EnableVAO();
 		for (const auto& batch : m_Batches)
-			glDrawArrays(GL_LINES, 0, batch->numVertices);
+			glDrawArrays(GL_LINES, GetBaseVertex(), batch.numVertices);
 		DisableVAO();
 		glDisable(GL_LINE_SMOOTH);
 
@@ -30,43 +30,48 @@ namespace Feather {
 	void LineBatchRenderer::AddLine(const Line& line)
 	{
 		m_Glyphs.emplace_back(
-			std::make_unique<LineGlyph>(
-				LineGlyph{
-					.p1 = Vertex{.position = line.p1, .color = line.color },
-					.p2 = Vertex{.position = line.p2, .color = line.color },
-					.lineWidth = line.lineWidth
-				}
-			)
+			LineGlyph{
+				.p1 = Vertex{.position = line.p1, .color = line.color },
+				.p2 = Vertex{.position = line.p2, .color = line.color },
+				.lineWidth = line.lineWidth
+			}
 		);
 	}
 
 	void LineBatchRenderer::GenerateBatches()
 	{
-		std::vector<Vertex> vertices;
-		vertices.resize(m_Glyphs.size() * 2);
-
-		int currentVertex{ 0 };
+		constexpr size_t MAX_LINES = MAX_VERTICES / 2;
 
-		m_Batches.push_back(std::make_unique<LineBatch>(LineBatch{ .offset = 0, .numVertices = 2 }));
+		size_t remaining = m_Glyphs.size();
+		Vertex* vertices = MapVertices<Vertex>(std::min(remaining, MAX_LINES) * 2);
+		if (!vertices)
+			return;
 
 		for (const auto& line : m_Glyphs)
 		{
-			vertices[currentVertex++] = line->p1;
-			vertices[currentVertex++] = line->p2;
-			m_Batches.back()->lineWidth = line->lineWidth;
-
-			if (m_Glyphs.size() == 1)
-				break;
-			
-			m_Batches.back()->numVertices += 2;
+			if (m_CurrentObject == 0)
+				m_Batches.push_back(LineBatch{ .offset = 0, .numVertices = 0 });
+
+			vertices[m_CurrentVertex++] = line.p1;
+			vertices[m_CurrentVertex++] = line.p2;
+			m_Batches.back().lineWidth = line.lineWidth;
+			m_Batches.back().numVertices += 2;
+
+			m_CurrentObject++;
+			remaining--;
+
+			if (m_CurrentObject == MAX_LINES)
+			{
+				Flush();
+
+				if (remaining > 0)
+				{
+					vertices = MapVertices<Vertex>(std::min(remaining, MAX_LINES) * 2);
+					if (!vertices)
+						return;
+				}
+			}
 		}
-
-		glBindBuffer(GL_ARRAY_BUFFER, GetVBO());
-
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(Vertex), vertices.data());
-
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
 	void LineBatchRenderer::Initialize()
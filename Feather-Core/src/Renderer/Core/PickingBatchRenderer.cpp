@@ -1,7 +1,5 @@
 #include "PickingBatchRenderer.h"
 
-#include <algorithm>
-
 namespace Feather {
 
 	PickingBatchRenderer::PickingBatchRenderer()
@@ -15,8 +13,13 @@ namespace Feather {
 		if (m_Glyphs.empty())
 			return;
 
-		// Sort the sprites by their layer
-		std::ranges::sort(m_Glyphs, [&](const auto& a, const auto& b) { return a->layer < b->layer; });
+		// Sort packed (layer, texture) keys so sprites sharing a texture within a layer end up in the same batch.
+		// The radix sort is stable, sprites with equal keys keep their submission order
+		m_SortKeys.clear();
+		for (uint32_t i = 0; i < m_Glyphs.size(); i++)
+			m_SortKeys.emplace_back(DrawKey{ .key = MakeDrawKey(m_Glyphs[i].layer, m_Glyphs[i].textureID), .index = i });
+
+		RadixSortDrawKeys(m_SortKeys, m_SortScratch);
 
 		GenerateBatches();
 	}
@@ -30,8 +33,8 @@ namespace Feather {
 
 		for (const auto& batch : m_Batches)
 		{
-			glBindTextureUnit(0, batch->textureID);
-			glDrawElements(GL_TRIANGLES, batch->numIndices, GL_UNSIGNED_INT, (void*)(sizeof(GLuint) * batch->offset));
+			glBindTextureUnit(0, batch.textureID);
+			glDrawElementsBaseVertex(GL_TRIANGLES, batch.numIndices, GL_UNSIGNED_INT, (void*)(sizeof(GLuint) * batch.offset), GetBaseVertex());
 		}
 
 		DisableVAO();
@@ -40,36 +43,34 @@ namespace Feather {
 	void PickingBatchRenderer::AddSprite(const glm::vec4& spriteRect, const glm::vec4 uvRect, GLuint textureID, int layer, uint32_t id, const Color& color, glm::mat4 model)
 	{
 		m_Glyphs.emplace_back(
-			std::make_unique<PickingGlyph>(
-				PickingGlyph{
-					.topLeft = PickingVertex{
-						.position = model * glm::vec4{ spriteRect.x, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x, uvRect.y + uvRect.w },
-						.color = color,
-						.uid = id
-					},
-					.bottomLeft = PickingVertex{
-						.position = model * glm::vec4{ spriteRect.x, spriteRect.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x, uvRect.y },
-						.color = color,
-						.uid = id
-					},
-					.topRight = PickingVertex{
-						.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y + uvRect.w },
-						.color = color,
-						.uid = id
-					},
-					.bottomRight = PickingVertex{
-						.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y, 0.0f, 1.0f },
-						.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y },
-						.color = color,
-						.uid = id
-					},
-					.layer = layer,
-					.textureID = textureID
-				}
-			)
+			PickingGlyph{
+				.topLeft = PickingVertex{
+					.position = model * glm::vec4{ spriteRect.x, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
+					.uvs = glm::vec2{ uvRect.x, uvRect.y + uvRect.w },
+					.color = color,
+					.uid = id
+				},
+				.bottomLeft = PickingVertex{
+					.position = model * glm::vec4{ spriteRect.x, spriteRect.y, 0.0f, 1.0f },
+					.uvs = glm::vec2{ uvRect.x, uvRect.y },
+					.color = color,
+					.uid = id
+				},
+				.topRight = PickingVertex{
+					.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y + spriteRect.w, 0.0f, 1.0f },
+					.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y + uvRect.w },
+					.color = color,
+					.uid = id
+				},
+				.bottomRight = PickingVertex{
+					.position = model * glm::vec4{ spriteRect.x + spriteRect.z, spriteRect.y, 0.0f, 1.0f },
+					.uvs = glm::vec2{ uvRect.x + uvRect.z, uvRect.y },
+					.color = color,
+					.uid = id
+				},
+				.layer = layer,
+				.textureID = textureID
+			}
 		);
 	}
 
@@ -82,37 +83,47 @@ namespace Feather {
 
 	void PickingBatchRenderer::GenerateBatches()
 	{
-		std::vector<PickingVertex> vertices;
-		vertices.resize(m_Glyphs.size() * NUM_SPRITE_VERTICES);
+		size_t remaining = m_SortKeys.size();
+		PickingVertex* vertices = MapVertices<PickingVertex>(std::min(remaining, MAX_SPRITES) * NUM_SPRITE_VERTICES);
+		if (!vertices)
+			return;
 
-		int currentVertex{ 0 }, currentSprite{ 0 };
-		GLuint offset{ 0 }, prevTextureID{ 0 };
+		GLuint prevTextureID{ 0 };
 
-		for (const auto& sprite : m_Glyphs)
+		for (const auto& key : m_SortKeys)
 		{
-			if (currentSprite == 0)
-				m_Batches.emplace_back(std::make_unique<Batch>(Batch{ .numIndices = NUM_SPRITE_INDICES, .offset = offset, .textureID = sprite->textureID }));
-			else if (sprite->textureID != prevTextureID)
-				m_Batches.emplace_back(std::make_unique<Batch>(Batch{ .numIndices = NUM_SPRITE_INDICES, .offset = offset, .textureID = sprite->textureID }));
-			else
-				m_Batches.back()->numIndices += NUM_SPRITE_INDICES;
-
-			vertices[currentVertex++] = sprite->topLeft;
-			vertices[currentVertex++] = sprite->topRight;
-			vertices[currentVertex++] = sprite->bottomRight;
-			vertices[currentVertex++] = sprite->bottomLeft;
+			const auto& sprite = m_Glyphs[key.index];
 
-			prevTextureID = sprite->textureID;
-			offset += NUM_SPRITE_INDICES;
-			currentSprite++;
+			if (m_CurrentObject == 0)
+				m_Batches.emplace_back(Batch{ .numIndices = NUM_SPRITE_INDICES, .offset = m_Offset, .textureID = sprite.textureID });
+			else if (sprite.textureID != prevTextureID)
+				m_Batches.emplace_back(Batch{ .numIndices = NUM_SPRITE_INDICES, .offset = m_Offset, .textureID = sprite.textureID });
+			else
+				m_Batches.back().numIndices += NUM_SPRITE_INDICES;
+
+			vertices[m_CurrentVertex++] = sprite.topLeft;
+			vertices[m_CurrentVertex++] = sprite.topRight;
+			vertices[m_CurrentVertex++] = sprite.bottomRight;
+			vertices[m_CurrentVertex++] = sprite.bottomLeft;
+
+			prevTextureID = sprite.textureID;
+			m_Offset += NUM_SPRITE_INDICES;
+			m_CurrentObject++;
+			remaining--;
+
+			// The index buffer only covers MAX_SPRITES, flush early
+			if (m_CurrentObject == MAX_SPRITES)
+			{
+				Flush();
+
+				if (remaining > 0)
+				{
+					vertices = MapVertices<PickingVertex>(std::min(remaining, MAX_SPRITES) * NUM_SPRITE_VERTICES);
+					if (!vertices)
+						return;
+				}
+			}
 		}
-
-		glBindBuffer(GL_ARRAY_BUFFER, GetVBO());
-
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(PickingVertex), nullptr, GL_DYNAMIC_DRAW);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(PickingVertex), vertices.data());
-
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
 }
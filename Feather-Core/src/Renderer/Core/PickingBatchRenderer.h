@@ -1,5 +1,6 @@
 #pragma once
 #include "Batcher.h"
+#include "DrawKey.h"
 #include "Renderer/Essentials/BatchTypes.h"
 
 namespace Feather {
@@ -36,6 +37,10 @@ namespace Feather {
 	private:
 		void Initialize();
 		virtual void GenerateBatches() override;
+
+	private:
+		std::vector<DrawKey> m_SortKeys;
+		std::vector<DrawKey> m_SortScratch;
 	};
 
 }
@@ -2,10 +2,11 @@
 
 #include "Logger/Logger.h"
 
-/* If the loop is more than 100, fail and let the user know */
-constexpr int MAX_LOOP_FAIL_CHECK = 100;
+#include <glm/gtc/matrix_transform.hpp>
+
 constexpr GLuint NUM_VERTICES = 6;
-constexpr float MIN_TEXT_WRAP = 100.0f;
+/* Maximum number of characters written to the streaming buffer before flushing */
+constexpr size_t MAX_TEXT_CHARS = Feather::MAX_VERTICES / NUM_VERTICES;
 
 namespace Feather {
 
@@ -17,10 +18,10 @@ namespace Feather {
 
 	void TextBatchRenderer::End()
 	{
-		if (m_Glyphs.empty())
-			return;
+		if (!m_Glyphs.empty())
+			GenerateBatches();
 
-		GenerateBatches();
+		m_LayoutCache.EndFrame();
 	}
 
 	void TextBatchRenderer::Render()
@@ -32,8 +33,8 @@ namespace Feather {
 		for (const auto& batch : m_Batches)
 		{
 			glActiveTexture(GL_TEXTURE0);
-			glBindTexture(GL_TEXTURE_2D, batch->fontAtlasID);
-			glDrawArrays(GL_TRIANGLES, batch->offset, batch->numVertices);
+			glBindTexture(GL_TEXTURE_2D, batch.fontAtlasID);
+			glDrawArrays(GL_TRIANGLES, GetBaseVertex() + batch.offset, batch.numVertices);
 		}
 		DisableVAO();
 	}
@@ -43,18 +44,18 @@ namespace Feather {
 		if (!font)
 			return;
 
+		auto layout = m_LayoutCache.GetLayout(text, font, wrap, padding);
+		if (layout->glyphs.empty())
+			return;
+
 		m_Glyphs.emplace_back(
-			std::make_unique<TextGlyph>(
-				TextGlyph{
-					.textStr = text,
-					.position = position,
-					.color = color,
-					.model = model,
-					.font = font,
-					.wrap = wrap,
-					.padding = padding
-				}
-			)
+			TextGlyph{
+				.layout = std::move(layout),
+				.position = position,
+				.color = color,
+				.model = model,
+				.fontAtlasID = font->GetFontAtlasID()
+			}
 		);
 	}
 
@@ -70,190 +71,102 @@ namespace Feather {
 		GLuint offset{ 0 }, prevFontID{ 0 };
 		int currentFont{ 0 };
 
-		size_t total{ 0 }, currentVertex{ 0 };
+		size_t total{ 0 }, currentVertex{ 0 }, currentChar{ 0 };
 
 		// Add up the total characters
-		for (const auto& textGlpyh : m_Glyphs)
-			total += textGlpyh->textStr.size();
+		for (const auto& textGlyph : m_Glyphs)
+			total += textGlyph.layout->glyphs.size();
 
-		std::vector<Vertex> vertices;
-		vertices.resize(total * NUM_VERTICES);
+		if (total == 0)
+			return;
+
+		size_t chunkChars = std::min(total, MAX_TEXT_CHARS);
+		Vertex* vertices = MapVertices<Vertex>(chunkChars * NUM_VERTICES);
+		if (!vertices)
+			return;
 
 		for (const auto& textGlyph : m_Glyphs)
 		{
-			std::vector<std::string> textChunks{};
-			std::string text_holder{};
-			glm::vec2 temp_pos = textGlyph->position;
-			auto fontSize = textGlyph->font->GetFontSize();
-			int infiniteLoopCheck{ 0 };
+			// The layout is relative to the text, move it to the text position
+			const glm::mat4 model = glm::translate(textGlyph.model, glm::vec3{ textGlyph.position, 0.0f });
 
-			if (textGlyph->wrap > MIN_TEXT_WRAP)
+			for (const auto& glyph : textGlyph.layout->glyphs)
 			{
-				// Create the text chunks for each line
-				for (int i = 0; i < textGlyph->textStr.size(); i++)
+				// Out of room in the mapped chunk, draw what we have and map the rest
+				if (currentChar == chunkChars)
 				{
-					if (infiniteLoopCheck >= MAX_LOOP_FAIL_CHECK)
-					{
-						F_ERROR("Failed to draw text batch correctly. Please check your text wrap, padding, textStr, etc");
+					Flush();
+					total -= std::min(total, currentChar);
+					chunkChars = std::clamp(total, size_t{ 1 }, MAX_TEXT_CHARS);
+					currentChar = 0;
+					currentVertex = 0;
+					currentFont = 0;
+					offset = 0;
+
+					vertices = MapVertices<Vertex>(chunkChars * NUM_VERTICES);
+					if (!vertices)
 						return;
-					}
-
-					auto character = textGlyph->textStr[i];
-					text_holder += character;
-					bool newLine = character == '\n';
-					size_t text_size = text_holder.size();
-					// Move temp_pos with each character
-					textGlyph->font->GetNextCharPos(character, temp_pos);
-
-					if (text_size > 0 && (temp_pos.x > (textGlyph->wrap + textGlyph->position.x) || character == '\0' || newLine))
-					{
-						if (!newLine)
-						{
-							while (textGlyph->textStr[i] != ' ' && textGlyph->textStr[i] != '.' && textGlyph->textStr[i] != '!' && textGlyph->textStr[i] != '?' && text_size > 0)
-							{
-								i--;
-								infiniteLoopCheck++;
-
-								if (i < 0)
-								{
-									F_ERROR("Failed to draw text '{0}': Wrap '{1}', is too small for the text to wrap successfully!", textGlyph->textStr, textGlyph->wrap);
-									return;
-								}
-
-								if (!text_holder.empty())
-								{
-									text_holder.pop_back();
-									text_size = text_holder.size();
-									temp_pos.x -= fontSize;
-								}
-							}
-						}
-						else
-						{
-							text_holder.pop_back();
-						}
-
-						if (text_size > 0)
-						{
-							if (std::isalpha(text_holder[0]))
-							{
-								textChunks.push_back(text_holder);
-								temp_pos = textGlyph->position;
-								text_holder.clear();
-								infiniteLoopCheck = 0;
-							}
-							else
-							{
-								text_holder.erase(0, 1);
-								temp_pos.x -= fontSize;
-							}
-						}
-					}
 				}
 
-				if (!text_holder.empty())
+				// First Triangle
+				vertices[currentVertex++] = Vertex{
+					.position = model * glm::vec4{glyph.min.position.x, glyph.min.position.y, 0.0f, 1.0f},
+					.uvs = glm::vec2{glyph.min.uvs.x, glyph.min.uvs.y},
+					.color = textGlyph.color
+				};
+
+				vertices[currentVertex++] = Vertex{
+					.position = model * glm::vec4{glyph.max.position.x, glyph.max.position.y, 0.0f, 1.0f},
+					.uvs = glm::vec2{glyph.max.uvs.x, glyph.max.uvs.y},
+					.color = textGlyph.color
+				};
+
+				vertices[currentVertex++] = Vertex{
+					.position = model * glm::vec4{glyph.max.position.x, glyph.min.position.y, 0.0f, 1.0f},
+					.uvs = glm::vec2{glyph.max.uvs.x, glyph.min.uvs.y},
+					.color = textGlyph.color
+				};
+
+				// Second Triangle
+				vertices[currentVertex++] = Vertex{
+					.position = model * glm::vec4{glyph.min.position.x, glyph.min.position.y, 0.0f, 1.0f},
+					.uvs = glm::vec2{glyph.min.uvs.x, glyph.min.uvs.y},
+					.color = textGlyph.color
+				};
+
+				vertices[currentVertex++] = Vertex{
+					.position = model * glm::vec4{glyph.min.position.x, glyph.max.position.y, 0.0f, 1.0f},
+					.uvs = glm::vec2{glyph.min.uvs.x, glyph.max.uvs.y},
+					.color = textGlyph.color
+				};
+
+				vertices[currentVertex++] = Vertex{
+					.position = model * glm::vec4{glyph.max.position.x, glyph.max.position.y, 0.0f, 1.0f},
+					.uvs = glm::vec2{glyph.max.uvs.x, glyph.max.uvs.y},
+					.color = textGlyph.color
+				};
+
+				if (currentFont == 0 || textGlyph.fontAtlasID != prevFontID)
 				{
-					textChunks.push_back(text_holder);
-					text_holder.clear();
+					m_Batches.push_back(
+						TextBatch{
+							.offset = offset,
+							.numVertices = NUM_VERTICES,
+							.fontAtlasID = textGlyph.fontAtlasID
+						}
+					);
 				}
-			}
-			else
-			{
-				textChunks.push_back(textGlyph->textStr);
-			}
-
-			// Reset the text position
-			temp_pos = textGlyph->position;
-
-			// Add new Text Sprite
-			for (const auto& textStr : textChunks)
-			{
-				for (const auto& character : textStr)
+				else
 				{
-					auto glyph = textGlyph->font->GetGlyph(character, temp_pos);
-
-					// First Triangle
-					vertices[currentVertex++] = Vertex{
-						.position = textGlyph->model * glm::vec4{glyph.min.position.x, glyph.min.position.y, 0.0f, 1.0f},
-						.uvs = glm::vec2{glyph.min.uvs.x, glyph.min.uvs.y},
-						.color = textGlyph->color
-					};
-
-					vertices[currentVertex++] = Vertex{
-						.position = textGlyph->model * glm::vec4{glyph.max.position.x, glyph.max.position.y, 0.0f, 1.0f},
-						.uvs = glm::vec2{glyph.max.uvs.x, glyph.max.uvs.y},
-						.color = textGlyph->color
-					};
-
-					vertices[currentVertex++] = Vertex{
-						.position = textGlyph->model * glm::vec4{glyph.max.position.x, glyph.min.position.y, 0.0f, 1.0f},
-						.uvs = glm::vec2{glyph.max.uvs.x, glyph.min.uvs.y},
-						.color = textGlyph->color
-					};
-
-					// Second Triangle
-					vertices[currentVertex++] = Vertex{
-						.position = textGlyph->model * glm::vec4{glyph.min.position.x, glyph.min.position.y, 0.0f, 1.0f},
-						.uvs = glm::vec2{glyph.min.uvs.x, glyph.min.uvs.y},
-						.color = textGlyph->color
-					};
-
-					vertices[currentVertex++] = Vertex{
-						.position = textGlyph->model * glm::vec4{glyph.min.position.x, glyph.max.position.y, 0.0f, 1.0f},
-						.uvs = glm::vec2{glyph.min.uvs.x, glyph.max.uvs.y},
-						.color = textGlyph->color
-					};
-
-					vertices[currentVertex++] = Vertex{
-						.position = textGlyph->model * glm::vec4{glyph.max.position.x, glyph.max.position.y, 0.0f, 1.0f},
-						.uvs = glm::vec2{glyph.max.uvs.x, glyph.max.uvs.y},
-						.color = textGlyph->color
-					};
-
-					if (currentFont == 0)
-					{
-						m_Batches.push_back(
-							std::make_unique<TextBatch>(
-								TextBatch{
-									.offset = offset,
-									.numVertices = NUM_VERTICES,
-									.fontAtlasID = textGlyph->font->GetFontAtlasID()
-								}
-							)
-						);
-					}
-					else if (textGlyph->font->GetFontAtlasID() != prevFontID)
-					{
-						m_Batches.push_back(
-							std::make_unique<TextBatch>(
-								TextBatch{
-									.offset = offset,
-									.numVertices = NUM_VERTICES,
-									.fontAtlasID = textGlyph->font->GetFontAtlasID()
-								}
-							)
-						);
-					}
-					else
-					{
-						m_Batches.back()->numVertices += NUM_VERTICES;
-					}
-
-					currentFont++;
-					prevFontID = textGlyph->font->GetFontAtlasID();
-					offset += NUM_VERTICES;
+					m_Batches.back().numVertices += NUM_VERTICES;
 				}
 
-				// Move to the next Line
-				temp_pos.x = textGlyph->position.x;
-				temp_pos.y += textGlyph->font->GetFontSize() + textGlyph->padding;
+				currentFont++;
+				currentChar++;
+				prevFontID = textGlyph.fontAtlasID;
+				offset += NUM_VERTICES;
 			}
 		}
-
-		glBindBuffer(GL_ARRAY_BUFFER, GetVBO());
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(Vertex), vertices.data());
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
 }
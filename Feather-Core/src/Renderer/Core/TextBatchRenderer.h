@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Batcher.h"
+#include "TextLayoutCache.h"
 #include "../Essentials/BatchTypes.h"
 
 namespace Feather {
@@ -20,6 +21,9 @@ namespace Feather {
 	private:
 		void Initialize();
 		virtual void GenerateBatches() override;
+
+	private:
+		TextLayoutCache m_LayoutCache;
 	};
 
 }
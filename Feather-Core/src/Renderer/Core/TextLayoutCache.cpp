@@ -0,0 +1,153 @@
+#include "TextLayoutCache.h"
+
+#include "Logger/Logger.h"
+
+/* If the loop is more than 100, fail and let the user know */
+constexpr int MAX_LOOP_FAIL_CHECK = 100;
+constexpr float MIN_TEXT_WRAP = 100.0f;
+/* Number of frames a layout can go unused before it is evicted */
+constexpr uint64_t LAYOUT_EVICT_FRAMES = 120;
+
+namespace Feather {
+
+	std::shared_ptr<const TextLayout> TextLayoutCache::GetLayout(const std::string& text, const std::shared_ptr<Font>& font, float wrap, int padding)
+	{
+		size_t key = std::hash<std::string>{}(text);
+		key ^= std::hash<const Font*>{}(font.get()) + 0x9e3779b9 + (key << 6) + (key >> 2);
+		key ^= std::hash<float>{}(wrap) + 0x9e3779b9 + (key << 6) + (key >> 2);
+		key ^= std::hash<int>{}(padding) + 0x9e3779b9 + (key << 6) + (key >> 2);
+
+		auto& cached = m_mapLayouts[key];
+		cached.lastUsedFrame = m_FrameIndex;
+
+		// Reuse the layout only if it is really for this text and the font has not been reloaded
+		if (cached.layout && cached.font.lock() == font && cached.wrap == wrap && cached.padding == padding && cached.text == text)
+			return cached.layout;
+
+		cached.layout = CreateLayout(text, *font, wrap, padding);
+		cached.font = font;
+		cached.text = text;
+		cached.wrap = wrap;
+		cached.padding = padding;
+
+		return cached.layout;
+	}
+
+	void TextLayoutCache::EndFrame()
+	{
+		std::erase_if(m_mapLayouts, [this](const auto& layoutPair) {
+			return m_FrameIndex - layoutPair.second.lastUsedFrame > LAYOUT_EVICT_FRAMES;
+		});
+
+		++m_FrameIndex;
+	}
+
+	std::shared_ptr<const TextLayout> TextLayoutCache::CreateLayout(const std::string& text, Font& font, float wrap, int padding)
+	{
+		auto layout = std::make_shared<TextLayout>();
+
+		std::vector<std::string> textChunks{};
+		std::string text_holder{};
+		glm::vec2 temp_pos{ 0.0f };
+		auto fontSize = font.GetFontSize();
+		int infiniteLoopCheck{ 0 };
+
+		if (wrap > MIN_TEXT_WRAP)
+		{
+			// Create the text chunks for each line
+			for (int i = 0; i < text.size(); i++)
+			{
+				if (infiniteLoopCheck >= MAX_LOOP_FAIL_CHECK)
+				{
+					F_ERROR("Failed to draw text batch correctly. Please check your text wrap, padding, textStr, etc");
+					return layout;
+				}
+
+				auto character = text[i];
+				text_holder += character;
+				bool newLine = character == '\n';
+				size_t text_size = text_holder.size();
+				// Move temp_pos with each character
+				font.GetNextCharPos(character, temp_pos);
+
+				if (text_size > 0 && (temp_pos.x > wrap || character == '\0' || newLine))
+				{
+					if (!newLine)
+					{
+						while (text[i] != ' ' && text[i] != '.' && text[i] != '!' && text[i] != '?' && text_size > 0)
+						{
+							i--;
+							infiniteLoopCheck++;
+
+							if (i < 0)
+							{
+								F_ERROR("Failed to draw text '{0}': Wrap '{1}', is too small for the text to wrap successfully!", text, wrap);
+								return layout;
+							}
+
+							if (!text_holder.empty())
+							{
+								text_holder.pop_back();
+								text_size = text_holder.size();
+								temp_pos.x -= fontSize;
+							}
+						}
+					}
+					else
+					{
+						text_holder.pop_back();
+					}
+
+					if (text_size > 0)
+					{
+						if (std::isalpha(text_holder[0]))
+						{
+							textChunks.push_back(text_holder);
+							temp_pos = glm::vec2{ 0.0f };
+							text_holder.clear();
+							infiniteLoopCheck = 0;
+						}
+						else
+						{
+							text_holder.erase(0, 1);
+							temp_pos.x -= fontSize;
+						}
+					}
+				}
+			}
+
+			if (!text_holder.empty())
+			{
+				textChunks.push_back(text_holder);
+				text_holder.clear();
+			}
+		}
+		else
+		{
+			textChunks.push_back(text);
+		}
+
+		// Reset the text position
+		temp_pos = glm::vec2{ 0.0f };
+
+		layout->glyphs.reserve(text.size());
+		for (const auto& textStr : textChunks)
+		{
+			for (const auto& character : textStr)
+			{
+				// Characters outside of the baked range have no quad
+				if (!Font::HasGlyph(character))
+					continue;
+
+				layout->glyphs.push_back(font.GetGlyph(character, temp_pos));
+			}
+
+			// Move to the next Line
+			temp_pos.x = 0.0f;
+			temp_pos.y += fontSize + padding;
+		}
+
+		return layout;
+	}
+
+}
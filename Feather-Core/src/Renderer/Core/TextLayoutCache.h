@@ -0,0 +1,60 @@
+#pragma once
+
+#include "../Essentials/Font.h"
+
+namespace Feather {
+
+	/*
+	* @brief Glyph quads of a block of text, laid out relative to the text position.
+	*/
+	struct TextLayout
+	{
+		std::vector<FontGlyph> glyphs{};
+	};
+
+	/*
+	* @brief Caches the word wrapped glyph layout of text, keyed by font, text, wrap and padding.
+	* Static text is laid out once and reused every frame. Changed text gets a new entry, and
+	* entries that go unused are evicted. Entries are rebuilt when their font is reloaded.
+	*/
+	class TextLayoutCache
+	{
+	public:
+		TextLayoutCache() = default;
+		~TextLayoutCache() = default;
+
+		/*
+		* @brief Returns the layout for the text, laying it out first if it is not cached.
+		* @return Returns the cached layout. Text that fails to wrap gets an empty layout.
+		*/
+		std::shared_ptr<const TextLayout> GetLayout(const std::string& text, const std::shared_ptr<Font>& font, float wrap, int padding);
+
+		/*
+		* @brief Advances the frame counter and evicts layouts that have not been used recently.
+		*/
+		void EndFrame();
+
+		inline void Clear() { m_mapLayouts.clear(); }
+		inline size_t Size() const { return m_mapLayouts.size(); }
+
+	private:
+		struct CachedLayout
+		{
+			std::shared_ptr<const TextLayout> layout{ nullptr };
+			/* @brief Expires when the font is reloaded or removed, invalidating the layout */
+			std::weak_ptr<Font> font{};
+			std::string text{};
+			float wrap{ 0.0f };
+			int padding{ 0 };
+			uint64_t lastUsedFrame{ 0 };
+		};
+
+		static std::shared_ptr<const TextLayout> CreateLayout(const std::string& text, Font& font, float wrap, int padding);
+
+	private:
+		/* @brief Layouts keyed by a hash of the font, text, wrap and padding. Collisions are resolved by rebuilding. */
+		std::unordered_map<size_t, CachedLayout> m_mapLayouts;
+		uint64_t m_FrameIndex{ 0 };
+	};
+
+}
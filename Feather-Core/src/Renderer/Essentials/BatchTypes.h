@@ -7,6 +7,8 @@
 
 namespace Feather {
 
+	struct TextLayout;
+
 	struct Batch
 	{
 		GLuint numIndices{ 0 };
@@ -70,13 +72,12 @@ namespace Feather {
 
 	struct TextGlyph
 	{
-		std::string textStr{};
+		/* Cached glyph quads of the text, relative to the position */
+		std::shared_ptr<const TextLayout> layout{ nullptr };
 		glm::vec2 position{ 0.0f };
 		Color color{ 255, 255, 255, 255 };
 		glm::mat4 model{ 1.0f };
-		std::shared_ptr<Font> font{ nullptr };
-		float wrap{ 0.0f };
-		int padding{ 0 };
+		GLuint fontAtlasID{ 0 };
 	};
 
 	struct PickingGlyph
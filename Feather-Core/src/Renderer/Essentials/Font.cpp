@@ -16,26 +16,22 @@ namespace Feather {
 		, m_Filename{ filename }
 	{
 		float x{ 0.0f }, y{ 0.0f };
+		float paddingX{ 0.0f }, paddingY{ 0.0f };
 
-		for (int i = 32; i < 128; i++)
+		for (int i = 0; i < FONT_NUM_CHARS; i++)
 		{
 			stbtt_aligned_quad quad;
-			stbtt_GetBakedQuad((stbtt_bakedchar*)(m_Data), m_Width, m_Height, i - 32, &x, &y, &quad, 1);
+			stbtt_GetBakedQuad((stbtt_bakedchar*)(m_Data), m_Width, m_Height, i, &x, &y, &quad, 1);
 
-			m_mapPaddingInfo.emplace(static_cast<char>(i),
-				PaddingInfo{ .paddingX = m_FontSize - (quad.x1 - quad.x0),
-							 .paddingY = m_FontSize - (quad.y1 - quad.y0) });
-		}
+			m_PaddingInfo[i] = PaddingInfo{ .paddingX = m_FontSize - (quad.x1 - quad.x0),
+											.paddingY = m_FontSize - (quad.y1 - quad.y0) };
 
-		float paddingX{ 0.0f }, paddingY{ 0.0f };
-		for (const auto& [c, paddingInfo] : m_mapPaddingInfo)
-		{
-			paddingX += paddingInfo.paddingX;
-			paddingY += paddingInfo.paddingY;
+			paddingX += m_PaddingInfo[i].paddingX;
+			paddingY += m_PaddingInfo[i].paddingY;
 		}
 
-		m_AveragePadding.paddingX = std::floor(paddingX / m_mapPaddingInfo.size());
-		m_AveragePadding.paddingY = std::floor(paddingY / m_mapPaddingInfo.size());
+		m_AveragePadding.paddingX = std::floor(paddingX / FONT_NUM_CHARS);
+		m_AveragePadding.paddingY = std::floor(paddingY / FONT_NUM_CHARS);
 	}
 
 	Font::~Font()
@@ -55,10 +51,10 @@ namespace Feather {
 		FontGlyph glyph{};
 		float y = pos.y + m_FontAscent;
 
-		if (c >= 32 && c < 128)
+		if (HasGlyph(c))
 		{
 			stbtt_aligned_quad quad;
-			stbtt_GetBakedQuad((stbtt_bakedchar*)(m_Data), m_Width, m_Height, c - 32, &pos.x, &y, &quad, 1);
+			stbtt_GetBakedQuad((stbtt_bakedchar*)(m_Data), m_Width, m_Height, c - FONT_FIRST_CHAR, &pos.x, &y, &quad, 1);
 
 			glyph.min = Vertex{ .position = glm::vec2{quad.x0, quad.y0}, .uvs = glm::vec2{quad.s0, quad.t0} };
 			glyph.max = Vertex{ .position = glm::vec2{quad.x1, quad.y1}, .uvs = glm::vec2{quad.s1, quad.t1} };
@@ -69,11 +65,16 @@ namespace Feather {
 
 	void Font::GetNextCharPos(char c, glm::vec2& pos)
 	{
-		if (c >= 32 && c < 128)
+		if (HasGlyph(c))
 		{
 			stbtt_aligned_quad quad;
-			stbtt_GetBakedQuad((stbtt_bakedchar*)(m_Data), m_Width, m_Height, c - 32, &pos.x, &pos.y, &quad, 1);
+			stbtt_GetBakedQuad((stbtt_bakedchar*)(m_Data), m_Width, m_Height, c - FONT_FIRST_CHAR, &pos.x, &pos.y, &quad, 1);
 		}
 	}
 
+	const PaddingInfo& Font::GetPaddingInfoForChar(char c) const
+	{
+		return HasGlyph(c) ? m_PaddingInfo[c - FONT_FIRST_CHAR] : m_AveragePadding;
+	}
+
 }
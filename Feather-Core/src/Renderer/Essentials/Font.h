@@ -2,7 +2,7 @@
 
 #include "Vertex.h"
 
-#include <map>
+#include <array>
 
 #include <glm/glm.hpp>
 #include <glad/glad.h>
@@ -21,6 +21,11 @@ namespace Feather {
 		float paddingY{ 0.0f };
 	};
 
+	/* First and one past the last character baked into the font atlas */
+	constexpr int FONT_FIRST_CHAR = 32;
+	constexpr int FONT_LAST_CHAR = 128;
+	constexpr int FONT_NUM_CHARS = FONT_LAST_CHAR - FONT_FIRST_CHAR;
+
 	class Font
 	{
 	public:
@@ -31,6 +36,8 @@ namespace Feather {
 		void GetNextCharPos(char c, glm::vec2& pos);
 		const PaddingInfo& GetPaddingInfoForChar(char c) const;
 
+		inline static constexpr bool HasGlyph(char c) { return c >= FONT_FIRST_CHAR && c < FONT_LAST_CHAR; }
+
 		inline const GLuint GetFontAtlasID() const { return m_FontAtlasID; }
 		inline const float GetFontSize() const { return m_FontSize; }
 		inline const PaddingInfo& AveragePaddingInfo() const { return m_AveragePadding; }
@@ -51,8 +58,8 @@ namespace Feather {
 		void* m_Data;
 		/* The average padding of all characters */
 		PaddingInfo m_AveragePadding;
-		/* Map of each character and their padding info */
-		std::map<char, PaddingInfo> m_mapPaddingInfo;
+		/* Padding info of each baked character, indexed by the character minus FONT_FIRST_CHAR */
+		std::array<PaddingInfo, FONT_NUM_CHARS> m_PaddingInfo;
 		/* Filename of font if loaded from a file */
 		std::string m_Filename;
 	};
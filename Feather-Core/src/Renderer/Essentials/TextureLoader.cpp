@@ -70,6 +70,63 @@ namespace Feather {
 		return nullptr;
 	}
 
+	void ImageDataDeleter::operator()(unsigned char* pData) const
+	{
+		SOIL_free_image_data(pData);
+	}
+
+	bool TextureLoader::DecodeImage(const std::string& texturePath, DecodedImage& image)
+	{
+		int channels = 0;
+		image.pixels.reset(SOIL_load_image(texturePath.c_str(), &image.width, &image.height, &channels, SOIL_LOAD_RGBA));
+
+		if (!image.pixels)
+		{
+			// SOIL_last_result is shared by every thread decoding at the same time, it may describe another image
+			F_ERROR("Failed to decode image '{}'", texturePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool TextureLoader::DecodeImageFromMemory(const unsigned char* imageData, size_t length, DecodedImage& image)
+	{
+		int channels = 0;
+		image.pixels.reset(SOIL_load_image_from_memory(imageData, static_cast<int>(length), &image.width, &image.height, &channels, SOIL_LOAD_RGBA));
+
+		if (!image.pixels)
+		{
+			F_ERROR("Failed to decode image from memory");
+			return false;
+		}
+
+		return true;
+	}
+
+	std::shared_ptr<Texture> TextureLoader::CreateFromImage(const DecodedImage& image, bool blended, const std::string& texturePath, bool isTileset)
+	{
+		if (!image.pixels)
+		{
+			F_ERROR("Failed to create texture. Image has not been decoded");
+			return nullptr;
+		}
+
+		GLuint id;
+		glGenTextures(1, &id);
+		glBindTexture(GL_TEXTURE_2D, id);
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, blended ? GL_LINEAR : GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, blended ? GL_LINEAR : GL_NEAREST);
+
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.width, image.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.get());
+
+		return std::make_shared<Texture>(
+			id, image.width, image.height, blended ? Texture::TextureType::BLENDED : Texture::TextureType::PIXEL, texturePath, isTileset);
+	}
+
     bool TextureLoader::LoadTexture(const std::string& filepath, GLuint& id, int& width, int& height, bool blended)
     {
 		int channels = 0;
@@ -6,6 +6,21 @@
 
 namespace Feather {
 
+	struct ImageDataDeleter
+	{
+		void operator()(unsigned char* pData) const;
+	};
+
+	/*
+	* RGBA pixels decoded on the CPU. Decoding does not touch OpenGL and can be done off the main thread.
+	*/
+	struct DecodedImage
+	{
+		std::unique_ptr<unsigned char, ImageDataDeleter> pixels{ nullptr };
+		int width{ 0 };
+		int height{ 0 };
+	};
+
 	class TextureLoader
 	{
 	public:
@@ -15,6 +30,18 @@ namespace Feather {
 
 		static std::shared_ptr<Texture> CreateFromMemory(const unsigned char* imageData, size_t length, bool blended = false, bool isTileset = false);
 
+		/*
+		* @brief Decodes an image file to RGBA pixels. Safe to call from worker threads.
+		* Failures are logged without SOIL's reason, SOIL keeps it in a global that other decodes overwrite.
+		*/
+		static bool DecodeImage(const std::string& texturePath, DecodedImage& image);
+		static bool DecodeImageFromMemory(const unsigned char* imageData, size_t length, DecodedImage& image);
+
+		/*
+		* @brief Uploads decoded pixels to a new texture. Must be called on the thread that owns the OpenGL context.
+		*/
+		static std::shared_ptr<Texture> CreateFromImage(const DecodedImage& image, bool blended = false, const std::string& texturePath = "", bool isTileset = false);
+
 	private:
 		static bool LoadTexture(const std::string& filepath, GLuint& id, int& width, int& height, bool blended = false);
 		static bool LoadFBTexture(GLuint& id, int& width, int& height);
@@ -0,0 +1,93 @@
+#include "AnimationBenchmark.h"
+#include "BenchmarkUtilities.h"
+
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Components/AllComponents.h"
+#include "Core/Systems/AnimationSystem.h"
+
+namespace Feather {
+
+	using namespace Benchmark;
+
+	namespace {
+
+		constexpr size_t NUM_ENTITIES = 10'000;
+		constexpr size_t NUM_FRAMES = 600;
+		constexpr double FRAME_TIME = 1.0 / 60.0;
+
+		/* Sprites cycling through a few strips of one sheet at different rates */
+		void CreateAnimatedSprites(Registry& registry, size_t numEntities, bool bTiles)
+		{
+			auto& reg = registry.GetRegistry();
+			for (size_t i = 0; i < numEntities; i++)
+			{
+				auto entity = registry.CreateEntity();
+				reg.emplace<TransformComponent>(entity, TransformComponent{ .position = glm::vec2{ static_cast<float>(i % 512) * 16.0f, static_cast<float>(i / 512) * 16.0f } });
+				reg.emplace<SpriteComponent>(entity, SpriteComponent{ .textureName = "sheet",
+																	  .uvs = UVs{ .uv_width = 1.0f / 16.0f, .uv_height = 1.0f / 8.0f },
+																	  .start_y = static_cast<int>(i % 8) });
+				reg.emplace<AnimationComponent>(entity, AnimationComponent{ .numFrames = 8, .frameRate = 6 + static_cast<int>(i % 4) * 2, .isLooped = true });
+
+				if (bTiles)
+					reg.emplace<TileComponent>(entity, TileComponent{ .id = static_cast<uint32_t>(entity) });
+			}
+		}
+
+		/* How the AnimationSystem updated the sprites before the clips, kept as the baseline */
+		void UpdatePerFrame(Registry& registry, uint32_t ticks)
+		{
+			auto view = registry.GetRegistry().view<AnimationComponent, SpriteComponent, TransformComponent>();
+			for (auto entity : view)
+			{
+				auto& sprite = view.get<SpriteComponent>(entity);
+				auto& animation = view.get<AnimationComponent>(entity);
+
+				if (registry.GetRegistry().all_of<UIComponent>(entity) || animation.numFrames <= 0)
+					continue;
+
+				animation.currentFrame = (ticks * animation.frameRate / 1000) % animation.numFrames;
+				sprite.uvs.u = (animation.currentFrame + sprite.start_x) * sprite.uvs.uv_width;
+				sprite.uvs.v = sprite.start_y * sprite.uvs.uv_height;
+			}
+		}
+
+	}
+
+	void RunAnimationBenchmark()
+	{
+		F_INFO("Running animation benchmark, {} entities over {} frames", NUM_ENTITIES, NUM_FRAMES);
+
+		for (bool bTiles : { false, true })
+		{
+			Registry perFrameRegistry{};
+			CreateAnimatedSprites(perFrameRegistry, NUM_ENTITIES, bTiles);
+			double perFrameMS = TimeMS([&] {
+				for (size_t frame = 0; frame < NUM_FRAMES; frame++)
+					UpdatePerFrame(perFrameRegistry, static_cast<uint32_t>(frame * FRAME_TIME * 1000.0));
+			});
+
+			Registry clipRegistry{};
+			CreateAnimatedSprites(clipRegistry, NUM_ENTITIES, bTiles);
+			AnimationSystem animationSystem{};
+			size_t numWrites{ 0 };
+			double clipMS = TimeMS([&] {
+				for (size_t frame = 0; frame < NUM_FRAMES; frame++)
+				{
+					animationSystem.Update(clipRegistry, FRAME_TIME);
+					numWrites += animationSystem.GetNumUpdated();
+				}
+			});
+
+			LogComparison(bTiles ? "Tiles" : "Sprites",
+						  "Per frame UVs",
+						  perFrameMS / NUM_FRAMES,
+						  "Clips",
+						  clipMS / NUM_FRAMES,
+						  "ms/frame",
+						  std::format("{} clips, {:.0f} sprite writes/frame",
+									  animationSystem.GetNumClips(),
+									  static_cast<double>(numWrites) / NUM_FRAMES));
+		}
+	}
+
+}
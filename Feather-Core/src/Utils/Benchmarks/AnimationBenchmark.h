@@ -0,0 +1,11 @@
+#pragma once
+
+namespace Feather {
+
+	/*
+	* @brief Times the AnimationSystem on animated sprites and tiles against the previous per frame UV recompute, and logs the results.
+	* Runs on the calling thread and takes about a second.
+	*/
+	void RunAnimationBenchmark();
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Logger/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+
+namespace Feather::Benchmark {
+
+	/*
+	* @brief Runs the function once on the calling thread.
+	* @return Returns the elapsed wall time in milliseconds.
+	*/
+	template <typename Func>
+	double TimeMS(Func&& func)
+	{
+		auto start = std::chrono::steady_clock::now();
+		func();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	/* How many times faster the optimized time is, clamped so a zero time does not divide by zero */
+	inline double SpeedUp(double baselineMS, double optimizedMS) { return baselineMS / std::max(optimizedMS, 0.001); }
+
+	/*
+	* @brief Logs one result row comparing the baseline against the optimized path.
+	* @param label Name of the case, left aligned so the rows of a benchmark line up.
+	* @param unit Unit printed after both times, e.g. "ms" or "ms/frame".
+	* @param details Optional text appended to the end of the row.
+	*/
+	inline void LogComparison(std::string_view label, std::string_view baselineName, double baselineMS,
+							  std::string_view optimizedName, double optimizedMS, std::string_view unit = "ms",
+							  std::string_view details = "")
+	{
+		F_INFO("{:<28} {}: {:>9.4f} {} | {}: {:>9.4f} {} | {:.2f}x{}{}",
+			   label,
+			   baselineName,
+			   baselineMS,
+			   unit,
+			   optimizedName,
+			   optimizedMS,
+			   unit,
+			   SpeedUp(baselineMS, optimizedMS),
+			   details.empty() ? "" : " | ",
+			   details);
+	}
+
+}
@@ -0,0 +1,204 @@
+#include "JobSystemBenchmark.h"
+
+#include "BenchmarkUtilities.h"
+#include "Utils/JobSystem.h"
+
+#include <condition_variable>
+#include <queue>
+
+namespace Feather {
+
+	using namespace Benchmark;
+
+	namespace {
+
+		/*
+		* @brief The thread pool the job system replaced, kept as the baseline.
+		* One mutex guarded queue and a heap allocated packaged_task per job.
+		*/
+		class LegacyThreadPool
+		{
+		public:
+			explicit LegacyThreadPool(size_t threadCount)
+			{
+				for (size_t i = 0; i < threadCount; i++)
+				{
+					m_Workers.emplace_back([this] {
+						while (true)
+						{
+							std::function<void()> task;
+							{
+								std::unique_lock lock{ m_QueueMutex };
+								m_Condition.wait(lock, [this] { return m_Stopped || !m_Tasks.empty(); });
+
+								if (m_Stopped && m_Tasks.empty())
+									return;
+
+								task = std::move(m_Tasks.front());
+								m_Tasks.pop();
+							}
+
+							task();
+						}
+					});
+				}
+			}
+
+			~LegacyThreadPool()
+			{
+				{
+					std::lock_guard lock{ m_QueueMutex };
+					m_Stopped = true;
+				}
+
+				m_Condition.notify_all();
+				for (auto& thread : m_Workers)
+				{
+					thread.join();
+				}
+			}
+
+			template <typename Func>
+			auto Enqueue(Func&& func) -> std::future<std::invoke_result_t<Func>>
+			{
+				using ReturnType = std::invoke_result_t<Func>;
+
+				auto taskPtr = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Func>(func));
+				{
+					std::lock_guard lock{ m_QueueMutex };
+					m_Tasks.emplace([taskPtr]() { (*taskPtr)(); });
+				}
+
+				m_Condition.notify_one();
+				return taskPtr->get_future();
+			}
+
+		private:
+			std::vector<std::thread> m_Workers;
+			std::queue<std::function<void()>> m_Tasks;
+			std::mutex m_QueueMutex;
+			std::condition_variable m_Condition;
+			bool m_Stopped{ false };
+		};
+
+		constexpr size_t NUM_SMALL_JOBS = 100'000;
+		constexpr size_t NUM_ELEMENTS = 4'000'000;
+		constexpr size_t GRAIN_SIZE = 4096;
+
+		/* Small amount of work that the compiler cannot remove */
+		inline uint32_t SimulateWork(uint32_t seed)
+		{
+			for (int i = 0; i < 64; i++)
+			{
+				seed = seed * 1664525u + 1013904223u;
+			}
+
+			return seed;
+		}
+
+	}
+
+	void RunJobSystemBenchmark()
+	{
+		size_t hardwareThreads = std::thread::hardware_concurrency();
+		size_t numWorkers = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+
+		F_INFO("Running job system benchmark with {} worker threads", numWorkers);
+
+		LegacyThreadPool legacyPool{ numWorkers };
+		JobSystem jobSystem{ numWorkers };
+
+		std::vector<uint32_t> results(NUM_SMALL_JOBS);
+
+		// Many tiny independent jobs, measures the per job overhead
+		double legacySmallJobs = TimeMS([&] {
+			std::vector<std::future<void>> futures;
+			futures.reserve(NUM_SMALL_JOBS);
+			for (size_t i = 0; i < NUM_SMALL_JOBS; i++)
+			{
+				futures.push_back(legacyPool.Enqueue([&results, i] { results[i] = SimulateWork(static_cast<uint32_t>(i)); }));
+			}
+
+			for (auto& future : futures)
+			{
+				future.wait();
+			}
+		});
+
+		double jobSmallJobs = TimeMS([&] {
+			JobCounter counter{};
+			for (size_t i = 0; i < NUM_SMALL_JOBS; i++)
+			{
+				jobSystem.Submit([&results, i] { results[i] = SimulateWork(static_cast<uint32_t>(i)); }, &counter);
+			}
+
+			jobSystem.Wait(counter);
+		});
+
+		LogComparison(std::format("{} small jobs", NUM_SMALL_JOBS), "ThreadPool", legacySmallJobs, "JobSystem", jobSmallJobs);
+
+		// Data parallel loop split into ranges
+		std::vector<float> elements(NUM_ELEMENTS, 1.0f);
+		auto transformRange = [&elements](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++)
+			{
+				elements[i] = std::sqrt(elements[i] * 1.5f + static_cast<float>(i));
+			}
+		};
+
+		double legacyParallelFor = TimeMS([&] {
+			std::vector<std::future<void>> futures;
+			for (size_t begin = 0; begin < NUM_ELEMENTS; begin += GRAIN_SIZE)
+			{
+				size_t end = std::min(begin + GRAIN_SIZE, NUM_ELEMENTS);
+				futures.push_back(legacyPool.Enqueue([&transformRange, begin, end] { transformRange(begin, end); }));
+			}
+
+			for (auto& future : futures)
+			{
+				future.wait();
+			}
+		});
+
+		double jobParallelFor = TimeMS([&] { jobSystem.ParallelFor(NUM_ELEMENTS, GRAIN_SIZE, transformRange); });
+
+		LogComparison(std::format("ParallelFor {} elements", NUM_ELEMENTS), "ThreadPool", legacyParallelFor, "JobSystem", jobParallelFor);
+
+		// Nested fork-join. The old pool cannot wait inside a job without risking deadlock, so it only runs on the job system
+		constexpr size_t NUM_PARENTS = 256;
+		constexpr size_t NUM_CHILDREN = 256;
+		std::vector<uint32_t> parentResults(NUM_PARENTS);
+
+		double jobNested = TimeMS([&] {
+			JobCounter parents{};
+			for (size_t p = 0; p < NUM_PARENTS; p++)
+			{
+				jobSystem.Submit(
+					[&jobSystem, &parentResults, p] {
+						std::array<uint32_t, NUM_CHILDREN> childResults{};
+						JobCounter children{};
+						for (size_t c = 0; c < NUM_CHILDREN; c++)
+						{
+							jobSystem.Submit([&childResults, c] { childResults[c] = SimulateWork(static_cast<uint32_t>(c)); }, &children);
+						}
+
+						jobSystem.Wait(children);
+
+						uint32_t sum{ 0 };
+						for (auto result : childResults)
+						{
+							sum += result;
+						}
+
+						parentResults[p] = sum;
+					},
+					&parents);
+			}
+
+			jobSystem.Wait(parents);
+		});
+
+		F_INFO("{:<28} JobSystem: {:>9.3f} ms", std::format("Nested {}x{} jobs", NUM_PARENTS, NUM_CHILDREN), jobNested);
+	}
+
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace Feather {
+
+	/*
+	* @brief Times the job system against the previous single queue thread pool and logs the results.
+	* Runs on the calling thread and takes a few seconds.
+	*/
+	void RunJobSystemBenchmark();
+
+}
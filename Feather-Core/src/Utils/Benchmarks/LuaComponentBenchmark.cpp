@@ -0,0 +1,168 @@
+#include "LuaComponentBenchmark.h"
+
+#include "Core/ECS/Entity.h"
+#include "Core/ECS/MetaUtilities.h"
+#include "Core/ECS/RegistryQuery.h"
+#include "Core/ECS/Components/AllComponents.h"
+#include "Core/Scripting/GlmLuaBindings.h"
+#include "Logger/Logger.h"
+
+using namespace entt::literals;
+
+namespace Feather {
+
+	namespace {
+
+		constexpr size_t NUM_CALLS = 1'000'000;
+		constexpr size_t NUM_VIEW_ENTITIES = 10'000;
+		constexpr size_t NUM_VIEW_FRAMES = 20;
+
+		struct LuaBenchmarkCase
+		{
+			std::string name;
+			/* Lua statement called NUM_CALLS times, with `entity` in scope */
+			std::string call;
+		};
+
+		/* How the Entity usertype reached the components before the dispatch table, kept as the baseline */
+		void CreateMetaDispatchBind(sol::state& lua)
+		{
+			lua["Entity"]["getComponentMeta"] = [](Entity& entity, const sol::table& comp, sol::this_state s) {
+				const auto component = InvokeMetaFunction(GetIdType(comp), "get_component"_hs, entity, s);
+				return component ? component.cast<sol::reference>() : sol::lua_nil_t{};
+			};
+
+			lua["Entity"]["hasComponentMeta"] = [](Entity& entity, const sol::table& comp) {
+				const auto has_comp = InvokeMetaFunction(GetIdType(comp), "has_component"_hs, entity);
+				return has_comp ? has_comp.cast<bool>() : false;
+			};
+		}
+
+		/*
+		* @brief Runs the call in a Lua loop.
+		* @return Returns the calls per second, or zero if the script failed.
+		*/
+		double RunCase(sol::state& lua, entt::entity entity, const LuaBenchmarkCase& benchmarkCase)
+		{
+			auto script = std::format("local entity = Entity({})\nfor i = 1, {} do\n\t{}\nend", static_cast<uint32_t>(entity), NUM_CALLS, benchmarkCase.call);
+			auto chunk = lua.load(script);
+			if (!chunk.valid())
+			{
+				sol::error error = chunk;
+				F_ERROR("Failed to load benchmark '{}': {}", benchmarkCase.name, error.what());
+				return 0.0;
+			}
+
+			sol::protected_function loop = chunk;
+			auto start = std::chrono::steady_clock::now();
+			auto result = loop();
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			if (!result.valid())
+			{
+				sol::error error = result;
+				F_ERROR("Failed to run benchmark '{}': {}", benchmarkCase.name, error.what());
+				return 0.0;
+			}
+
+			return static_cast<double>(NUM_CALLS) / std::max(seconds, 0.000001);
+		}
+
+		/*
+		* @brief Runs the script once.
+		* @return Returns the time in milliseconds, or zero if the script failed.
+		*/
+		double RunScript(sol::state& lua, const std::string& name, const std::string& script)
+		{
+			auto start = std::chrono::steady_clock::now();
+			auto result = lua.safe_script(script, sol::script_pass_on_error);
+			double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			if (!result.valid())
+			{
+				sol::error error = result;
+				F_ERROR("Failed to run benchmark '{}': {}", name, error.what());
+				return 0.0;
+			}
+
+			return milliseconds;
+		}
+
+	}
+
+	void RunLuaComponentBenchmark()
+	{
+		F_INFO("Running Lua component benchmark with {} calls per case", NUM_CALLS);
+
+		Registry registry{};
+		Entity entity{ &registry, "LuaBenchmark", "" };
+		entity.AddComponent<TransformComponent>();
+		entity.AddComponent<SpriteComponent>();
+
+		sol::state lua{};
+		lua.open_libraries(sol::lib::base);
+
+		GLMBinding::CreateGLMBindings(lua);
+		Registry::CreateLuaRegistryBind(lua, registry);
+		RegistryQuery::CreateLuaQueryBind(lua);
+		Entity::CreateLuaEntityBind(lua, registry);
+		TransformComponent::CreateLuaTransformBind(lua);
+		SpriteComponent::CreateSpriteLuaBind(lua);
+		CreateMetaDispatchBind(lua);
+
+		const std::vector<LuaBenchmarkCase> cases{
+			{ .name = "getComponent (meta)", .call = "local transform = entity:getComponentMeta(Transform)" },
+			{ .name = "getComponent", .call = "local transform = entity:getComponent(Transform)" },
+			{ .name = "entity:transform()", .call = "local transform = entity:transform()" },
+			{ .name = "hasComponent (meta)", .call = "local hasSprite = entity:hasComponentMeta(Sprite)" },
+			{ .name = "hasComponent", .call = "local hasSprite = entity:hasComponent(Sprite)" },
+			// Scripts usually add components by instance, which reaches the dispatch as userdata
+			{ .name = "add instance + remove",
+			  .call = "entity:removeComponent(Transform) local transform = entity:addComponent(Transform(vec2(0, 0), vec2(1, 1), 0))" },
+			{ .name = "Empty loop", .call = "local nothing = entity" }
+		};
+
+		for (const auto& benchmarkCase : cases)
+		{
+			double callsPerSecond = RunCase(lua, entity.GetEntity(), benchmarkCase);
+			F_INFO("{:<22} {:>8.2f} M calls/s | {:>7.1f} ns/call",
+				   benchmarkCase.name,
+				   callsPerSecond / 1'000'000.0,
+				   callsPerSecond > 0.0 ? 1'000'000'000.0 / callsPerSecond : 0.0);
+		}
+
+		// A system written in Lua visiting every entity with a transform, once per frame
+		for (size_t i = 0; i < NUM_VIEW_ENTITIES; i++)
+		{
+			registry.GetRegistry().emplace<TransformComponent>(registry.CreateEntity());
+		}
+
+		double forEachMS = RunScript(lua, "for_each", std::format(R"(
+			local view = Registry():getEntities(Transform)
+			for frame = 1, {} do
+				view:for_each(function(entity)
+					local transform = entity:getComponent(Transform)
+					transform.rotation = transform.rotation + 1
+				end)
+			end)", NUM_VIEW_FRAMES));
+
+		double chunkMS = RunScript(lua, "forEachChunk", std::format(R"(
+			local query = Registry():query(Transform)
+			for frame = 1, {} do
+				query:forEachChunk(function(chunk, count)
+					local transforms = chunk[1]
+					for i = 1, count do
+						local transform = transforms[i]
+						transform.rotation = transform.rotation + 1
+					end
+				end)
+			end)", NUM_VIEW_FRAMES));
+
+		F_INFO("{:<22} for_each: {:>8.3f} ms/frame | forEachChunk: {:>8.3f} ms/frame | {:.2f}x",
+			   std::format("{} entities", NUM_VIEW_ENTITIES + 1),
+			   forEachMS / NUM_VIEW_FRAMES,
+			   chunkMS / NUM_VIEW_FRAMES,
+			   forEachMS / std::max(chunkMS, 0.001));
+	}
+
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace Feather {
+
+	/*
+	* @brief Times the Lua component accessors of the Entity usertype against the previous entt::meta dispatch, and chunked
+	* queries against runtime_view:for_each, and logs the results.
+	* Needs the component meta functions to be registered. Runs on the calling thread and takes a few seconds.
+	*/
+	void RunLuaComponentBenchmark();
+
+}
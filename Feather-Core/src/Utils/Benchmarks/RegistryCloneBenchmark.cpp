@@ -0,0 +1,101 @@
+#include "RegistryCloneBenchmark.h"
+#include "BenchmarkUtilities.h"
+
+#include "Core/ECS/Entity.h"
+#include "Core/ECS/MetaUtilities.h"
+#include "Core/ECS/Components/AllComponents.h"
+
+using namespace entt::literals;
+
+namespace Feather {
+
+	using namespace Benchmark;
+
+	namespace {
+
+		constexpr std::array<size_t, 3> NUM_ENTITIES{ 10'000, 50'000, 150'000 };
+		/* Every n-th entity is the parent of the next one */
+		constexpr size_t PARENT_INTERVAL = 4;
+
+		/* Scene shaped like a tilemap with a few parented objects */
+		void CreateScene(Registry& registry, size_t numEntities)
+		{
+			auto& reg = registry.GetRegistry();
+			entt::entity parent{ entt::null };
+
+			for (size_t i = 0; i < numEntities; i++)
+			{
+				auto entity = registry.CreateEntity();
+				reg.emplace<Identification>(entity, Identification{ .name = std::format("Tile_{}", i), .group = "Tiles", .entity_id = static_cast<uint32_t>(entity) });
+				reg.emplace<TransformComponent>(entity, TransformComponent{ .position = glm::vec2{ static_cast<float>(i % 512) * 16.0f, static_cast<float>(i / 512) * 16.0f } });
+				reg.emplace<SpriteComponent>(entity, SpriteComponent{ .textureName = "tileset", .start_x = static_cast<int>(i % 16), .start_y = static_cast<int>(i % 8) });
+				reg.emplace<TileComponent>(entity);
+
+				if (i % PARENT_INTERVAL == 0)
+				{
+					parent = entity;
+					reg.emplace<Relationship>(entity, Relationship{ .self = entity });
+				}
+				else if (i % PARENT_INTERVAL == 1)
+				{
+					reg.emplace<Relationship>(entity, Relationship{ .self = entity, .parent = parent });
+					reg.get<Relationship>(parent).firstChild = entity;
+				}
+			}
+		}
+
+		/* How Play mode copied the scene before, one meta call per component of every entity */
+		void CopyPerComponent(Registry& source, Registry& destination)
+		{
+			auto& sourceReg = source.GetRegistry();
+			for (auto entityToCopy : sourceReg.view<entt::entity>())
+			{
+				entt::entity newEntity = destination.CreateEntity();
+				for (auto&& [id, storage] : sourceReg.storage())
+				{
+					if (!storage.contains(entityToCopy))
+						continue;
+
+					InvokeMetaFunction(id, "copy_component"_hs, Entity{ &source, entityToCopy }, Entity{ &destination, newEntity });
+				}
+			}
+		}
+
+		size_t ComponentBytes(entt::registry& registry)
+		{
+			return registry.storage<Identification>().size() * sizeof(Identification) +
+				   registry.storage<TransformComponent>().size() * sizeof(TransformComponent) +
+				   registry.storage<SpriteComponent>().size() * sizeof(SpriteComponent) +
+				   registry.storage<TileComponent>().size() * sizeof(TileComponent) +
+				   registry.storage<Relationship>().size() * sizeof(Relationship);
+		}
+
+	}
+
+	void RunRegistryCloneBenchmark()
+	{
+		F_INFO("Running registry clone benchmark");
+
+		for (size_t numEntities : NUM_ENTITIES)
+		{
+			Registry scene{};
+			CreateScene(scene, numEntities);
+
+			Registry perComponentRuntime{};
+			double perComponentMS = TimeMS([&] { CopyPerComponent(scene, perComponentRuntime); });
+
+			Registry clonedRuntime{};
+			double cloneMS = TimeMS([&] { scene.CloneEntities(clonedRuntime); });
+
+			double megabytes = static_cast<double>(ComponentBytes(scene.GetRegistry())) / (1024.0 * 1024.0);
+			LogComparison(std::format("{} entities", numEntities),
+						  "Per component",
+						  perComponentMS,
+						  "Storage clone",
+						  cloneMS,
+						  "ms",
+						  std::format("{:.0f} MB/s", megabytes / std::max(cloneMS / 1000.0, 0.000001)));
+		}
+	}
+
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace Feather {
+
+	/*
+	* @brief Times entering Play mode, cloning a scene registry per component against Registry::CloneEntities, and logs the results.
+	* Needs the component meta functions to be registered. Runs on the calling thread and takes a few seconds.
+	*/
+	void RunRegistryCloneBenchmark();
+
+}
@@ -0,0 +1,242 @@
+#include "JobSystem.h"
+
+#include "Logger/Logger.h"
+
+namespace Feather {
+
+	namespace {
+
+		/* Queue owned by the current thread if it is a worker of t_pJobSystem */
+		thread_local JobSystem* t_pJobSystem{ nullptr };
+		thread_local size_t t_QueueIndex{ 0 };
+
+		/* Number of times an idle worker yields before going to sleep */
+		constexpr int WORKER_SPIN_COUNT = 64;
+
+	}
+
+	bool JobSystem::WorkQueue::Push(Job& job)
+	{
+		std::scoped_lock lock{ mutex };
+
+		size_t currentTail = tail.load(std::memory_order_relaxed);
+		if (currentTail - head.load(std::memory_order_relaxed) == CAPACITY)
+			return false;
+
+		jobs[currentTail % CAPACITY] = std::move(job);
+		tail.store(currentTail + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool JobSystem::WorkQueue::Pop(Job& outJob)
+	{
+		// Skips taking the lock of an empty queue, the check is repeated under the lock
+		if (head.load(std::memory_order_relaxed) == tail.load(std::memory_order_relaxed))
+			return false;
+
+		std::scoped_lock lock{ mutex };
+
+		size_t currentTail = tail.load(std::memory_order_relaxed);
+		if (head.load(std::memory_order_relaxed) == currentTail)
+			return false;
+
+		--currentTail;
+		outJob = std::move(jobs[currentTail % CAPACITY]);
+		tail.store(currentTail, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool JobSystem::WorkQueue::Steal(Job& outJob)
+	{
+		if (head.load(std::memory_order_relaxed) == tail.load(std::memory_order_relaxed))
+			return false;
+
+		std::scoped_lock lock{ mutex };
+
+		size_t currentHead = head.load(std::memory_order_relaxed);
+		if (currentHead == tail.load(std::memory_order_relaxed))
+			return false;
+
+		outJob = std::move(jobs[currentHead % CAPACITY]);
+		head.store(currentHead + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	JobSystem::JobSystem(size_t numWorkers)
+		: m_MainThreadID{ std::this_thread::get_id() }
+	{
+		if (numWorkers == 0)
+		{
+			size_t hardwareThreads = std::thread::hardware_concurrency();
+			numWorkers = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		for (size_t i = 0; i < numWorkers + 1; i++)
+		{
+			m_Queues.push_back(std::make_unique<WorkQueue>());
+		}
+
+		m_Workers.reserve(numWorkers);
+		for (size_t i = 0; i < numWorkers; i++)
+		{
+			m_Workers.emplace_back([this, i] { WorkerLoop(i); });
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		m_Stopped = true;
+		m_WakeSignal.fetch_add(1);
+		m_WakeSignal.notify_all();
+
+		for (auto& worker : m_Workers)
+		{
+			if (worker.joinable())
+				worker.join();
+		}
+
+		if (!m_MainThreadJobs.empty())
+			F_WARN("Job system destroyed with {} main thread jobs that never ran", m_MainThreadJobs.size());
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		bool isMainThread = IsMainThread();
+
+		while (!counter.IsDone())
+		{
+			// Main thread jobs may be part of the group being waited on
+			if (isMainThread)
+				RunMainThreadJobs();
+
+			if (!TryRunJob())
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::RunMainThreadJobs()
+	{
+		F_ASSERT(IsMainThread() && "Main thread jobs must be run from the main thread");
+
+		std::vector<Job> jobs;
+		{
+			std::scoped_lock lock{ m_MainThreadMutex };
+			if (m_MainThreadJobs.empty())
+				return;
+
+			jobs.swap(m_MainThreadJobs);
+		}
+
+		for (auto& job : jobs)
+		{
+			Execute(job);
+		}
+	}
+
+	bool JobSystem::IsMainThread() const
+	{
+		return std::this_thread::get_id() == m_MainThreadID;
+	}
+
+	void JobSystem::Push(Job&& job)
+	{
+		size_t queueIndex = t_pJobSystem == this ? t_QueueIndex : m_Queues.size() - 1;
+
+		// Counted before the push so a worker cannot go to sleep between the push and the wake up below
+		m_NumQueued.fetch_add(1);
+
+		if (!m_Queues[queueIndex]->Push(job))
+		{
+			// The queue is full, running the job now keeps the caller from having to wait
+			m_NumQueued.fetch_sub(1);
+			Execute(job);
+			return;
+		}
+
+		if (m_NumSleeping.load() > 0)
+		{
+			m_WakeSignal.fetch_add(1);
+			m_WakeSignal.notify_one();
+		}
+	}
+
+	bool JobSystem::TryRunJob()
+	{
+		Job job{};
+		if (!FindJob(job))
+			return false;
+
+		Execute(job);
+		return true;
+	}
+
+	bool JobSystem::FindJob(Job& outJob)
+	{
+		if (m_NumQueued.load(std::memory_order_relaxed) == 0)
+			return false;
+
+		size_t ownIndex = t_pJobSystem == this ? t_QueueIndex : m_Queues.size() - 1;
+		bool found = m_Queues[ownIndex]->Pop(outJob);
+
+		for (size_t i = 1; i < m_Queues.size() && !found; i++)
+		{
+			found = m_Queues[(ownIndex + i) % m_Queues.size()]->Steal(outJob);
+		}
+
+		if (found)
+			m_NumQueued.fetch_sub(1, std::memory_order_relaxed);
+
+		return found;
+	}
+
+	void JobSystem::Execute(Job& job)
+	{
+		JobCounter* pCounter = job.GetCounter();
+		job();
+		// Release the captures before signaling, the waiter may destroy what they reference
+		job.Reset();
+
+		if (pCounter)
+			pCounter->m_Pending.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	void JobSystem::WorkerLoop(size_t queueIndex)
+	{
+		t_pJobSystem = this;
+		t_QueueIndex = queueIndex;
+
+		Job job{};
+		while (true)
+		{
+			if (FindJob(job))
+			{
+				Execute(job);
+				continue;
+			}
+
+			if (m_Stopped && m_NumQueued.load() == 0)
+				break;
+
+			bool hasWork{ false };
+			for (int i = 0; i < WORKER_SPIN_COUNT && !hasWork; i++)
+			{
+				std::this_thread::yield();
+				hasWork = m_NumQueued.load(std::memory_order_relaxed) > 0;
+			}
+
+			if (hasWork)
+				continue;
+
+			uint32_t wakeSignal = m_WakeSignal.load();
+			m_NumSleeping.fetch_add(1);
+
+			if (m_NumQueued.load() == 0 && !m_Stopped)
+				m_WakeSignal.wait(wakeSignal);
+
+			m_NumSleeping.fetch_sub(1);
+		}
+
+		t_pJobSystem = nullptr;
+	}
+
+}
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <future>
+
+namespace Feather {
+
+	/*
+	* @brief Counts the unfinished jobs of a group. Pass it to Submit and then Wait on it for fork-join style work.
+	* Must outlive the jobs that were submitted with it.
+	*/
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		inline bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+	private:
+		friend class JobSystem;
+		std::atomic<uint32_t> m_Pending{ 0 };
+	};
+
+	/*
+	* @brief Type erased, move-only callable.
+	* Callables that fit in INLINE_SIZE bytes are stored inline, so submitting them does not allocate.
+	*/
+	class Job
+	{
+	public:
+		static constexpr size_t INLINE_SIZE = 48;
+
+		Job() = default;
+
+		template <typename Func>
+		Job(Func&& func, JobCounter* pCounter)
+			: m_pCounter{ pCounter }
+		{
+			using FuncType = std::decay_t<Func>;
+
+			if constexpr (sizeof(FuncType) <= INLINE_SIZE && alignof(FuncType) <= alignof(std::max_align_t) &&
+						  std::is_nothrow_move_constructible_v<FuncType>)
+			{
+				new (m_Storage) FuncType(std::forward<Func>(func));
+				m_pOps = &s_InlineOps<FuncType>;
+			}
+			else
+			{
+				// Large captures fall back to the heap
+				new (m_Storage) FuncType*(new FuncType(std::forward<Func>(func)));
+				m_pOps = &s_HeapOps<FuncType>;
+			}
+		}
+
+		Job(Job&& other) noexcept { MoveFrom(other); }
+		Job& operator=(Job&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				MoveFrom(other);
+			}
+
+			return *this;
+		}
+
+		Job(const Job&) = delete;
+		Job& operator=(const Job&) = delete;
+
+		~Job() { Reset(); }
+
+		inline void operator()() { m_pOps->invoke(m_Storage); }
+		inline explicit operator bool() const { return m_pOps != nullptr; }
+		inline JobCounter* GetCounter() const { return m_pCounter; }
+
+		void Reset()
+		{
+			if (m_pOps)
+			{
+				m_pOps->destroy(m_Storage);
+				m_pOps = nullptr;
+			}
+
+			m_pCounter = nullptr;
+		}
+
+	private:
+		struct Ops
+		{
+			void (*invoke)(void*);
+			/* Move constructs into the destination and destroys the source */
+			void (*move)(void* pDst, void* pSrc);
+			void (*destroy)(void*);
+		};
+
+		template <typename FuncType>
+		static constexpr Ops s_InlineOps{
+			[](void* pFunc) { (*static_cast<FuncType*>(pFunc))(); },
+			[](void* pDst, void* pSrc) {
+				new (pDst) FuncType(std::move(*static_cast<FuncType*>(pSrc)));
+				static_cast<FuncType*>(pSrc)->~FuncType();
+			},
+			[](void* pFunc) { static_cast<FuncType*>(pFunc)->~FuncType(); } };
+
+		template <typename FuncType>
+		static constexpr Ops s_HeapOps{
+			[](void* pFunc) { (**static_cast<FuncType**>(pFunc))(); },
+			[](void* pDst, void* pSrc) { new (pDst) FuncType*(*static_cast<FuncType**>(pSrc)); },
+			[](void* pFunc) { delete *static_cast<FuncType**>(pFunc); } };
+
+		void MoveFrom(Job& other)
+		{
+			if (other.m_pOps)
+			{
+				other.m_pOps->move(m_Storage, other.m_Storage);
+				m_pOps = other.m_pOps;
+				other.m_pOps = nullptr;
+			}
+
+			m_pCounter = other.m_pCounter;
+			other.m_pCounter = nullptr;
+		}
+
+	private:
+		alignas(std::max_align_t) std::byte m_Storage[INLINE_SIZE];
+		const Ops* m_pOps{ nullptr };
+		JobCounter* m_pCounter{ nullptr };
+	};
+
+	/*
+	* @brief Work-stealing job system.
+	* Each worker owns a queue it pushes to and pops from at the back, idle workers steal from the front
+	* of the other queues. Threads that are not workers share one extra queue. Waiting on a counter runs
+	* other jobs instead of blocking, so jobs may submit and wait on jobs of their own.
+	* Jobs that must run on the main thread, such as GL work, are submitted with SubmitMainThread.
+	*/
+	class JobSystem
+	{
+	public:
+		/*
+		* @brief Creates the workers. The calling thread becomes the main thread.
+		* @param numWorkers Number of worker threads, zero uses one less than the number of hardware threads.
+		*/
+		explicit JobSystem(size_t numWorkers = 0);
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		/*
+		* @brief Queues the job on the calling thread's queue. If a counter is given it is incremented
+		* now and decremented once the job has run.
+		*/
+		template <typename Func>
+		void Submit(Func&& func, JobCounter* pCounter = nullptr)
+		{
+			if (pCounter)
+				pCounter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+			Push(Job{ std::forward<Func>(func), pCounter });
+		}
+
+		/*
+		* @brief Queues the function and returns a future for its result.
+		*/
+		template <typename Func, typename... Args>
+		auto Enqueue(Func&& func, Args&&... args) -> std::future<std::invoke_result_t<Func, Args...>>
+		{
+			using ReturnType = std::invoke_result_t<Func, Args...>;
+
+			std::packaged_task<ReturnType()> task{ std::bind(std::forward<Func>(func), std::forward<Args>(args)...) };
+			auto future = task.get_future();
+			Submit([task = std::move(task)]() mutable { task(); });
+
+			return future;
+		}
+
+		/*
+		* @brief Splits [0, count) into ranges of grainSize and calls func(begin, end) for each range in parallel.
+		* The calling thread runs ranges too and returns once all of them are done.
+		* @param grainSize Number of indices per job, zero picks a size that gives each thread a few jobs.
+		*/
+		template <typename Func>
+		void ParallelFor(size_t count, size_t grainSize, Func&& func)
+		{
+			if (count == 0)
+				return;
+
+			if (grainSize == 0)
+				grainSize = std::max<size_t>(1, count / ((m_Workers.size() + 1) * 4));
+
+			JobCounter counter{};
+			for (size_t begin = grainSize; begin < count; begin += grainSize)
+			{
+				size_t end = std::min(begin + grainSize, count);
+				Submit([&func, begin, end] { func(begin, end); }, &counter);
+			}
+
+			func(size_t{ 0 }, std::min(grainSize, count));
+			Wait(counter);
+		}
+
+		/*
+		* @brief Runs queued jobs on the calling thread until every job of the counter has finished.
+		*/
+		void Wait(const JobCounter& counter);
+
+		/*
+		* @brief Queues a job that is run by RunMainThreadJobs, or while the main thread waits.
+		*/
+		template <typename Func>
+		void SubmitMainThread(Func&& func, JobCounter* pCounter = nullptr)
+		{
+			if (pCounter)
+				pCounter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+			std::scoped_lock lock{ m_MainThreadMutex };
+			m_MainThreadJobs.emplace_back(std::forward<Func>(func), pCounter);
+		}
+
+		/*
+		* @brief Runs the jobs queued for the main thread. Must be called from the main thread, usually once a frame.
+		*/
+		void RunMainThreadJobs();
+
+		bool IsMainThread() const;
+		inline size_t GetNumWorkers() const { return m_Workers.size(); }
+
+	private:
+		/*
+		* @brief Bounded ring of jobs. The owner uses the back and thieves take from the front.
+		*/
+		struct WorkQueue
+		{
+			static constexpr size_t CAPACITY = 4096;
+
+			std::mutex mutex;
+			std::unique_ptr<Job[]> jobs{ std::make_unique<Job[]>(CAPACITY) };
+			/* Only written under the mutex. Atomic so empty queues can be skipped without locking */
+			std::atomic<size_t> head{ 0 };
+			std::atomic<size_t> tail{ 0 };
+
+			bool Push(Job& job);
+			bool Pop(Job& outJob);
+			bool Steal(Job& outJob);
+		};
+
+		void Push(Job&& job);
+		bool TryRunJob();
+		bool FindJob(Job& outJob);
+		void Execute(Job& job);
+		void WorkerLoop(size_t queueIndex);
+
+	private:
+		std::vector<std::thread> m_Workers;
+		/* One queue per worker, the last queue is shared by every other thread */
+		std::vector<std::unique_ptr<WorkQueue>> m_Queues;
+		std::thread::id m_MainThreadID;
+
+		std::mutex m_MainThreadMutex;
+		std::vector<Job> m_MainThreadJobs;
+
+		std::atomic<size_t> m_NumQueued{ 0 };
+		std::atomic<uint32_t> m_NumSleeping{ 0 };
+		std::atomic<uint32_t> m_WakeSignal{ 0 };
+		std::atomic_bool m_Stopped{ false };
+	};
+
+}
+
+using SharedJobSystem = std::shared_ptr<Feather::JobSystem>;
@@ -20,7 +20,7 @@
 #include <Windowing/Input/Keyboard.h>
 #include <Physics/ContactListener.h>
 
-#include <Utils/ThreadPool.h>
+#include <Utils/JobSystem.h>
 #include <Utils/HelperUtilities.h>
 
 // Displays
@@ -92,10 +92,11 @@ namespace Feather {
 
     bool Application::Initialize()
     {
+		// Logs are also written to the working directory so they survive a crash or a closed console
 #if DEBUG
-		F_INIT_LOGS(true, true);
+		F_INIT_LOGS_CONFIG(LogConfig{ .consoleLog = true, .retainLogs = true, .logFile = "feather_editor.log" });
 #else
-		F_INIT_LOGS(false, true);
+		F_INIT_LOGS_CONFIG(LogConfig{ .consoleLog = false, .retainLogs = true, .logFile = "feather_editor.log" });
 #endif
 
 		FEATHER_INIT_CRASH_LOGS();
@@ -260,7 +261,9 @@ namespace Feather {
 		auto& projectInfo = MAIN_REGISTRY().GetContext<ProjectInfoPtr>();
 		FEATHER_CRASH_LOGGER().SetProjectPath(projectInfo->GetProjectPath().string());
 
-		MAIN_REGISTRY().AddToContext<SharedThreadPool>(std::make_shared<ThreadPool>(6));
+		// Sized to the hardware, the main thread helps out whenever it waits on jobs
+		auto jobSystem = MAIN_REGISTRY().AddToContext<SharedJobSystem>(std::make_shared<JobSystem>());
+		MAIN_REGISTRY().GetAssetManager().SetJobSystem(jobSystem);
 
 		return true;
     }
@@ -526,6 +529,7 @@ namespace Feather {
 			display->Update();
 		}
 
+		mainRegistry.GetContext<SharedJobSystem>()->RunMainThreadJobs();
 		mainRegistry.GetAssetManager().Update();
 	}
 
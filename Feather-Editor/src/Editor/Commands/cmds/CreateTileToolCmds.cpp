@@ -6,6 +6,7 @@
 #include "Core/ECS/Components/AllComponents.h"
 
 #include "Editor/Utilities/EditorUtilities.h"
+#include "Editor/Scene/TileUtils.h"
 
 namespace Feather {
 
@@ -25,33 +26,8 @@ namespace Feather {
 			return;
 		}
 
-		auto tiles = registry->GetRegistry().view<TileComponent, TransformComponent>();
-		const auto& tilePos = tile->transform.position;
-		entt::entity entityToRemove{ entt::null };
-
-		for (auto entity : tiles)
-		{
-			Entity t{ registry, entity };
-			const auto& transform = t.GetComponent<TransformComponent>();
-			const auto& sprite = t.GetComponent<SpriteComponent>();
-
-			if (tilePos.x >= transform.position.x &&
-				tilePos.x < transform.position.x + sprite.width * transform.scale.x &&
-				tilePos.y >= transform.position.y &&
-				tilePos.y < transform.position.y + sprite.height * transform.scale.y &&
-				tile->sprite.layer == sprite.layer)
-			{
-				entityToRemove = entity;
-				break;
-			}
-		}
-
-		F_ASSERT(entityToRemove != entt::null && "Entity should not be null");
-		if (entityToRemove != entt::null)
-		{
-			Entity ent{ registry, entityToRemove };
-			ent.Destroy();
-		}
+		[[maybe_unused]] bool removed = TileUtils::RemoveTile(*registry, tile->transform.position, tile->sprite.layer);
+		F_ASSERT(removed && "The tile should exist");
 	}
 
 	void CreateTileToolAddCmd::redo()
@@ -70,19 +46,7 @@ namespace Feather {
 			return;
 		}
 
-		Entity t{ registry, "", "" };
-		t.AddComponent<TransformComponent>(tile->transform);
-		t.AddComponent<SpriteComponent>(tile->sprite);
-		t.AddComponent<TileComponent>(static_cast<std::uint32_t>(t.GetEntity()));
-
-		if (tile->hasAnimation)
-			t.AddComponent<AnimationComponent>(tile->animation);
-		if (tile->isCollider)
-			t.AddComponent<BoxColliderComponent>(tile->boxCollider);
-		if (tile->isCircle)
-			t.AddComponent<CircleColliderComponent>(tile->circleCollider);
-		if (tile->hasPhysics)
-			t.AddComponent<PhysicsComponent>(tile->physics);
+		TileUtils::AddTile(*registry, *tile);
 	}
 
 	void CreateTileToolRemoveCmd::undo()
@@ -101,19 +65,7 @@ namespace Feather {
 			return;
 		}
 
-		Entity t{ registry, "", "" };
-		t.AddComponent<TransformComponent>(tile->transform);
-		t.AddComponent<SpriteComponent>(tile->sprite);
-		t.AddComponent<TileComponent>(static_cast<std::uint32_t>(t.GetEntity()));
-
-		if (tile->hasAnimation)
-			t.AddComponent<AnimationComponent>(tile->animation);
-		if (tile->isCollider)
-			t.AddComponent<BoxColliderComponent>(tile->boxCollider);
-		if (tile->isCircle)
-			t.AddComponent<CircleColliderComponent>(tile->circleCollider);
-		if (tile->hasPhysics)
-			t.AddComponent<PhysicsComponent>(tile->physics);
+		TileUtils::AddTile(*registry, *tile);
 	}
 
 	void CreateTileToolRemoveCmd::redo()
@@ -132,33 +84,8 @@ namespace Feather {
 			return;
 		}
 
-		auto tiles = registry->GetRegistry().view<TileComponent, TransformComponent>();
-		const auto& tilePos = tile->transform.position;
-		entt::entity entityToRemove{ entt::null };
-
-		for (auto entity : tiles)
-		{
-			Entity t{ registry, entity };
-			const auto& transform = t.GetComponent<TransformComponent>();
-			const auto& sprite = t.GetComponent<SpriteComponent>();
-
-			if (tilePos.x >= transform.position.x &&
-				tilePos.x < transform.position.x + sprite.width * transform.scale.x &&
-				tilePos.y >= transform.position.y &&
-				tilePos.y < transform.position.y + sprite.height * transform.scale.y &&
-				tile->sprite.layer == sprite.layer)
-			{
-				entityToRemove = entity;
-				break;
-			}
-		}
-
-		F_ASSERT(entityToRemove != entt::null && "Entity should not be null");
-		if (entityToRemove != entt::null)
-		{
-			Entity ent{ registry, entityToRemove };
-			ent.Destroy();
-		}
+		[[maybe_unused]] bool removed = TileUtils::RemoveTile(*registry, tile->transform.position, tile->sprite.layer);
+		F_ASSERT(removed && "The tile should exist");
 	}
 
 }
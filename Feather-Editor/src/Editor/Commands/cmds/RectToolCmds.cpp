@@ -6,6 +6,7 @@
 #include "Core/ECS/Components/AllComponents.h"
 
 #include "Editor/Utilities/EditorUtilities.h"
+#include "Editor/Scene/TileUtils.h"
 
 namespace Feather {
 
@@ -18,31 +19,8 @@ namespace Feather {
 			return;
 		}
 
-		auto tileView = registry->GetRegistry().view<TileComponent, TransformComponent>();
 		for (const auto& tile : tiles)
-		{
-			const auto& tilePos = tile.transform.position;
-			const auto& layer = tile.sprite.layer;
-
-			for (auto entity : tileView)
-			{
-				Entity checkedTile{ registry, entity };
-				const auto& transform = checkedTile.GetComponent<TransformComponent>();
-				const auto& sprite = checkedTile.GetComponent<SpriteComponent>();
-
-				if (tilePos.x >= transform.position.x &&
-					tilePos.x < transform.position.x + sprite.width * transform.scale.x &&
-					tilePos.y >= transform.position.y &&
-					tilePos.y < transform.position.y + sprite.height * transform.scale.y &&
-					layer == sprite.layer)
-				{
-					if (entity != entt::null)
-						registry->GetRegistry().destroy(entity);
-
-					break;
-				}
-			}
-		}
+			TileUtils::RemoveTile(*registry, tile.transform.position, tile.sprite.layer);
 	}
 
 	void RectToolAddTilesCmd::redo()
@@ -55,21 +33,7 @@ namespace Feather {
 		}
 
 		for (const auto& tile : tiles)
-		{
-			Entity addedTile{ registry, "", "" };
-			addedTile.AddComponent<TransformComponent>(tile.transform);
-			addedTile.AddComponent<SpriteComponent>(tile.sprite);
-			addedTile.AddComponent<TileComponent>(static_cast<std::uint32_t>(addedTile.GetEntity()));
-
-			if (tile.hasAnimation)
-				addedTile.AddComponent<AnimationComponent>(tile.animation);
-			if (tile.isCollider)
-				addedTile.AddComponent<BoxColliderComponent>(tile.boxCollider);
-			if (tile.isCircle)
-				addedTile.AddComponent<CircleColliderComponent>(tile.circleCollider);
-			if (tile.hasPhysics)
-				addedTile.AddComponent<PhysicsComponent>(tile.physics);
-		}
+			TileUtils::AddTile(*registry, tile);
 	}
 
 	void RectToolRemoveTilesCmd::undo()
@@ -82,21 +46,7 @@ namespace Feather {
 		}
 
 		for (const auto& tile : tiles)
-		{
-			Entity addedTile{ registry, "", "" };
-			addedTile.AddComponent<TransformComponent>(tile.transform);
-			addedTile.AddComponent<SpriteComponent>(tile.sprite);
-			addedTile.AddComponent<TileComponent>(static_cast<std::uint32_t>(addedTile.GetEntity()));
-
-			if (tile.hasAnimation)
-				addedTile.AddComponent<AnimationComponent>(tile.animation);
-			if (tile.isCollider)
-				addedTile.AddComponent<BoxColliderComponent>(tile.boxCollider);
-			if (tile.isCircle)
-				addedTile.AddComponent<CircleColliderComponent>(tile.circleCollider);
-			if (tile.hasPhysics)
-				addedTile.AddComponent<PhysicsComponent>(tile.physics);
-		}
+			TileUtils::AddTile(*registry, tile);
 	}
 
 	void RectToolRemoveTilesCmd::redo()
@@ -108,31 +58,8 @@ namespace Feather {
 			return;
 		}
 
-		auto tileView = registry->GetRegistry().view<TileComponent, TransformComponent>();
 		for (const auto& tile : tiles)
-		{
-			const auto& tilePos = tile.transform.position;
-			const auto& layer = tile.sprite.layer;
-
-			for (auto entity : tileView)
-			{
-				Entity checkedTile{ registry, entity };
-				const auto& transform = checkedTile.GetComponent<TransformComponent>();
-				const auto& sprite = checkedTile.GetComponent<SpriteComponent>();
-
-				if (tilePos.x >= transform.position.x &&
-					tilePos.x < transform.position.x + sprite.width * transform.scale.x &&
-					tilePos.y >= transform.position.y &&
-					tilePos.y < transform.position.y + sprite.height * transform.scale.y &&
-					layer == sprite.layer)
-				{
-					if (entity != entt::null)
-						registry->GetRegistry().destroy(entity);
-
-					break;
-				}
-			}
-		}
+			TileUtils::RemoveTile(*registry, tile.transform.position, tile.sprite.layer);
 	}
 
 }
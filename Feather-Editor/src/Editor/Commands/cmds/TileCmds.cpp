@@ -4,9 +4,11 @@
 #include "Core/ECS/Registry.h"
 #include "Core/ECS/Entity.h"
 #include "Core/ECS/Components/AllComponents.h"
+#include "Core/Tilemap/Tilemap.h"
 
 #include "Editor/Utilities/EditorUtilities.h"
 #include "Editor/Scene/SceneObject.h"
+#include "Editor/Scene/TileUtils.h"
 
 namespace Feather {
 
@@ -52,33 +54,12 @@ namespace Feather {
 			}
 		}
 
+		registry->GetContext<std::shared_ptr<Tilemap>>()->InsertLayer(spriteLayerParams.layer);
+
 		// Add the tiles back into the registry
 		for (const auto& tile : tilesRemoved)
 		{
-			Entity ent{ registry, "", "" };
-			ent.AddComponent<TransformComponent>(tile.transform);
-			ent.AddComponent<SpriteComponent>(tile.sprite);
-			ent.AddComponent<TileComponent>(static_cast<std::uint32_t>(ent.GetEntity()));
-
-			if (tile.isCollider)
-			{
-				ent.AddComponent<BoxColliderComponent>(tile.boxCollider);
-			}
-
-			if (tile.hasPhysics)
-			{
-				ent.AddComponent<PhysicsComponent>(tile.physics);
-			}
-
-			if (tile.hasAnimation)
-			{
-				ent.AddComponent<AnimationComponent>(tile.animation);
-			}
-
-			if (tile.isCircle)
-			{
-				ent.AddComponent<CircleColliderComponent>(tile.circleCollider);
-			}
+			TileUtils::AddTile(*registry, tile);
 		}
 	}
 
@@ -126,6 +107,8 @@ namespace Feather {
 				sprite.layer--;
 			}
 		}
+
+		registry->GetContext<std::shared_ptr<Tilemap>>()->RemoveLayer(spriteLayerParams.layer);
 	}
 
 	void AddTileLayerCmd::undo()
@@ -192,6 +175,8 @@ namespace Feather {
 				}
 			}
 		}
+
+		registry->GetContext<std::shared_ptr<Tilemap>>()->SwapLayers(from, to);
 	}
 
 	void MoveTileLayerCmd::redo()
@@ -230,6 +215,8 @@ namespace Feather {
 				}
 			}
 		}
+
+		registry->GetContext<std::shared_ptr<Tilemap>>()->SwapLayers(from, to);
 	}
 
 	void ChangeTileLayerNameCmd::undo()
@@ -15,14 +15,15 @@ namespace Feather {
 		, m_ShowInfo{ true }
 		, m_ShowWarn{ true }
 		, m_ShowError{ true }
-		, m_LogIndex{ 0 }
+		, m_LogSequence{ 0 }
+		, m_NewLogs{}
 	{}
 
 	void LogDisplay::Clear()
 	{
 		m_TextBuffer.clear();
 		m_TextOffsets.clear();
-		m_LogIndex = 0;
+		m_LogSequence = 0;
 	}
 
 	void LogDisplay::Draw()
@@ -118,20 +119,27 @@ namespace Feather {
 
 	void LogDisplay::GetLogs()
 	{
-		const auto& logs{ F_GET_LOGS() };
-		if (logs.size() == m_LogIndex)
+		m_NewLogs.clear();
+		m_LogSequence = F_GET_LOGS(m_LogSequence, m_NewLogs);
+		if (m_NewLogs.empty())
 			return;
 
-		for (size_t i = m_LogIndex; i < logs.size(); i++)
+		// The log history is capped, so rebuild from it once the display holds twice as many lines
+		size_t maxLines = 2 * Log::GetInstance().GetHistoryCapacity();
+		if (static_cast<size_t>(m_TextOffsets.Size) + m_NewLogs.size() > maxLines)
+		{
+			Clear();
+			m_NewLogs.clear();
+			m_LogSequence = F_GET_LOGS(m_LogSequence, m_NewLogs);
+		}
+
+		for (const auto& log : m_NewLogs)
 		{
-			const auto& log = logs[i];
 			int oldTextSize = m_TextBuffer.size();
 			m_TextBuffer.append(log.log.c_str());
 			m_TextBuffer.append("\n");
 			m_TextOffsets.push_back(oldTextSize);
 		}
-
-		m_LogIndex = static_cast<int>(logs.size());
 	}
 
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IDisplay.h"
+#include "Logger/LogSinks.h"
 
 #include <imgui.h>
 
@@ -27,7 +28,9 @@ namespace Feather {
 		bool m_ShowInfo;
 		bool m_ShowWarn;
 		bool m_ShowError;
-		int m_LogIndex;
+		/* Sequence of the next log entry to read from the log history */
+		uint64_t m_LogSequence;
+		std::vector<LogEntry> m_NewLogs;
 	};
 
 }
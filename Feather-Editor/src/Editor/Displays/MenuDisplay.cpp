@@ -9,6 +9,10 @@
 #include "Core/ECS/MainRegistry.h"
 #include "Core/Events/EventDispatcher.h"
 #include "Utils/FeatherUtilities.h"
+#include "Utils/Benchmarks/AnimationBenchmark.h"
+#include "Utils/Benchmarks/JobSystemBenchmark.h"
+#include "Utils/Benchmarks/LuaComponentBenchmark.h"
+#include "Utils/Benchmarks/RegistryCloneBenchmark.h"
 
 #include "Editor/Scene/SceneManager.h"
 #include "Editor/Scene/SceneObject.h"
@@ -291,6 +295,32 @@ namespace Feather {
 					ImGui::TreePop();
 				}
 
+				if (ImGui::BeginMenu("Benchmarks"))
+				{
+					// Results are written to the logs
+					if (ImGui::MenuItem("Job System"))
+					{
+						RunJobSystemBenchmark();
+					}
+
+					if (ImGui::MenuItem("Play Mode Entry"))
+					{
+						RunRegistryCloneBenchmark();
+					}
+
+					if (ImGui::MenuItem("Lua Component Access"))
+					{
+						RunLuaComponentBenchmark();
+					}
+
+					if (ImGui::MenuItem("Animation"))
+					{
+						RunAnimationBenchmark();
+					}
+
+					ImGui::EndMenu();
+				}
+
 				ImGui::EndMenu();
 			}
 
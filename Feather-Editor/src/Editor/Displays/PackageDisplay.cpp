@@ -5,7 +5,7 @@
 #include "Core/CoreUtils/CoreEngineData.h"
 #include "Core/ECS/MainRegistry.h"
 #include "FileSystem/Dialogs/FileDialog.h"
-#include "Utils/ThreadPool.h"
+#include "Utils/JobSystem.h"
 #include "Utils/HelperUtilities.h"
 
 #include "Editor/Utilities/GUI/ImGuiUtils.h"
@@ -127,8 +127,24 @@ namespace Feather {
 			}
 
 			ImGui::InlineLabel("Package Assets");
-			ImGui::ItemToolTip("Convert assets into luac files and add them to zip archive");
+			ImGui::ItemToolTip("Pack assets into a single binary asset pack");
 			ImGui::Checkbox("##packageassets", &m_GameConfig->packageAssets);
+
+			if (m_GameConfig->packageAssets)
+			{
+				ImGui::InlineLabel("Asset Budget (MB)");
+				ImGui::ItemToolTip("Unused packaged textures and sounds are unloaded when over budget. Zero disables unloading");
+				ImGui::PushItemWidth(128.0f);
+				if (ImGui::InputInt("##assetMemoryBudget", &m_GameConfig->assetMemoryBudget))
+				{
+					m_GameConfig->assetMemoryBudget = std::max(m_GameConfig->assetMemoryBudget, 0);
+				}
+				ImGui::PopItemWidth();
+
+				ImGui::InlineLabel("Legacy Asset Zip");
+				ImGui::ItemToolTip("Package assets into the previous zip of lua asset tables. The runtime logs the load time of either format");
+				ImGui::Checkbox("##legacyAssetZip", &m_GameConfig->legacyAssetZip);
+			}
 			ImGui::AddSpaces(2);
 			ImGui::Separator();
 			ImGui::AddSpaces(3);
@@ -289,10 +305,10 @@ namespace Feather {
 				pPackageData->FinalDestination = sFullDestination;
 				pPackageData->AssetFilepath = pPackageData->TempDataPath + PATH_SEPARATOR + "assetDefs.lua";
 
-				auto& pThreadPool = MAIN_REGISTRY().GetContext<SharedThreadPool>();
-				F_ASSERT(pThreadPool && "Thread pool must exist and be valid");
+				auto& pJobSystem = MAIN_REGISTRY().GetContext<SharedJobSystem>();
+				F_ASSERT(pJobSystem && "Job system must exist and be valid");
 
-				m_Packager = std::make_unique<Packager>(std::move(pPackageData), pThreadPool);
+				m_Packager = std::make_unique<Packager>(std::move(pPackageData), pJobSystem);
 
 				ImGui::End();
 
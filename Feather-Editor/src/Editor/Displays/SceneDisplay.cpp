@@ -7,6 +7,7 @@
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/Systems/AnimationSystem.h"
 #include "Core/Systems/PhysicsSystem.h"
+#include "Core/Systems/TransformSystem.h"
 #include "Core/Systems/ScriptingSystem.h"
 #include "Core/Systems/RenderSystem.h"
 #include "Core/Systems/RenderUISystem.h"
@@ -36,9 +37,6 @@
 
 #include <imgui.h>
 
-constexpr float TARGET_FRAME_TIME_F = 1.0f / 60.0f;
-constexpr double TARGET_FRAME_TIME = 1.0 / 60.0;
-
 namespace Feather {
 
 	SceneDisplay::SceneDisplay()
@@ -117,15 +115,8 @@ namespace Feather {
 		auto& mainRegistry = MAIN_REGISTRY();
 		auto& coreGlobals = CORE_GLOBALS();
 
-		double dt = coreGlobals.GetDeltaTime();
 		coreGlobals.UpdateDeltaTime();
 
-		// NOTE: Clamp delta time to the target frame rate
-		if (dt < TARGET_FRAME_TIME)
-		{
-			std::this_thread::sleep_for(std::chrono::duration<double>(TARGET_FRAME_TIME - dt));
-		}
-
 		auto& camera = runtimeRegistry.GetContext<std::shared_ptr<Camera2D>>();
 		if (!camera)
 		{
@@ -137,46 +128,18 @@ namespace Feather {
 		auto& scriptSystem = runtimeRegistry.GetContext<std::shared_ptr<ScriptingSystem>>();
 		scriptSystem->Update(runtimeRegistry);
 
-		if (coreGlobals.IsPhysicsEnabled())
+		if (coreGlobals.IsPhysicsEnabled() && !coreGlobals.IsPhysicsPaused())
 		{
-			auto& physicsWorld = runtimeRegistry.GetContext<PhysicsWorld>();
-			physicsWorld->Step(TARGET_FRAME_TIME_F, coreGlobals.GetVelocityIterations(), coreGlobals.GetPositionIterations());
-			physicsWorld->ClearForces();
-
-			auto& dispatch = runtimeRegistry.GetContext<std::shared_ptr<EventDispatcher>>();
-
-			// If there are no listeners for contact events, don't emit event
-			if (dispatch->HasHandlers<ContactEvent>())
-			{
-				if (auto& contactListener = runtimeRegistry.GetContext<std::shared_ptr<ContactListener>>())
-				{
-					auto userDataA = contactListener->GetUserDataA();
-					auto userDataB = contactListener->GetUserDataB();
-
-					// Only emit contact event if both contacts are valid
-					if (userDataA && userDataB)
-					{
-						try
-						{
-							auto ObjectA = std::any_cast<ObjectData>(userDataA->userData);
-							auto ObjectB = std::any_cast<ObjectData>(userDataB->userData);
-
-							dispatch->EmitEvent(ContactEvent{ .objectA = ObjectA, .objectB = ObjectB });
-						}
-						catch (const std::bad_any_cast& e)
-						{
-							F_ERROR("Failed to cast to object data: {}", e.what());
-						}
-					}
-				}
-			}
+			auto& physicsSystem = mainRegistry.GetPhysicsSystem();
+			physicsSystem.Step(runtimeRegistry, coreGlobals.GetDeltaTime());
+			physicsSystem.Update(runtimeRegistry);
 		}
 
-		auto& physicsSystem = mainRegistry.GetPhysicsSystem();
-		physicsSystem.Update(runtimeRegistry);
-
 		auto& animationSystem = mainRegistry.GetAnimationSystem();
-		animationSystem.Update(runtimeRegistry, *camera);
+		animationSystem.Update(runtimeRegistry, coreGlobals.GetDeltaTime());
+
+		// After scripts and physics have moved the entities, so children follow their parents this frame
+		mainRegistry.GetTransformSystem().Update(runtimeRegistry);
 
 		runtimeRegistry.ClearPendingEntities();
 	}
@@ -196,6 +159,7 @@ namespace Feather {
 		auto physicsWorld = runtimeRegistry.AddToContext<PhysicsWorld>(std::make_shared<b2World>(b2Vec2{ 0.0f, CORE_GLOBALS().GetGravity() }));
 		auto contactListener = runtimeRegistry.AddToContext<std::shared_ptr<ContactListener>>(std::make_shared<ContactListener>());
 		physicsWorld->SetContactListener(contactListener.get());
+		MAIN_REGISTRY().GetPhysicsSystem().Reset();
 
 		// Add the temporary event dispatcher
 		runtimeRegistry.AddToContext<std::shared_ptr<EventDispatcher>>(std::make_shared<EventDispatcher>());
@@ -300,6 +264,9 @@ namespace Feather {
 		// This is used to log the lua stack trace in case of a crash
 		FEATHER_CRASH_LOGGER().SetLuaState(lua->lua_state());
 
+		// The clock only runs while playing, restart it so the first frame does not get the time spent in the editor
+		CORE_GLOBALS().UpdateDeltaTime();
+
 		m_SceneLoaded = true;
 		m_PlayScene = true;
 	}
@@ -328,6 +295,11 @@ namespace Feather {
 		auto& mainRegistry = MAIN_REGISTRY();
 		mainRegistry.GetMusicPlayer().Stop();
 		mainRegistry.GetSoundPlayer().Stop(-1);
+
+		// Scripts may have paused or slowed the animations, the tilemap display shares the system
+		auto& animationSystem = mainRegistry.GetAnimationSystem();
+		animationSystem.Resume();
+		animationSystem.SetTimeScale(1.0f);
 	}
 
 	void SceneDisplay::RenderScene() const
@@ -443,6 +415,28 @@ namespace Feather {
 		if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal))
 			ImGui::SetTooltip("Stop Scene");
 
+		// Renderer and Lua garbage collector stats for the running scene
+		if (m_SceneLoaded)
+		{
+			const auto& batchRenderer = MAIN_REGISTRY().GetRenderSystem().GetBatchRenderer();
+			ImGui::SameLine();
+			ImGui::AlignTextToFramePadding();
+			ImGui::Text("Batches: %zu | Sort: %.3f ms", batchRenderer.GetBatchCount(), batchRenderer.GetSortTime());
+
+			if (auto currentScene = SCENE_MANAGER().GetCurrentSceneObject())
+			{
+				auto& runtimeRegistry = currentScene->GetRuntimeRegistry();
+				if (auto* scriptSystem = runtimeRegistry.TryGetContext<std::shared_ptr<ScriptingSystem>>())
+				{
+					ImGui::SameLine();
+					ImGui::AlignTextToFramePadding();
+					ImGui::Text("Lua Heap: %.1f KB | GC: %.3f ms",
+								(*scriptSystem)->GetLuaHeapSize() / 1024.0,
+								(*scriptSystem)->GetGCStepTime());
+				}
+			}
+		}
+
 		ImGui::Separator();
 		ImGui::PopStyleVar(1);
 	}
@@ -13,6 +13,7 @@
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/Resources/AssetManager.h"
 #include "Core/CoreUtils/CoreUtilities.h"
+#include "Core/Tilemap/Tilemap.h"
 #include "Renderer/Essentials/Texture.h"
 #include "Logger/Logger.h"
 
@@ -148,6 +149,8 @@ namespace Feather {
 								sprite.layer = n;
 						}
 
+						currentScene->GetRegistry().GetContext<std::shared_ptr<Tilemap>>()->SwapLayers(n, nNext);
+
 						m_SelectedLayer = nNext;
 						tileData.sprite.layer = nNext;
 
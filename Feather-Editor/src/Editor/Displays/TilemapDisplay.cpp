@@ -42,6 +42,7 @@ namespace Feather {
 
 	TilemapDisplay::TilemapDisplay()
 		: m_TilemapCam{ std::make_unique<Camera2D>() }
+		, m_LastAnimationUpdate{ std::chrono::steady_clock::now() }
 		, m_WindowActive{ false }
 	{
 		ADD_EVENT_HANDLER(KeyEvent, &TilemapDisplay::HandleKeyPressedEvent, *this);
@@ -164,11 +165,16 @@ namespace Feather {
 			activeGizmo->Update(currentScene->GetCanvas());
 		}
 
+		// The engine's delta time only advances while the scene is played
+		auto now = std::chrono::steady_clock::now();
+		double deltaTime = std::chrono::duration<double>(now - m_LastAnimationUpdate).count();
+		m_LastAnimationUpdate = now;
+
 		if (CORE_GLOBALS().AnimationRenderEnabled())
 		{
 			auto& mainRegistry = MAIN_REGISTRY();
 			auto& animationSystem = mainRegistry.GetAnimationSystem();
-			animationSystem.Update(currentScene->GetRegistry(), *m_TilemapCam);
+			animationSystem.Update(currentScene->GetRegistry(), deltaTime);
 		}
 
 		m_TilemapCam->Update();
@@ -32,6 +32,7 @@ namespace Feather {
 
 	private:
 		std::unique_ptr<Camera2D> m_TilemapCam;
+		std::chrono::steady_clock::time_point m_LastAnimationUpdate;
 		bool m_WindowActive;
 	};
 
@@ -3,7 +3,8 @@
 #include "Logger/Logger.h"
 #include "Utils/FeatherUtilities.h"
 #include "Utils/HelperUtilities.h"
-#include "Utils/ThreadPool.h"
+#include "Utils/JobSystem.h"
+#include "Core/Resources/AssetPack.h"
 #include "FileSystem/Serializers/LuaSerializer.h"
 #include "ScriptCompiler.h"
 
@@ -13,9 +14,9 @@ namespace fs = std::filesystem;
 
 namespace Feather {
 
-	AssetPackager::AssetPackager(const AssetPackagerParams& params, std::shared_ptr<ThreadPool> threadPool)
+	AssetPackager::AssetPackager(const AssetPackagerParams& params, std::shared_ptr<JobSystem> jobSystem)
 		: m_Params{ params }
-		, m_ThreadPool{ threadPool }
+		, m_JobSystem{ jobSystem }
 	{}
 
 	AssetPackager::~AssetPackager() = default;
@@ -24,17 +25,28 @@ namespace Feather {
 	{
 		try
 		{
-			CreateLuaAssetFiles(m_Params.ProjectPath, assets);
-
-			if (!CompileLuaAssetFiles())
+			if (m_Params.UseLegacyZip)
 			{
-				F_ERROR("Failed to compile assets");
+				CreateLuaAssetFiles(m_Params.ProjectPath, assets);
+
+				if (!CompileLuaAssetFiles())
+				{
+					F_ERROR("Failed to compile assets");
+					return;
+				}
+
+				if (!CreateAssetsZip())
+				{
+					F_ERROR("Failed to archive assets");
+					return;
+				}
+
 				return;
 			}
 
-			if (!CreateAssetsZip())
+			if (!CreateAssetPack(assets))
 			{
-				F_ERROR("Failed to archive assets");
+				F_ERROR("Failed to create asset pack");
 				return;
 			}
 		}
@@ -44,6 +56,72 @@ namespace Feather {
 		}
 	}
 
+	bool AssetPackager::CreateAssetPack(const rapidjson::Value& assets)
+	{
+		std::string contentPath = m_Params.ProjectPath + PATH_SEPARATOR + "content";
+		if (!fs::exists(fs::path{ contentPath }))
+		{
+			throw std::runtime_error(std::format("Failed to create asset pack. Content path '{}' does not exist or is invalid", contentPath));
+		}
+
+		fs::path assetsDestination{ m_Params.DestinationPath };
+		if (!fs::exists(assetsDestination))
+		{
+			std::error_code ec;
+			if (!fs::create_directories(assetsDestination, ec))
+			{
+				F_ERROR("Failed to create directory '{}'", assetsDestination.string());
+				return false;
+			}
+		}
+
+		AssetPackWriter packWriter{};
+		AddAssetsByType(packWriter, assets, "textures", contentPath, AssetType::TEXTURE);
+		AddAssetsByType(packWriter, assets, "soundfx", contentPath, AssetType::SOUNDFX);
+		AddAssetsByType(packWriter, assets, "music", contentPath, AssetType::MUSIC);
+		AddAssetsByType(packWriter, assets, "fonts", contentPath, AssetType::FONT);
+
+		assetsDestination /= "FeatherAssets.fpack";
+		return packWriter.Write(assetsDestination, m_JobSystem.get());
+	}
+
+	void AssetPackager::AddAssetsByType(
+		AssetPackWriter& packWriter,
+		const rapidjson::Value& assets,
+		const std::string& assetTypeName,
+		const std::string& contentPath,
+		AssetType assetType)
+	{
+		if (!assets.HasMember(assetTypeName.c_str()))
+			return;
+
+		const rapidjson::Value& assetArray = assets[assetTypeName.c_str()];
+		if (!assetArray.IsArray())
+		{
+			throw std::runtime_error(std::format("Failed to add assets to pack. Expecting '{}' must be an array", assetTypeName));
+		}
+
+		for (const auto& jsonValue : assetArray.GetArray())
+		{
+			std::string path{ contentPath + PATH_SEPARATOR + jsonValue["path"].GetString() };
+
+			uint32_t flags{ ASSET_PACK_FLAG_NONE };
+			float fontSize{ 32.0f };
+
+			if (assetType == AssetType::FONT && jsonValue.HasMember("fontSize"))
+			{
+				fontSize = jsonValue["fontSize"].GetFloat();
+			}
+			else if (assetType == AssetType::TEXTURE)
+			{
+				if (!jsonValue.HasMember("pixelArt") || jsonValue["pixelArt"].GetBool())
+					flags |= ASSET_PACK_FLAG_PIXEL_ART;
+			}
+
+			packWriter.AddAsset(jsonValue["name"].GetString(), assetType, path, flags, fontSize);
+		}
+	}
+
 	void AssetPackager::ConvertAssetToLuaTable(LuaSerializer& luaSerializer, const AssetConversionData& conversionData)
 	{
 		std::fstream in{ conversionData.inAssetFile, std::ios::in | std::ios::binary };
@@ -122,22 +200,22 @@ namespace Feather {
 
 		std::vector<std::future<AssetPackageStatus>> assetFutures;
 		assetFutures.emplace_back(
-			m_ThreadPool->Enqueue(
+			m_JobSystem->Enqueue(
 				[&] { return SerializeAssetsByType(assets, tempAssetPath, "textures", contentPath, AssetType::TEXTURE); }
 		));
 
 		assetFutures.emplace_back(
-			m_ThreadPool->Enqueue(
+			m_JobSystem->Enqueue(
 				[&] { return SerializeAssetsByType(assets, tempAssetPath, "soundfx", contentPath, AssetType::SOUNDFX); }
 		));
 
 		assetFutures.emplace_back(
-			m_ThreadPool->Enqueue(
+			m_JobSystem->Enqueue(
 				[&] { return SerializeAssetsByType(assets, tempAssetPath, "music", contentPath, AssetType::MUSIC); }
 		));
 
 		assetFutures.emplace_back(
-			m_ThreadPool->Enqueue(
+			m_JobSystem->Enqueue(
 				[&] { return SerializeAssetsByType(assets, tempAssetPath, "fonts", contentPath, AssetType::FONT); }
 		));
 
@@ -5,8 +5,9 @@
 namespace Feather {
 
 	enum class AssetType;
-	class ThreadPool;
+	class JobSystem;
 	class LuaSerializer;
+	class AssetPackWriter;
 
 	struct AssetPackagerParams
 	{
@@ -14,13 +15,15 @@ namespace Feather {
 		std::string TempFilePath{};
 		std::string DestinationPath{};
 		std::string ProjectPath{};
+		/* Writes the previous zip of compiled lua asset tables instead of the asset pack, to compare the two */
+		bool UseLegacyZip{ false };
 	};
 
 	struct AssetConversionData
 	{
 		std::string inAssetFile{};
 		std::string assetName{};
-		AssetType type;
+		AssetType type{};
 		std::optional<float> optFontSize{ std::nullopt };
 		std::optional<bool> optPixelArt{ std::nullopt };
 	};
@@ -28,12 +31,22 @@ namespace Feather {
 	class AssetPackager
 	{
 	public:
-		AssetPackager(const AssetPackagerParams& params, std::shared_ptr<ThreadPool> threadPool);
+		AssetPackager(const AssetPackagerParams& params, std::shared_ptr<JobSystem> jobSystem);
 		~AssetPackager();
 
 		void PackageAssets(const rapidjson::Value& assets);
 
 	private:
+		bool CreateAssetPack(const rapidjson::Value& assets);
+
+		void AddAssetsByType(
+			AssetPackWriter& packWriter,
+			const rapidjson::Value& assets,
+			const std::string& assetTypeName,
+			const std::string& contentPath,
+			AssetType assetType);
+
+		// Legacy zip of lua asset tables
 		void ConvertAssetToLuaTable(LuaSerializer& luaSerializer, const AssetConversionData& conversionData);
 
 		void CreateLuaAssetFiles(const std::string& projectPath, const rapidjson::Value& assets);
@@ -55,7 +68,7 @@ namespace Feather {
 
 	private:
 		AssetPackagerParams m_Params;
-		std::shared_ptr<ThreadPool> m_ThreadPool;
+		std::shared_ptr<JobSystem> m_JobSystem;
 	};
 
 }
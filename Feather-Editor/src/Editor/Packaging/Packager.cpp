@@ -7,7 +7,7 @@
 #include "Logger/Logger.h"
 #include "FileSystem/Serializers/LuaSerializer.h"
 #include "Utils/HelperUtilities.h"
-#include "Utils/ThreadPool.h"
+#include "Utils/JobSystem.h"
 #include "Core/CoreUtils/ProjectInfo.h"
 #include "Editor/Scene/SceneObject.h"
 
@@ -58,11 +58,11 @@ constexpr std::array<std::string_view, 16> CopyPackageFiles = {		// TODO: Test t
 
 namespace Feather {
 
-	Packager::Packager(std::unique_ptr<PackageData> data, std::shared_ptr<ThreadPool> threadPool)
+	Packager::Packager(std::unique_ptr<PackageData> data, std::shared_ptr<JobSystem> jobSystem)
 		: m_PackageData{ std::move(data) }
 		, m_Packaging{ false }
 		, m_HasError{ false }
-		, m_ThreadPool{ threadPool }
+		, m_JobSystem{ jobSystem }
 	{
 		m_PackageThread = std::thread([this] { RunPackager(); });
 	}
@@ -259,9 +259,10 @@ namespace Feather {
 				AssetPackagerParams assetPackagerParams{
 					.TempFilePath = m_PackageData->TempDataPath,
 					.DestinationPath = m_PackageData->FinalDestination + PATH_SEPARATOR + "assets",
-					.ProjectPath = m_PackageData->ProjectInfo->GetProjectPath().string() };
+					.ProjectPath = m_PackageData->ProjectInfo->GetProjectPath().string(),
+					.UseLegacyZip = m_PackageData->GameConfig->legacyAssetZip };
 
-				AssetPackager assetPackager{ assetPackagerParams, m_ThreadPool };
+				AssetPackager assetPackager{ assetPackagerParams, m_JobSystem };
 
 				assetPackager.PackageAssets(assets);
 			}
@@ -417,6 +418,7 @@ namespace Feather {
 			.AddKeyValuePair("GameName", m_PackageData->GameConfig->gameName, true, false, false, true)
 			.AddKeyValuePair("StartupScene", m_PackageData->GameConfig->startupScene, true, false, false, true)
 			.AddKeyValuePair("PackageAssets", m_PackageData->GameConfig->packageAssets ? "true" : "false")
+			.AddKeyValuePair("AssetMemoryBudget", m_PackageData->GameConfig->assetMemoryBudget)
 			.StartNewTable("WindowParams")
 			.AddKeyValuePair("width", m_PackageData->GameConfig->windowWidth)
 			.AddKeyValuePair("height", m_PackageData->GameConfig->windowHeight)
@@ -785,6 +787,9 @@ namespace Feather {
 
 		const std::unordered_set<std::string> foldersToCopy = { "textures", "music", "soundfx", "fonts" };
 
+		// The directories are created while walking the assets, the files are copied on the job system afterwards
+		std::vector<std::pair<fs::path, fs::path>> filesToCopy;
+
 		for (fs::recursive_directory_iterator itr(*optAssetPath), end; itr != end; ++itr)
 		{
 			const auto& path = itr->path();
@@ -811,7 +816,7 @@ namespace Feather {
 				else if (fs::is_regular_file(path))
 				{
 					fs::create_directories(destPath.parent_path());
-					fs::copy_file(path, destPath, fs::copy_options::overwrite_existing);
+					filesToCopy.emplace_back(path, std::move(destPath));
 				}
 			}
 			catch (const fs::filesystem_error& err)
@@ -819,6 +824,17 @@ namespace Feather {
 				F_ERROR("Failed to copy asset file: {}", err.what());
 			}
 		}
+
+		m_JobSystem->ParallelFor(filesToCopy.size(), 0, [&filesToCopy](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++)
+			{
+				std::error_code ec;
+				if (!fs::copy_file(filesToCopy[i].first, filesToCopy[i].second, fs::copy_options::overwrite_existing, ec) && ec)
+				{
+					F_ERROR("Failed to copy asset file '{}': {}", filesToCopy[i].first.string(), ec.message());
+				}
+			}
+		});
 	}
 
 }
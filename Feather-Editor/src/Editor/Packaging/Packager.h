@@ -5,7 +5,7 @@
 namespace Feather {
 
 	class ProjectInfo;
-	class ThreadPool;
+	class JobSystem;
 	struct GameConfig;
 
 	struct PackageData
@@ -26,7 +26,7 @@ namespace Feather {
 	class Packager
 	{
 	public:
-		Packager(std::unique_ptr<PackageData> data, std::shared_ptr<ThreadPool> threadPool);
+		Packager(std::unique_ptr<PackageData> data, std::shared_ptr<JobSystem> jobSystem);
 		~Packager();
 
 		bool Completed() const;
@@ -53,7 +53,7 @@ namespace Feather {
 		mutable std::shared_mutex m_ProgressMutex;
 		PackagingProgress m_Progress;
 
-		std::shared_ptr<ThreadPool> m_ThreadPool;
+		std::shared_ptr<JobSystem> m_JobSystem;
 	};
 
 }
@@ -7,26 +7,12 @@
 
 #include <sol/sol.hpp>
 
-#ifdef _WIN32
-constexpr const std::string_view FIND_LUAC_COMMAND = "where luac";
-#else
-constexpr const std::string_view FIND_LUAC_COMMAND = "which luac";
-#endif
-
 namespace Feather {
 
 	ScriptCompiler::ScriptCompiler()
 		: m_OutFile{}
 		, m_LuaFiles{}
-		, m_LuacPath{ std::nullopt }
-	{
-		m_LuacPath = FindLuaCompiler();
-		if (!m_LuacPath)
-		{
-			throw std::runtime_error("Script compiler error: Lua Compiler (luac) not found on system!\n"
-									 "Please install the luac and add to your environment.");
-		}
-	}
+	{}
 
 	ScriptCompiler::~ScriptCompiler() = default;
 
@@ -112,49 +98,21 @@ namespace Feather {
 			throw std::runtime_error("Script compiler error: File not found - " + *notExist);
 		}
 
-#ifdef _WIN32
-		std::string command = std::format("cmd /C \"\"{}\" \"-o\" \"{}\"", *m_LuacPath, m_OutFile);
-#else
-		std::string command = std::format("\"\"{}\" \"-o\" \"{}\"", *m_LuacPath, m_OutFile);
-#endif
-
+		LuaScriptBundle bundle{};
 		for (const auto& file : m_LuaFiles)
 		{
-			command += " " + std::string{ "\"" + file + "\"" };
+			if (!bundle.AddScript(file))
+			{
+				throw std::runtime_error(std::format("Script compiler error: Lua compilation failed for '{}'. See logs for the error", file));
+			}
 		}
 
-		command += "\"";
-
-		const std::string error = ExecCmdWithErrorOutput(command);
-		if (!error.empty())
+		if (!bundle.Save(m_OutFile))
 		{
-			throw std::runtime_error(std::format("Script compiler error: Lua compilation failed. Error: {}", error));
+			throw std::runtime_error(std::format("Script compiler error: Failed to write '{}'", m_OutFile));
 		}
 
 		F_INFO("Successfully compiled lua files in {}", m_OutFile);
 	}
 
-	std::optional<std::string> ScriptCompiler::FindLuaCompiler()
-	{
-#ifdef _WIN32
-		std::unique_ptr<FILE, decltype(&_pclose)> pipe(_popen(std::string{ FIND_LUAC_COMMAND }.c_str(), "r"), _pclose);
-#else
-		std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(std::string{ cmd + " 2>&1" }.c_str(), "r"), pclose);
-#endif
-
-		if (!pipe)
-			return std::nullopt;
-
-		std::string result{};
-		std::array<char, 256> buffer;
-
-		if (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr)
-		{
-			result = buffer.data();
-			result.erase(result.find_last_not_of(" \n\r") + 1);
-		}
-
-		return result.empty() ? std::nullopt : std::optional<std::string>{ result };
-	}
-
 }
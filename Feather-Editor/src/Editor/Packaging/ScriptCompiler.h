@@ -1,7 +1,12 @@
 #pragma once
 
+#include "Core/Scripting/LuaScriptBundle.h"
+
 namespace Feather {
 
+	/*
+	* @brief Compiles the game scripts into a LuaScriptBundle with the engine's own Lua, no external luac is needed.
+	*/
 	class ScriptCompiler
 	{
 	public:
@@ -16,13 +21,9 @@ namespace Feather {
 		inline void SetOutputFileName(const std::string& outFile) { m_OutFile = outFile; }
 		inline void ClearScripts() { m_LuaFiles.clear(); }
 
-	private:
-		std::optional<std::string> FindLuaCompiler();
-
 	private:
 		std::string m_OutFile;
 		std::vector<std::string> m_LuaFiles;
-		std::optional<std::string> m_LuacPath;
 	};
 
 }
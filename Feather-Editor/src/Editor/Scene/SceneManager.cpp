@@ -8,6 +8,7 @@
 #include "Core/ECS/MainRegistry.h"
 #include "Core/CoreUtils/ProjectInfo.h"
 #include "Core/CoreUtils/CoreUtilities.h"
+#include "Core/Systems/ScriptingSystem.h"
 #include "Utils/FeatherUtilities.h"
 
 #include "Editor/Tools/ToolManager.h"
@@ -245,6 +246,9 @@ namespace Feather {
 
 				currentScene->CopySceneToRuntime(*sceneObject);
 
+				if (auto* scriptSystem = currentScene->GetRuntimeRegistry().TryGetContext<std::shared_ptr<ScriptingSystem>>())
+					(*scriptSystem)->RequestFullCollection();
+
 				return scene->UnloadScene(false);
 			},
 			"getCanvas", [&]
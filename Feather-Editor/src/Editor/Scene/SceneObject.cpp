@@ -1,9 +1,9 @@
 #include "SceneObject.h"
 
 #include "Utils/FeatherUtilities.h"
-#include "Core/ECS/MetaUtilities.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/Loaders/TilemapLoader.h"
+#include "Core/Tilemap/Tilemap.h"
 #include "Core/Events/EventDispatcher.h"
 #include "Core/CoreUtils/ProjectInfo.h"
 #include "FileSystem/Serializers/JSONSerializer.h"
@@ -12,12 +12,12 @@
 #include "Editor/Events/EditorEventTypes.h"
 #include "Editor/Commands/CommandManager.h"
 #include "Editor/Scene/SceneManager.h"
+#include "Editor/Scene/TileSpatialIndex.h"
+#include "Editor/Scene/TileUtils.h"
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
 
-using namespace entt::literals;
-
 namespace Feather {
 
 	SceneObject::SceneObject(const std::string& sceneName, EMapType type)
@@ -25,12 +25,17 @@ namespace Feather {
 		, m_RuntimeRegistry{}
 		, m_RuntimeData{ nullptr }
 	{
+		m_Registry.AddToContext<std::shared_ptr<TileSpatialIndex>>(std::make_shared<TileSpatialIndex>(m_Registry.GetRegistry()));
+		m_Registry.AddToContext<std::shared_ptr<Tilemap>>(std::make_shared<Tilemap>());
 		ADD_EVENT_HANDLER(NameChangeEvent, &SceneObject::OnEntityNameChanges, *this);
 	}
 
 	SceneObject::SceneObject(const std::string& sceneName, const std::string& sceneData)
 		: m_RuntimeRegistry{}
 	{
+		m_Registry.AddToContext<std::shared_ptr<TileSpatialIndex>>(std::make_shared<TileSpatialIndex>(m_Registry.GetRegistry()));
+		m_Registry.AddToContext<std::shared_ptr<Tilemap>>(std::make_shared<Tilemap>());
+
 		m_SceneName = sceneName;
 		m_SceneDataPath = sceneData;
 
@@ -55,6 +60,12 @@ namespace Feather {
 		ADD_EVENT_HANDLER(NameChangeEvent, &SceneObject::OnEntityNameChanges, *this);
 	}
 
+	SceneObject::~SceneObject()
+	{
+		// The registry destroys its context after its storages, the index must disconnect while they still exist
+		m_Registry.RemoveContext<std::shared_ptr<TileSpatialIndex>>();
+	}
+
 	void SceneObject::CopySceneToRuntime()
 	{
 		if (!m_RuntimeData)
@@ -67,21 +78,8 @@ namespace Feather {
 		m_RuntimeData->defaultMusic = m_DefaultMusic;
 		m_RuntimeData->sceneName = m_SceneName;
 
-		auto& registryToCopy = m_Registry.GetRegistry();
-
-		for (auto entityToCopy : registryToCopy.view<entt::entity>(entt::exclude<ScriptComponent, UneditableComponent>))
-		{
-			entt::entity newEntity = m_RuntimeRegistry.CreateEntity();
-
-			// Copy components of the entity to the new entity
-			for (auto&& [id, storage] : registryToCopy.storage())
-			{
-				if (!storage.contains(entityToCopy))
-					continue;
-
-				InvokeMetaFunction(id, "copy_component"_hs, Entity{ &m_Registry, entityToCopy }, Entity{ &m_RuntimeRegistry, newEntity });
-			}
-		}
+		m_Registry.CloneEntities<ScriptComponent, UneditableComponent>(m_RuntimeRegistry);
+		CopyTilemapToRuntime(m_Registry);
 
 		if (m_UsePlayerStart)
 			m_PlayerStart.CreatePlayer(m_RuntimeRegistry);
@@ -99,24 +97,9 @@ namespace Feather {
 		m_RuntimeData->defaultMusic = sceneToCopy.GetDefaultMusicName();
 		m_RuntimeData->sceneName = sceneToCopy.GetSceneName();
 
-		auto& registry = sceneToCopy.GetRegistry();
-		auto& registryToCopy = registry.GetRegistry();
-
 		m_RuntimeRegistry.DestroyEntities();
-
-		for (auto entityToCopy : registryToCopy.view<entt::entity>(entt::exclude<UneditableComponent>))
-		{
-			entt::entity newEntity = m_RuntimeRegistry.CreateEntity();
-
-			// Copy the components of the entity to the new entity
-			for (auto&& [id, storage] : registryToCopy.storage())
-			{
-				if (!storage.contains(entityToCopy))
-					continue;
-
-				InvokeMetaFunction(id, "copy_component"_hs, Entity{ &registry, entityToCopy }, Entity{ &m_RuntimeRegistry, newEntity });
-			}
-		}
+		sceneToCopy.GetRegistry().CloneEntities<UneditableComponent>(m_RuntimeRegistry);
+		CopyTilemapToRuntime(sceneToCopy.GetRegistry());
 
 		// Copy the player start from the new scene
 		if (sceneToCopy.IsPlayerStartEnabled())
@@ -134,6 +117,19 @@ namespace Feather {
 		m_PlayerStart.CreatePlayer(runtimeRegistry);
 	}
 
+	void SceneObject::CopyTilemapToRuntime(Registry& sourceRegistry)
+	{
+		// Baked tiles are not entities and are not cloned with them
+		auto* sourceTilemap = sourceRegistry.TryGetContext<std::shared_ptr<Tilemap>>();
+		if (!sourceTilemap)
+			return;
+
+		if (auto* runtimeTilemap = m_RuntimeRegistry.TryGetContext<std::shared_ptr<Tilemap>>())
+			**runtimeTilemap = **sourceTilemap;
+		else
+			m_RuntimeRegistry.AddToContext<std::shared_ptr<Tilemap>>(std::make_shared<Tilemap>(**sourceTilemap));
+	}
+
 	void SceneObject::ClearRuntimeScene()
 	{
 		m_RuntimeRegistry.ClearRegistry();
@@ -197,36 +193,8 @@ namespace Feather {
 			auto& sprite = ent.GetComponent<SpriteComponent>();
 			if (sprite.layer == layer)
 			{
-				Tile removedTile{};
-				removedTile.transform = ent.GetComponent<TransformComponent>();
-				removedTile.sprite = ent.GetComponent<SpriteComponent>();
-
-				if (auto* boxCollider = ent.TryGetComponent<BoxColliderComponent>())
-				{
-					removedTile.isCollider = true;
-					removedTile.boxCollider = *boxCollider;
-				}
-
-				if (auto* circleCollider = ent.TryGetComponent<CircleColliderComponent>())
-				{
-					removedTile.isCircle = true;
-					removedTile.circleCollider = *circleCollider;
-				}
-
-				if (auto* animation = ent.TryGetComponent<AnimationComponent>())
-				{
-					removedTile.hasAnimation = true;
-					removedTile.animation = *animation;
-				}
-
-				if (auto* physics = ent.TryGetComponent<PhysicsComponent>())
-				{
-					removedTile.hasPhysics = true;
-					removedTile.physics = *physics;
-				}
-
+				removedTiles.push_back(TileUtils::CopyTile(ent));
 				ent.Destroy();
-				removedTiles.push_back(removedTile);
 			}
 			else if (sprite.layer > layer) // Drop the layer down if greater
 			{
@@ -234,6 +202,15 @@ namespace Feather {
 			}
 		}
 
+		// Keep the baked tiles of the layer for the undo
+		auto& tilemap = m_Registry.GetContext<std::shared_ptr<Tilemap>>();
+		tilemap->ForEachTile([&](const TransformComponent& transform, const SpriteComponent& sprite) {
+			if (sprite.layer == layer)
+				removedTiles.push_back(Tile{ .transform = transform, .sprite = sprite });
+		});
+
+		tilemap->RemoveLayer(layer);
+
 		auto removeTileLayerCmd = UndoableCommands{ RemoveTileLayerCmd{.sceneObject = this, .tilesRemoved = removedTiles, .spriteLayerParams = copySpriteLayer} };
 
 		COMMAND_MANAGER().Execute(removeTileLayerCmd);
@@ -32,7 +32,7 @@ namespace Feather {
 	public:
 		SceneObject(const std::string& sceneName, EMapType eType = EMapType::Grid);
 		SceneObject(const std::string& sceneName, const std::string& sceneData);
-		~SceneObject() = default;
+		~SceneObject();
 
 		void CopySceneToRuntime();
 		void CopySceneToRuntime(SceneObject& sceneToCopy);
@@ -61,6 +61,7 @@ namespace Feather {
 
 	private:
 		void OnEntityNameChanges(NameChangeEvent& nameChange);
+		void CopyTilemapToRuntime(Registry& sourceRegistry);
 
 	private:
 		Registry m_RuntimeRegistry;
@@ -0,0 +1,180 @@
+#include "TileSpatialIndex.h"
+
+#include "Core/ECS/Components/TileComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/SpriteComponent.h"
+
+/* Size of a grid bucket in world units. Tiles larger than a bucket are added to each bucket they overlap */
+constexpr float TILE_INDEX_CELL_SIZE = 32.0f;
+
+namespace Feather {
+
+	TileSpatialIndex::TileSpatialIndex(entt::registry& registry)
+		: m_Registry{ registry }
+	{
+		m_Registry.on_construct<TileComponent>().connect<&TileSpatialIndex::OnTileConstruct>(*this);
+		m_Registry.on_destroy<TileComponent>().connect<&TileSpatialIndex::OnTileDestroy>(*this);
+		m_Registry.on_update<TransformComponent>().connect<&TileSpatialIndex::OnTileChanged>(*this);
+		m_Registry.on_update<SpriteComponent>().connect<&TileSpatialIndex::OnTileChanged>(*this);
+
+		Rebuild();
+	}
+
+	TileSpatialIndex::~TileSpatialIndex()
+	{
+		m_Registry.on_construct<TileComponent>().disconnect(this);
+		m_Registry.on_destroy<TileComponent>().disconnect(this);
+		m_Registry.on_update<TransformComponent>().disconnect(this);
+		m_Registry.on_update<SpriteComponent>().disconnect(this);
+	}
+
+	entt::entity TileSpatialIndex::FindTile(const glm::vec2& position, int layer) const
+	{
+		auto cellItr = m_mapGridCells.find(MakeKey(static_cast<int>(std::floor(position.x / TILE_INDEX_CELL_SIZE)),
+												   static_cast<int>(std::floor(position.y / TILE_INDEX_CELL_SIZE))));
+		if (cellItr == m_mapGridCells.end())
+			return entt::null;
+
+		for (auto entity : cellItr->second)
+		{
+			const auto& [transform, sprite] = m_Registry.get<TransformComponent, SpriteComponent>(entity);
+
+			if (position.x >= transform.position.x &&
+				position.x < transform.position.x + sprite.width * transform.scale.x &&
+				position.y >= transform.position.y &&
+				position.y < transform.position.y + sprite.height * transform.scale.y &&
+				layer == sprite.layer)
+			{
+				return entity;
+			}
+		}
+
+		return entt::null;
+	}
+
+	entt::entity TileSpatialIndex::FindIsoTile(const glm::vec2& position, const glm::vec2& tileSize, int layer) const
+	{
+		int positionOffsetX = position.x + (tileSize.x / 2.0f);
+		int positionOffsetY = position.y + (tileSize.y / 2.0f);
+
+		auto centerItr = m_mapIsoCenters.find(MakeKey(positionOffsetX, positionOffsetY));
+		if (centerItr == m_mapIsoCenters.end())
+			return entt::null;
+
+		for (auto entity : centerItr->second)
+		{
+			if (m_Registry.get<SpriteComponent>(entity).layer == layer)
+				return entity;
+		}
+
+		return entt::null;
+	}
+
+	void TileSpatialIndex::Rebuild()
+	{
+		m_mapGridCells.clear();
+		m_mapIsoCenters.clear();
+		m_mapIndexedTiles.clear();
+
+		for (auto entity : m_Registry.view<TileComponent, TransformComponent, SpriteComponent>())
+		{
+			Insert(entity);
+		}
+	}
+
+	TileSpatialIndex::CellKey TileSpatialIndex::MakeKey(int x, int y)
+	{
+		return (static_cast<CellKey>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+	}
+
+	void TileSpatialIndex::Insert(entt::entity entity)
+	{
+		const auto& [transform, sprite] = m_Registry.get<TransformComponent, SpriteComponent>(entity);
+
+		const float width = sprite.width * transform.scale.x;
+		const float height = sprite.height * transform.scale.y;
+
+		// The tile covers [position, position + size), the size can be negative if the tile is flipped
+		const float left = std::min(transform.position.x, transform.position.x + width);
+		const float right = std::max(transform.position.x, transform.position.x + width);
+		const float top = std::min(transform.position.y, transform.position.y + height);
+		const float bottom = std::max(transform.position.y, transform.position.y + height);
+
+		IndexedTile indexedTile{};
+		indexedTile.minCell = glm::ivec2{ std::floor(left / TILE_INDEX_CELL_SIZE), std::floor(top / TILE_INDEX_CELL_SIZE) };
+		indexedTile.maxCell = glm::ivec2{
+			std::max(indexedTile.minCell.x, static_cast<int>(std::ceil(right / TILE_INDEX_CELL_SIZE)) - 1),
+			std::max(indexedTile.minCell.y, static_cast<int>(std::ceil(bottom / TILE_INDEX_CELL_SIZE)) - 1) };
+
+		for (int y = indexedTile.minCell.y; y <= indexedTile.maxCell.y; ++y)
+		{
+			for (int x = indexedTile.minCell.x; x <= indexedTile.maxCell.x; ++x)
+			{
+				m_mapGridCells[MakeKey(x, y)].push_back(entity);
+			}
+		}
+
+		// Iso tiles are matched at the center of the tile
+		int spriteCenterX = transform.position.x + (width / 2.0f);
+		int spriteCenterY = transform.position.y + (height / 2.0f);
+		indexedTile.isoKey = MakeKey(spriteCenterX, spriteCenterY);
+		m_mapIsoCenters[indexedTile.isoKey].push_back(entity);
+
+		m_mapIndexedTiles.insert_or_assign(entity, indexedTile);
+	}
+
+	void TileSpatialIndex::Remove(entt::entity entity)
+	{
+		auto indexedItr = m_mapIndexedTiles.find(entity);
+		if (indexedItr == m_mapIndexedTiles.end())
+			return;
+
+		const auto& indexedTile = indexedItr->second;
+
+		auto removeFromBucket = [entity](auto& mapBuckets, CellKey key) {
+			auto bucketItr = mapBuckets.find(key);
+			if (bucketItr == mapBuckets.end())
+				return;
+
+			std::erase(bucketItr->second, entity);
+			if (bucketItr->second.empty())
+				mapBuckets.erase(bucketItr);
+		};
+
+		for (int y = indexedTile.minCell.y; y <= indexedTile.maxCell.y; ++y)
+		{
+			for (int x = indexedTile.minCell.x; x <= indexedTile.maxCell.x; ++x)
+			{
+				removeFromBucket(m_mapGridCells, MakeKey(x, y));
+			}
+		}
+
+		removeFromBucket(m_mapIsoCenters, indexedTile.isoKey);
+
+		m_mapIndexedTiles.erase(indexedItr);
+	}
+
+	void TileSpatialIndex::OnTileConstruct(entt::registry& registry, entt::entity entity)
+	{
+		// Tiles get their tile component after the transform and sprite
+		if (!registry.all_of<TransformComponent, SpriteComponent>(entity))
+			return;
+
+		Insert(entity);
+	}
+
+	void TileSpatialIndex::OnTileDestroy(entt::registry& registry, entt::entity entity)
+	{
+		Remove(entity);
+	}
+
+	void TileSpatialIndex::OnTileChanged(entt::registry& registry, entt::entity entity)
+	{
+		if (!registry.all_of<TileComponent, TransformComponent, SpriteComponent>(entity))
+			return;
+
+		Remove(entity);
+		Insert(entity);
+	}
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <entt.hpp>
+#include <glm/glm.hpp>
+
+namespace Feather {
+
+	/*
+	* @brief Spatial index of the tiles in a scene, used by the tile tools and their commands
+	* to find the tile at a position without walking every tile.
+	* Grid tiles are bucketed by every cell their rect overlaps, iso tiles by their center.
+	* The layer is checked against the candidates in a bucket rather than being part of the key,
+	* so the layer commands can change tile layers in place without reindexing.
+	* The index follows tile creation and destruction through the registry signals, so it must be destroyed before the
+	* registry. Its owner removes it from the registry context first, the context outlives the storages.
+	*/
+	class TileSpatialIndex
+	{
+	public:
+		TileSpatialIndex(entt::registry& registry);
+		~TileSpatialIndex();
+
+		/*
+		* @brief Finds the tile on the layer whose rect contains the position.
+		* @return Returns the tile entity or entt::null if there is none.
+		*/
+		entt::entity FindTile(const glm::vec2& position, int layer) const;
+
+		/*
+		* @brief Finds the iso tile on the layer with the same center as a tile of the given size at the position.
+		* @return Returns the tile entity or entt::null if there is none.
+		*/
+		entt::entity FindIsoTile(const glm::vec2& position, const glm::vec2& tileSize, int layer) const;
+
+		/*
+		* @brief Rebuilds the index from every tile in the registry.
+		*/
+		void Rebuild();
+
+		inline size_t Size() const { return m_mapIndexedTiles.size(); }
+
+	private:
+		using CellKey = uint64_t;
+
+		struct IndexedTile
+		{
+			glm::ivec2 minCell{ 0 };
+			glm::ivec2 maxCell{ 0 };
+			CellKey isoKey{ 0 };
+		};
+
+		static CellKey MakeKey(int x, int y);
+
+		void Insert(entt::entity entity);
+		void Remove(entt::entity entity);
+
+		void OnTileConstruct(entt::registry& registry, entt::entity entity);
+		void OnTileDestroy(entt::registry& registry, entt::entity entity);
+		void OnTileChanged(entt::registry& registry, entt::entity entity);
+
+	private:
+		entt::registry& m_Registry;
+		/* @brief Grid buckets to the tiles that overlap them */
+		std::unordered_map<CellKey, std::vector<entt::entity>> m_mapGridCells;
+		/* @brief Integer tile centers to the iso tiles with that center */
+		std::unordered_map<CellKey, std::vector<entt::entity>> m_mapIsoCenters;
+		/* @brief Where each tile was indexed, so it can be removed after its transform changed */
+		std::unordered_map<entt::entity, IndexedTile> m_mapIndexedTiles;
+	};
+
+}
@@ -0,0 +1,150 @@
+#include "TileUtils.h"
+
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Entity.h"
+#include "Core/Tilemap/Tilemap.h"
+#include "Logger/Logger.h"
+
+#include "Editor/Utilities/EditorUtilities.h"
+#include "Editor/Scene/TileSpatialIndex.h"
+
+namespace Feather {
+
+	bool TileUtils::IsStaticTile(const Tile& tile)
+	{
+		return Tilemap::IsStaticTile(tile.sprite, tile.isCollider || tile.isCircle, tile.hasAnimation, tile.hasPhysics);
+	}
+
+	void TileUtils::AddTile(Registry& registry, const Tile& tile)
+	{
+		if (IsStaticTile(tile))
+		{
+			auto& tilemap = registry.GetContext<std::shared_ptr<Tilemap>>();
+			tilemap->AddTile(tile.transform, tile.sprite);
+			return;
+		}
+
+		Entity newTile{ &registry, "", "" };
+		newTile.AddComponent<TransformComponent>(tile.transform);
+		newTile.AddComponent<SpriteComponent>(tile.sprite);
+
+		if (tile.isCollider)
+			newTile.AddComponent<BoxColliderComponent>(tile.boxCollider);
+		if (tile.isCircle)
+			newTile.AddComponent<CircleColliderComponent>(tile.circleCollider);
+		if (tile.hasAnimation)
+			newTile.AddComponent<AnimationComponent>(tile.animation);
+		if (tile.hasPhysics)
+			newTile.AddComponent<PhysicsComponent>(tile.physics);
+
+		newTile.AddComponent<TileComponent>(static_cast<uint32_t>(newTile.GetEntity()));
+	}
+
+	Tile TileUtils::CopyTile(Entity& tileEntity)
+	{
+		Tile tile{};
+		tile.transform = tileEntity.GetComponent<TransformComponent>();
+		tile.sprite = tileEntity.GetComponent<SpriteComponent>();
+
+		if (const auto* boxCollider = tileEntity.TryGetComponent<BoxColliderComponent>())
+		{
+			tile.isCollider = true;
+			tile.boxCollider = *boxCollider;
+		}
+		if (const auto* circleCollider = tileEntity.TryGetComponent<CircleColliderComponent>())
+		{
+			tile.isCircle = true;
+			tile.circleCollider = *circleCollider;
+		}
+		if (const auto* animation = tileEntity.TryGetComponent<AnimationComponent>())
+		{
+			tile.hasAnimation = true;
+			tile.animation = *animation;
+		}
+		if (const auto* physics = tileEntity.TryGetComponent<PhysicsComponent>())
+		{
+			tile.hasPhysics = true;
+			tile.physics = *physics;
+		}
+
+		return tile;
+	}
+
+	bool TileUtils::HasTile(Registry& registry, const glm::vec2& position, int layer)
+	{
+		auto& tileIndex = registry.GetContext<std::shared_ptr<TileSpatialIndex>>();
+		if (tileIndex->FindTile(position, layer) != entt::null)
+			return true;
+
+		TilemapTileRef bakedTile{};
+		return registry.GetContext<std::shared_ptr<Tilemap>>()->FindTile(position, layer, bakedTile);
+	}
+
+	bool TileUtils::HasIsoTile(Registry& registry, const glm::vec2& position, const glm::vec2& tileSize, int layer)
+	{
+		auto& tileIndex = registry.GetContext<std::shared_ptr<TileSpatialIndex>>();
+		if (tileIndex->FindIsoTile(position, tileSize, layer) != entt::null)
+			return true;
+
+		TilemapTileRef bakedTile{};
+		return registry.GetContext<std::shared_ptr<Tilemap>>()->FindIsoTile(position, tileSize, layer, bakedTile);
+	}
+
+	bool TileUtils::RemoveTile(Registry& registry, const glm::vec2& position, int layer, Tile* outRemovedTile)
+	{
+		auto& tileIndex = registry.GetContext<std::shared_ptr<TileSpatialIndex>>();
+		if (auto entity = tileIndex->FindTile(position, layer); entity != entt::null)
+		{
+			Entity tileEntity{ &registry, entity };
+			if (outRemovedTile)
+				*outRemovedTile = CopyTile(tileEntity);
+
+			tileEntity.Destroy();
+			return true;
+		}
+
+		auto& tilemap = registry.GetContext<std::shared_ptr<Tilemap>>();
+		TilemapTileRef bakedTile{};
+		if (!tilemap->FindTile(position, layer, bakedTile))
+			return false;
+
+		if (outRemovedTile)
+		{
+			*outRemovedTile = Tile{};
+			tilemap->GetTile(bakedTile, outRemovedTile->transform, outRemovedTile->sprite);
+		}
+
+		tilemap->RemoveTile(bakedTile);
+		return true;
+	}
+
+	bool TileUtils::RemoveIsoTile(Registry& registry, const glm::vec2& position, const glm::vec2& tileSize, int layer,
+								  Tile* outRemovedTile)
+	{
+		auto& tileIndex = registry.GetContext<std::shared_ptr<TileSpatialIndex>>();
+		if (auto entity = tileIndex->FindIsoTile(position, tileSize, layer); entity != entt::null)
+		{
+			Entity tileEntity{ &registry, entity };
+			if (outRemovedTile)
+				*outRemovedTile = CopyTile(tileEntity);
+
+			tileEntity.Destroy();
+			return true;
+		}
+
+		auto& tilemap = registry.GetContext<std::shared_ptr<Tilemap>>();
+		TilemapTileRef bakedTile{};
+		if (!tilemap->FindIsoTile(position, tileSize, layer, bakedTile))
+			return false;
+
+		if (outRemovedTile)
+		{
+			*outRemovedTile = Tile{};
+			tilemap->GetTile(bakedTile, outRemovedTile->transform, outRemovedTile->sprite);
+		}
+
+		tilemap->RemoveTile(bakedTile);
+		return true;
+	}
+
+}
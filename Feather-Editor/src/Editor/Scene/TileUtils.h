@@ -0,0 +1,60 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Feather {
+
+	class Registry;
+	class Entity;
+	struct Tile;
+
+	/*
+	* @brief Adds and removes the tiles of a scene for the tile tools and their commands.
+	* Static tiles are baked into the scene's Tilemap, the same as when the scene is loaded.
+	* Tiles with colliders, physics or animations are entities with a TileComponent.
+	* Lookups check the entity tiles before the baked tiles.
+	*/
+	struct TileUtils
+	{
+		/*
+		* @brief Checks if the tile only draws a sprite and can be baked into the tilemap.
+		*/
+		static bool IsStaticTile(const Tile& tile);
+
+		/*
+		* @brief Adds the tile to the tilemap if it is static, otherwise creates a tile entity.
+		*/
+		static void AddTile(Registry& registry, const Tile& tile);
+
+		/*
+		* @brief Copies the components of a tile entity.
+		*/
+		static Tile CopyTile(Entity& tileEntity);
+
+		/*
+		* @brief Checks for a tile on the layer whose rect contains the position.
+		*/
+		static bool HasTile(Registry& registry, const glm::vec2& position, int layer);
+
+		/*
+		* @brief Checks for an iso tile on the layer with the same center as a tile of the given size at the position.
+		*/
+		static bool HasIsoTile(Registry& registry, const glm::vec2& position, const glm::vec2& tileSize, int layer);
+
+		/*
+		* @brief Removes the tile on the layer whose rect contains the position.
+		* @param outRemovedTile Optional copy of the removed tile, used by the undo commands.
+		* @return Returns true if a tile was removed.
+		*/
+		static bool RemoveTile(Registry& registry, const glm::vec2& position, int layer, Tile* outRemovedTile = nullptr);
+
+		/*
+		* @brief Removes the iso tile on the layer with the same center as a tile of the given size at the position.
+		* @param outRemovedTile Optional copy of the removed tile, used by the undo commands.
+		* @return Returns true if a tile was removed.
+		*/
+		static bool RemoveIsoTile(Registry& registry, const glm::vec2& position, const glm::vec2& tileSize, int layer,
+								  Tile* outRemovedTile = nullptr);
+	};
+
+}
@@ -5,6 +5,8 @@
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/CoreUtils/CoreUtilities.h"
+#include "Core/Systems/SpriteExtractor.h"
+#include "Core/Tilemap/Tilemap.h"
 #include "Renderer/Core/Camera2D.h"
 #include "Renderer/Essentials/Shader.h"
 #include "Renderer/Essentials/Texture.h"
@@ -15,6 +17,7 @@ namespace Feather {
 
 	EditorRenderSystem::EditorRenderSystem()
 		: m_BatchRenderer{ std::make_unique<SpriteBatchRenderer>() }
+		, m_SpriteExtractor{ std::make_unique<SpriteExtractor>() }
 	{}
 
 	EditorRenderSystem::~EditorRenderSystem() = default;
@@ -24,10 +27,10 @@ namespace Feather {
 		auto& mainRegistry = MAIN_REGISTRY();
 		auto& assetManager = mainRegistry.GetAssetManager();
 
-		auto spriteShader = assetManager.GetShader("basic");
+		const auto& spriteShader = assetManager.ResolveShader("basic", m_SpriteShaderHandle);
 		auto cam_mat = camera.GetCameraMatrix();
 
-		if (spriteShader->ShaderProgramID() == 0)
+		if (!spriteShader || spriteShader->ShaderProgramID() == 0)
 		{
 			F_ERROR("Sprite shader program has not been set correctly!");
 			return;
@@ -39,23 +42,18 @@ namespace Feather {
 
 		m_BatchRenderer->Begin();
 
-		auto spriteView = registry.GetRegistry().view<SpriteComponent, TransformComponent>(entt::exclude<UIComponent>);
-		std::function<bool(entt::entity)> filterFunc;
+		SpriteExtractor::EntityFilter filterFunc{ nullptr };
 
-		// Check to see if the layers are visible, if not, filter them out
-		if (layerFilters.empty())
+		// Check to see if the layers are visible, if not, filter them out. Runs on the job system, so it only reads the registry
+		if (!layerFilters.empty())
 		{
-			filterFunc = [](entt::entity) { return true; };
-		}
-		else
-		{
-			filterFunc = [&](entt::entity entity)
+			filterFunc = [&registry, &layerFilters](entt::entity entity)
 			{
 				// We only want to filter tiles
 				if (!registry.GetRegistry().all_of<TileComponent>(entity))
 					return true;
 
-				const auto& sprite = spriteView.get<SpriteComponent>(entity);
+				const auto& sprite = registry.GetRegistry().get<SpriteComponent>(entity);
 				if (sprite.layer >= 0)
 				{
 					auto layerItr = std::ranges::find_if(layerFilters,
@@ -72,44 +70,25 @@ namespace Feather {
 			};
 		}
 
-		for (const auto& entity : std::views::filter(spriteView, filterFunc))
-		{
-			const auto& transform = spriteView.get<TransformComponent>(entity);
-			const auto& sprite = spriteView.get<SpriteComponent>(entity);
-
-			if (!EntityInView(transform, sprite.width, sprite.height, camera))
-				continue;
+		m_SpriteExtractor->Extract(registry, camera, assetManager, *m_BatchRenderer, filterFunc);
 
-			if (sprite.textureName.empty() || sprite.isHidden)
-				continue;
-
-			const auto& pTexture = assetManager.GetTexture(sprite.textureName);
-			if (!pTexture)
+		// Static tiles are drawn from their prebuilt chunks, with the same layer filter
+		if (auto* pTilemap = registry.TryGetContext<std::shared_ptr<Tilemap>>(); pTilemap && *pTilemap)
+		{
+			Tilemap::LayerFilter layerFilter{ nullptr };
+			if (!layerFilters.empty())
 			{
-				F_ERROR("Texture '{}' was not created correctly!", sprite.textureName);
-				return;
-			}
-
-			glm::vec4 spriteRect{ transform.position.x, transform.position.y, sprite.width, sprite.height };
-			glm::vec4 uvRect{ sprite.uvs.u, sprite.uvs.v, sprite.uvs.uv_width, sprite.uvs.uv_height };
-
-			glm::mat4 model = TRSModel(transform, sprite.width, sprite.height);
+				layerFilter = [&layerFilters](int layer)
+				{
+					if (layer < 0)
+						return false;
 
-			if (sprite.isIsometric)
-			{
-				m_BatchRenderer->AddSpriteIso(spriteRect,
-											  uvRect,
-											  pTexture->GetID(),
-											  sprite.isoCellX,
-											  sprite.isoCellY,
-											  sprite.layer,
-											  model,
-											  sprite.color);
-			}
-			else
-			{
-				m_BatchRenderer->AddSprite(spriteRect, uvRect, pTexture->GetID(), sprite.layer, model, sprite.color);
+					auto layerItr = std::ranges::find(layerFilters, layer, &SpriteLayerParams::layer);
+					return layerItr != layerFilters.end() ? layerItr->isVisible : false;
+				};
 			}
+
+			(*pTilemap)->AddVisibleTiles(*m_BatchRenderer, camera, assetManager, layerFilter);
 		}
 
 		m_BatchRenderer->End();
@@ -1,11 +1,15 @@
 #pragma once
 
+#include "Core/Resources/AssetHandle.h"
+
 namespace Feather {
 
 	struct SpriteLayerParams;
 	class Registry;
 	class Camera2D;
 	class SpriteBatchRenderer;
+	class SpriteExtractor;
+	class Shader;
 
 	class EditorRenderSystem
 	{
@@ -16,11 +20,14 @@ namespace Feather {
 		/*
 		 * @brief Loops through all of the entities in the registry that have a sprite
 		 * and transform component. Applies all the necessary transformations and adds them to a batch to be rendered.
+		 * Culling and transforming is split across the job system, the layer filters are applied on worker threads.
 		 */
 		void Update(Registry& registry, Camera2D& camera, const std::vector<SpriteLayerParams>& layerFilters = {});
 
 	private:
 		std::unique_ptr<SpriteBatchRenderer> m_BatchRenderer;
+		std::unique_ptr<SpriteExtractor> m_SpriteExtractor;
+		AssetHandle<Shader> m_SpriteShaderHandle{};
 	};
 
 }
@@ -28,7 +28,7 @@ namespace Feather {
 		auto& assetManager = MAIN_REGISTRY().GetAssetManager();
 		const auto& canvas = currentScene.GetCanvas();
 		auto camMat = camera.GetCameraMatrix();
-		auto colorShader = assetManager.GetShader("color");
+		const auto& colorShader = assetManager.ResolveShader("color", m_ColorShaderHandle);
 		colorShader->Enable();
 		colorShader->SetUniformMat4("uProjection", camMat);
 
@@ -74,7 +74,7 @@ namespace Feather {
 		const auto& canvas = currentScene.GetCanvas();
 		auto camMat = camera.GetCameraMatrix();
 
-		auto colorShader = assetManager.GetShader("color");
+		const auto& colorShader = assetManager.ResolveShader("color", m_ColorShaderHandle);
 
 		colorShader->Enable();
 		colorShader->SetUniformMat4("uProjection", camMat);
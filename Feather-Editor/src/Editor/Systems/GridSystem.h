@@ -1,10 +1,13 @@
 #pragma once
 
+#include "Core/Resources/AssetHandle.h"
+
 namespace Feather {
 
 	class RectBatchRenderer;
 	class Camera2D;
 	class Scene;
+	class Shader;
 
 	class GridSystem
 	{
@@ -19,6 +22,7 @@ namespace Feather {
 
 	private:
 		std::unique_ptr<RectBatchRenderer> m_BatchRenderer;
+		AssetHandle<Shader> m_ColorShaderHandle{};
 	};
 
 }
@@ -53,12 +53,9 @@ namespace Feather {
 	{
 		const auto& mouseWorldCoords = GetMouseWorldCoords();
 
-		if (auto id = CheckForTile(mouseWorldCoords); id != entt::null)
+		if (CheckForTile(mouseWorldCoords))
 			return;
 
-		Entity tile{ CreateEntity() };
-		tile.AddComponent<TransformComponent>(m_MouseTile->transform);
-
 		if (m_CurrentScene->GetMapType() == EMapType::IsoGrid)
 		{
 			m_MouseTile->sprite.isIsometric = true;
@@ -66,26 +63,7 @@ namespace Feather {
 			m_MouseTile->sprite.isoCellY = m_GridCoords.y;
 		}
 
-		tile.AddComponent<SpriteComponent>(m_MouseTile->sprite);
-
-		if (m_MouseTile->isCollider)
-		{
-			tile.AddComponent<BoxColliderComponent>(m_MouseTile->boxCollider);
-		}
-		if (m_MouseTile->isCircle)
-		{
-			tile.AddComponent<CircleColliderComponent>(m_MouseTile->circleCollider);
-		}
-		if (m_MouseTile->hasAnimation)
-		{
-			tile.AddComponent<AnimationComponent>(m_MouseTile->animation);
-		}
-		if (m_MouseTile->hasPhysics)
-		{
-			tile.AddComponent<PhysicsComponent>(m_MouseTile->physics);
-		}
-
-		tile.AddComponent<TileComponent>(static_cast<uint32_t>(tile.GetEntity()));
+		AddTile(*m_MouseTile);
 
 		auto createToolAddCmd = UndoableCommands
 		{
@@ -103,48 +81,20 @@ namespace Feather {
 	{
 		const auto& mouseWorldCoords = GetMouseWorldCoords();
 
-		if (auto id = CheckForTile(mouseWorldCoords); id != entt::null)
-		{
-			Entity tileToRemove{ CreateEntity(id) };
-			Tile removedTile{};
-
-			removedTile.transform = tileToRemove.GetComponent<TransformComponent>();
-			removedTile.sprite= tileToRemove.GetComponent<SpriteComponent>();
+		Tile removedTile{};
+		if (!RemoveTileAt(mouseWorldCoords, removedTile))
+			return;
 
-			if (tileToRemove.HasComponent<BoxColliderComponent>())
-			{
-				removedTile.isCollider = true;
-				removedTile.boxCollider = tileToRemove.GetComponent<BoxColliderComponent>();
-			}
-			if (tileToRemove.HasComponent<CircleColliderComponent>())
-			{
-				removedTile.isCircle = true;
-				removedTile.circleCollider = tileToRemove.GetComponent<CircleColliderComponent>();
-			}
-			if (tileToRemove.HasComponent<AnimationComponent>())
-			{
-				removedTile.hasAnimation = true;
-				removedTile.animation = tileToRemove.GetComponent<AnimationComponent>();
-			}
-			if (tileToRemove.HasComponent<PhysicsComponent>())
+		auto createToolRemoveCmd = UndoableCommands
+		{
+			CreateTileToolRemoveCmd
 			{
-				removedTile.hasPhysics = true;
-				removedTile.physics = tileToRemove.GetComponent<PhysicsComponent>();
+				.registry = SCENE_MANAGER().GetCurrentScene()->GetRegistryPtr(),
+				.tile = std::make_shared<Tile>(removedTile)
 			}
+		};
 
-			tileToRemove.Destroy();
-
-			auto createToolRemoveCmd = UndoableCommands
-			{
-				CreateTileToolRemoveCmd
-				{
-					.registry = SCENE_MANAGER().GetCurrentScene()->GetRegistryPtr(),
-					.tile = std::make_shared<Tile>(removedTile)
-				}
-			};
-
-			COMMAND_MANAGER().Execute(createToolRemoveCmd);
-		}
+		COMMAND_MANAGER().Execute(createToolRemoveCmd);
 	}
 
 }
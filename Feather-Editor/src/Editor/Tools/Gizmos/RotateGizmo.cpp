@@ -37,24 +37,25 @@ namespace Feather {
 		Show();
 
 		Entity selectedEntity{ m_Registry, m_SelectedEntity };
-		auto& selectedTransform = selectedEntity.GetComponent<TransformComponent>();
 
 		float deltaX{ GetDeltaX() };
 		if (deltaX != 0.0f)
 		{
-			selectedTransform.rotation += deltaX;
-
-			// Clamp the values between 0 and 360
-			if (selectedTransform.rotation < 0.0f)
-			{
-				selectedTransform.rotation = 360.0f + selectedTransform.rotation;
-			}
-			else if (selectedTransform.rotation > 360.0f)
-			{
-				selectedTransform.rotation = selectedTransform.rotation - 360.0f;
-			}
-
-			selectedTransform.isDirty = true;
+			m_Registry->GetRegistry().patch<TransformComponent>(m_SelectedEntity, [&](auto& selectedTransform) {
+				selectedTransform.rotation += deltaX;
+
+				// Clamp the values between 0 and 360
+				if (selectedTransform.rotation < 0.0f)
+				{
+					selectedTransform.rotation = 360.0f + selectedTransform.rotation;
+				}
+				else if (selectedTransform.rotation > 360.0f)
+				{
+					selectedTransform.rotation = selectedTransform.rotation - 360.0f;
+				}
+
+				selectedTransform.isDirty = true;
+			});
 		}
 
 		SetGizmoPosition(selectedEntity);
@@ -36,15 +36,16 @@ namespace Feather {
 		Show();
 
 		Entity selectedEntity{ m_Registry, m_SelectedEntity };
-		auto& selectedTransform = selectedEntity.GetComponent<TransformComponent>();
 
 		float deltaX{ GetDeltaX() * SCALING_FACTOR };
 		float deltaY{ GetDeltaY() * SCALING_FACTOR };
 		if (deltaX != 0.0f || deltaY != 0.0f)
 		{
-			selectedTransform.scale.x += deltaX;
-			selectedTransform.scale.y -= deltaY;
-			selectedTransform.isDirty = true;
+			m_Registry->GetRegistry().patch<TransformComponent>(m_SelectedEntity, [&](auto& selectedTransform) {
+				selectedTransform.scale.x += deltaX;
+				selectedTransform.scale.y -= deltaY;
+				selectedTransform.isDirty = true;
+			});
 		}
 
 		SetGizmoPosition(selectedEntity);
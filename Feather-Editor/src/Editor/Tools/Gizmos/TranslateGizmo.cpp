@@ -53,6 +53,7 @@ namespace Feather {
 
 		if (bTransformChanged)
 		{
+			// Patches the transforms of the entity and its children
 			selectedEntity.UpdateTransform();
 
 			// Update sprite cells
@@ -61,8 +62,10 @@ namespace Feather {
 				if (pSprite->isIsometric)
 				{
 					auto [cellX, cellY] = ConvertWorldPosToIsoCoords(selectedTransform.position + glm::vec2{ pSprite->width / 2.0f, pSprite->height }, canvas);
-					pSprite->isoCellX = cellX;
-					pSprite->isoCellX = cellY;
+					m_Registry->GetRegistry().patch<SpriteComponent>(m_SelectedEntity, [&](auto& sprite) {
+						sprite.isoCellX = cellX;
+						sprite.isoCellY = cellY;
+					});
 				}
 			}
 		}
@@ -135,45 +135,13 @@ namespace Feather {
 			{
 				glm::vec2 newTilePosition{ m_StartPressPos.x + x, m_StartPressPos.y + y };
 
-				if (auto id = CheckForTile(newTilePosition); id != entt::null)
+				if (CheckForTile(newTilePosition))
 					continue;
 
-				Entity tile{ CreateEntity() };
-				Tile createdTile{};
-				auto& newTransform = tile.AddComponent<TransformComponent>(transform);
-				newTransform.position = newTilePosition;
-				createdTile.transform = newTransform;
-
-				tile.AddComponent<SpriteComponent>(sprite);
-
-				createdTile.sprite = sprite;
-
-				if (m_MouseTile->isCollider)
-				{
-					tile.AddComponent<BoxColliderComponent>(m_MouseTile->boxCollider);
-					createdTile.boxCollider = m_MouseTile->boxCollider;
-					createdTile.isCollider = true;
-				}
-				if (m_MouseTile->isCircle)
-				{
-					tile.AddComponent<CircleColliderComponent>(m_MouseTile->circleCollider);
-					createdTile.circleCollider = m_MouseTile->circleCollider;
-					createdTile.isCircle = true;
-				}
-				if (m_MouseTile->hasAnimation)
-				{
-					tile.AddComponent<AnimationComponent>(m_MouseTile->animation);
-					createdTile.animation = m_MouseTile->animation;
-					createdTile.hasAnimation = true;
-				}
-				if (m_MouseTile->hasPhysics)
-				{
-					tile.AddComponent<PhysicsComponent>(m_MouseTile->physics);
-					createdTile.physics = m_MouseTile->physics;
-					createdTile.hasPhysics = true;
-				}
-
-				tile.AddComponent<TileComponent>(static_cast<uint32_t>(tile.GetEntity()));
+				Tile createdTile{ *m_MouseTile };
+				createdTile.transform.position = newTilePosition;
+
+				AddTile(createdTile);
 				createdTiles.push_back(createdTile);
 			}
 		}
@@ -200,50 +168,17 @@ namespace Feather {
 		auto spriteWidth = static_cast<int>(sprite.width * transform.scale.x * (dx > 0 ? 1.0f : -1.0f));
 		auto spriteHeight = static_cast<int>(sprite.height * transform.scale.y * (dy > 0 ? 1.0f : -1.0f));
 
-		std::set<std::uint32_t> entitiesToRemove{};
+		std::vector<Tile> removedTiles{};
 
 		for (int y = 0; (dy > 0 ? y < dy : y > dy); y += spriteHeight)
 		{
 			for (int x = 0; (dx > 0 ? x < dx : x > dx); x += spriteWidth)
 			{
-				if (auto id = CheckForTile(glm::vec2{ m_StartPressPos.x + x, m_StartPressPos.y + y }); id != entt::null)
-					entitiesToRemove.insert(id);
-			}
-		}
-
-		std::vector<Tile> removedTiles{};
-
-		for (auto id : entitiesToRemove)
-		{
-			Entity tileToRemove{ CreateEntity(id) };
-			Tile removedTile{};
-
-			removedTile.transform = tileToRemove.GetComponent<TransformComponent>();
-			removedTile.sprite = tileToRemove.GetComponent<SpriteComponent>();
-
-			if (tileToRemove.HasComponent<BoxColliderComponent>())
-			{
-				removedTile.boxCollider = tileToRemove.GetComponent<BoxColliderComponent>();
-				removedTile.isCollider = true;
+				// A tile larger than the step is removed at its first position and is not found again
+				Tile removedTile{};
+				if (RemoveTileAt(glm::vec2{ m_StartPressPos.x + x, m_StartPressPos.y + y }, removedTile))
+					removedTiles.push_back(removedTile);
 			}
-			if (tileToRemove.HasComponent<CircleColliderComponent>())
-			{
-				removedTile.circleCollider = tileToRemove.GetComponent<CircleColliderComponent>();
-				removedTile.isCircle = true;
-			}
-			if (tileToRemove.HasComponent<AnimationComponent>())
-			{
-				removedTile.animation = tileToRemove.GetComponent<AnimationComponent>();
-				removedTile.hasAnimation = true;
-			}
-			if (tileToRemove.HasComponent<PhysicsComponent>())
-			{
-				removedTile.physics = tileToRemove.GetComponent<PhysicsComponent>();
-				removedTile.hasPhysics = true;
-			}
-
-			tileToRemove.Destroy();
-			removedTiles.push_back(removedTile);
 		}
 
 		auto rectToolRemovedCmd = UndoableCommands
@@ -12,6 +12,7 @@
 
 #include "Editor/Utilities/EditorUtilities.h"
 #include "Editor/Scene/SceneObject.h"
+#include "Editor/Scene/TileUtils.h"
 
 constexpr int MOUSE_SPRITE_LAYER = 10;
 
@@ -96,61 +97,46 @@ namespace Feather {
 		return IsActivated() && !OutOfBounds() && IsOverTilemapWindow() && SpriteValid() && m_CurrentScene && m_CurrentScene->HasTileLayers();
 	}
 
-	uint32_t TileTool::CheckForTile(const glm::vec2& position)
+	bool TileTool::CheckForTile(const glm::vec2& position)
 	{
 		if (!m_Registry)
-			return entt::null;
+			return false;
 
-		auto tileView = m_Registry->GetRegistry().view<TileComponent, TransformComponent>();
-
-		for (auto entity : tileView)
+		const auto& sprite = m_MouseTile->sprite;
+		if (m_CurrentScene && m_CurrentScene->GetMapType() == EMapType::Grid)
 		{
-			Entity tile{ m_Registry, entity };
-			const auto& transform = tile.GetComponent<TransformComponent>();
-			const auto& sprite = tile.GetComponent<SpriteComponent>();
-
-			if (m_CurrentScene && m_CurrentScene->GetMapType() == EMapType::Grid)
-			{
-				if (position.x >= transform.position.x &&
-					position.x < transform.position.x + sprite.width * transform.scale.x &&
-					position.y >= transform.position.y &&
-					position.y < transform.position.y + sprite.height * transform.scale.y &&
-					m_MouseTile->sprite.layer == sprite.layer)
-				{
-					return static_cast<uint32_t>(entity);
-				}
-			}
-			else // Iso Grids, we check at the center of the tile if there is an entity
-			{
-				// Get the center pos of the sprite
-				int spriteCenterX = transform.position.x + ((sprite.width * transform.scale.x) / 2.0f);
-				int spriteCenterY = transform.position.y + ((sprite.height * transform.scale.y) / 2.0f);
-
-				// Get the offset of the position + sprite center
-				int positionOffsetX = position.x + ((sprite.width * transform.scale.x) / 2.0f);
-				int positionOffsetY = position.y + ((sprite.height * transform.scale.y) / 2.0f);
-
-				if (positionOffsetX == spriteCenterX && positionOffsetY == spriteCenterY &&
-					m_MouseTile->sprite.layer == sprite.layer)
-				{
-					return static_cast<uint32_t>(entity);
-				}
-			}
+			return TileUtils::HasTile(*m_Registry, position, sprite.layer);
 		}
 
-		return entt::null;
+		// Iso Grids, we check at the center of the tile if there is a tile
+		const auto& transform = m_MouseTile->transform;
+		return TileUtils::HasIsoTile(
+			*m_Registry, position, glm::vec2{ sprite.width * transform.scale.x, sprite.height * transform.scale.y }, sprite.layer);
 	}
 
-	Entity TileTool::CreateEntity()
+	bool TileTool::RemoveTileAt(const glm::vec2& position, Tile& outRemovedTile)
 	{
-		F_ASSERT(m_Registry && "The registry must be valid to create an entity");
-		return Entity{ m_Registry, "", "" };
+		if (!m_Registry)
+			return false;
+
+		const auto& sprite = m_MouseTile->sprite;
+		if (m_CurrentScene && m_CurrentScene->GetMapType() == EMapType::Grid)
+		{
+			return TileUtils::RemoveTile(*m_Registry, position, sprite.layer, &outRemovedTile);
+		}
+
+		const auto& transform = m_MouseTile->transform;
+		return TileUtils::RemoveIsoTile(*m_Registry,
+										position,
+										glm::vec2{ sprite.width * transform.scale.x, sprite.height * transform.scale.y },
+										sprite.layer,
+										&outRemovedTile);
 	}
 
-	Entity TileTool::CreateEntity(uint32_t id)
+	void TileTool::AddTile(const Tile& tile)
 	{
-		F_ASSERT(m_Registry && "The registry must be valid to create an entity");
-		return Entity{ m_Registry, static_cast<entt::entity>(id) };
+		F_ASSERT(m_Registry && "The registry must be valid to add a tile");
+		TileUtils::AddTile(*m_Registry, tile);
 	}
 
 	void TileTool::DrawMouseSprite()
@@ -41,10 +41,12 @@ namespace Feather {
 		bool m_GridSnap;
 
 	protected:
-		uint32_t CheckForTile(const glm::vec2& position);
-
-		Entity CreateEntity();
-		Entity CreateEntity(uint32_t id);
+		/* Checks for a tile entity or a baked tile under the position on the current layer */
+		bool CheckForTile(const glm::vec2& position);
+		/* Removes the tile entity or baked tile under the position on the current layer */
+		bool RemoveTileAt(const glm::vec2& position, Tile& outRemovedTile);
+		/* Bakes the tile into the scene's tilemap if it is static, otherwise creates a tile entity */
+		void AddTile(const Tile& tile);
 
 		void DrawMouseSprite();
 
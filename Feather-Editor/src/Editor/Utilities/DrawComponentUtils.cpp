@@ -74,9 +74,10 @@ namespace Feather {
 		ImGui::PopID();
 	}
 
-	void DrawComponentsUtil::DrawImGuiComponent(SpriteComponent& sprite)
+	bool DrawComponentsUtil::DrawImGuiComponent(SpriteComponent& sprite)
 	{
 		bool IsChanged{ false };
+		bool isEdited{ false };
 
 		ImGui::SeparatorText("Sprite");
 		ImGui::PushID(entt::type_hash<SpriteComponent>::value());
@@ -92,7 +93,10 @@ namespace Feather {
 					std::string textureStr{ texture };
 					F_ASSERT(!textureStr.empty() && "Texture name is empty!");
 					if (!textureStr.empty())
+					{
 						sprite.textureName = textureStr;
+						isEdited = true;
+					}
 				}
 				ImGui::EndDragDropTarget();
 			}
@@ -107,6 +111,7 @@ namespace Feather {
 				sprite.color.g = static_cast<GLubyte>(color.y * 255.0f);
 				sprite.color.b = static_cast<GLubyte>(color.z * 255.0f);
 				sprite.color.a = static_cast<GLubyte>(color.w * 255.0f);
+				isEdited = true;
 			}
 
 			auto& assetManager = MAIN_REGISTRY().GetAssetManager();
@@ -156,6 +161,7 @@ namespace Feather {
 			if (ImGui::InputInt("##layer", &sprite.layer, 1.0f, 1.0f))
 			{
 				sprite.layer = glm::clamp(sprite.layer, 0, 255);
+				isEdited = true;
 			}
 
 			ImGui::InlineLabel("start pos");
@@ -177,7 +183,8 @@ namespace Feather {
 			}
 
 			ImGui::InlineLabel("Iso Sorting");
-			ImGui::Checkbox("##isoSorting", &sprite.isIsometric);
+			if (ImGui::Checkbox("##isoSorting", &sprite.isIsometric))
+				isEdited = true;
 			ImGui::ItemToolTip("If the scene is Isometric, the sprite should use iso sorting.");
 
 			ImGui::TreePop();
@@ -192,11 +199,13 @@ namespace Feather {
 			if (!texture)
 			{
 				F_ERROR("Texture is not valid");
-				return;
+				return true;
 			}
 
 			GenerateUVs(sprite, texture->GetWidth(), texture->GetHeight());
 		}
+
+		return IsChanged || isEdited;
 	}
 
 	void DrawComponentsUtil::DrawImGuiComponent(AnimationComponent& animation)
@@ -584,31 +593,6 @@ namespace Feather {
 		ImGui::PopID();
 	}
 
-	void DrawComponentsUtil::DrawImGuiComponent(Identification& identification)
-	{
-		ImGui::SeparatorText("Identificaton");
-		ImGui::PushID(entt::type_hash<Identification>::value());
-		if (ImGui::TreeNodeEx("", ImGuiTreeNodeFlags_DefaultOpen))
-		{
-			std::string sNameBuffer{ identification.name };
-			ImGui::InlineLabel("name");
-			if (ImGui::InputText("##_name", sNameBuffer.data(), sizeof(char) * 255, ImGuiInputTextFlags_EnterReturnsTrue))
-			{
-				identification.name = std::string{ sNameBuffer.data() };
-			}
-
-			std::string sGroupBuffer{ identification.group };
-			ImGui::InlineLabel("group");
-			if (ImGui::InputText("##_group", sGroupBuffer.data(), sizeof(char) * 255, ImGuiInputTextFlags_EnterReturnsTrue))
-			{
-				identification.group = std::string{ sGroupBuffer.data() };
-			}
-
-			ImGui::TreePop();
-		}
-		ImGui::PopID();
-	}
-
 	void DrawComponentsUtil::DrawImGuiComponent(Entity& entity, TransformComponent& transform)
 	{
 		ImGui::SeparatorText("Transform");
@@ -618,6 +602,7 @@ namespace Feather {
 			const auto& relations = entity.GetComponent<Relationship>();
 			bool hasParent{ relations.parent != entt::null };
 			bool positionChanged{ false };
+			bool transformChanged{ false };
 
 			ImGui::PushItemWidth(120.0f);
 			ImGui::InlineLabel(hasParent ? "relative pos" : "position");
@@ -652,6 +637,7 @@ namespace Feather {
 			{
 				transform.scale.x = std::clamp(transform.scale.x, 0.01f, 150.0f);
 				transform.isDirty = true;
+				transformChanged = true;
 			}
 			ImGui::SameLine();
 			ImGui::ColoredLabel("y##scl_y", LABEL_SINGLE_SIZE, LABEL_GREEN);
@@ -660,12 +646,20 @@ namespace Feather {
 			{
 				transform.scale.y = std::clamp(transform.scale.y, 0.01f, 150.0f);
 				transform.isDirty = true;
+				transformChanged = true;
 			}
 
 			ImGui::InlineLabel("rotation");
 			if (ImGui::InputFloat("##rotation", &transform.rotation, 1.0f, 1.0f, "%.1f"))
 			{
 				transform.isDirty = true;
+				transformChanged = true;
+			}
+
+			// The position is patched by UpdateTransform
+			if (transformChanged)
+			{
+				entity.GetEnttRegistry().patch<TransformComponent>(entity.GetEntity());
 			}
 
 			ImGui::PopItemWidth();
@@ -677,7 +671,9 @@ namespace Feather {
 
 	void DrawComponentsUtil::DrawImGuiComponent(Entity& entity, SpriteComponent& sprite)
 	{
-		DrawImGuiComponent(sprite);
+		// Lets the tile index and the transform system see the new size
+		if (DrawImGuiComponent(sprite))
+			entity.GetEnttRegistry().patch<SpriteComponent>(entity.GetEntity());
 	}
 
 	void DrawComponentsUtil::DrawImGuiComponent(Entity& entity, AnimationComponent& animation)
@@ -727,7 +723,7 @@ namespace Feather {
 				if (!sBufferStr.empty() && !SCENE_MANAGER().CheckTagName(sBufferStr))
 				{
 					std::string sOldName{ identification.name };
-					identification.name = std::string{ nameBuffer.data() };
+					entity.ChangeName(std::string{ nameBuffer.data() });
 					EVENT_DISPATCHER().EmitEvent(NameChangeEvent{ .oldName = sOldName, .newName = identification.name, .entity = &entity });
 				}
 			}
@@ -756,7 +752,8 @@ namespace Feather {
 			ImGui::InlineLabel("group");
 			if (ImGui::InputText("##_group", sGroupBuffer.data(), sizeof(char) * 255, ImGuiInputTextFlags_EnterReturnsTrue))
 			{
-				identification.group = std::string{ sGroupBuffer.data() };
+				// Patched so the tag index sees the change
+				entity.GetEnttRegistry().patch<Identification>(entity.GetEntity(), [&](auto& id) { id.group = std::string{ sGroupBuffer.data() }; });
 			}
 
 			ImGui::TreePop();
@@ -25,14 +25,14 @@ namespace Feather {
 
 	private:
 		static void DrawImGuiComponent(TransformComponent& transform);
-		static void DrawImGuiComponent(SpriteComponent& sprite);
+		/* @brief Returns true if the sprite was edited. */
+		static bool DrawImGuiComponent(SpriteComponent& sprite);
 		static void DrawImGuiComponent(AnimationComponent& animation);
 		static void DrawImGuiComponent(BoxColliderComponent& boxCollider);
 		static void DrawImGuiComponent(CircleColliderComponent& circleCollider);
 		static void DrawImGuiComponent(PhysicsComponent& physics);
 		static void DrawImGuiComponent(RigidBodyComponent& rigidBody);
 		static void DrawImGuiComponent(TextComponent& text);
-		static void DrawImGuiComponent(Identification& identification);
 
 		// Test for Relationships
 		static void DrawImGuiComponent(Entity& entity, TransformComponent& transform);
@@ -7,13 +7,16 @@
 #include "Core/CoreUtils/CoreUtilities.h"
 #include "Core/CoreUtils/EngineShaders.h"
 #include "Core/Resources/AssetManager.h"
+#include "Core/Resources/AssetPack.h"
 #include "Core/Events/EventDispatcher.h"
 #include "Core/Events/EngineEventTypes.h"
 #include "Core/Scripting/InputManager.h"
 #include "Core/Scripting/CrashLoggerTestBindings.h"
 #include "Core/Scripting/ScriptingUtilities.h"
+#include "Core/Scripting/LuaScriptBundle.h"
 #include "Core/Systems/AnimationSystem.h"
 #include "Core/Systems/PhysicsSystem.h"
+#include "Core/Systems/TransformSystem.h"
 #include "Core/Systems/ScriptingSystem.h"
 #include "Core/Systems/RenderSystem.h"
 #include "Core/Systems/RenderUISystem.h"
@@ -27,6 +30,8 @@
 #include "Logger/CrashLogger.h"
 #include "Utils/HelperUtilities.h"
 #include "Utils/FeatherUtilities.h"
+#include "Utils/Timer.h"
+#include "Utils/JobSystem.h"
 #include "Windowing/Window/Window.h"
 #include "Windowing/Input/Mouse.h"
 #include "Windowing/Input/Keyboard.h"
@@ -39,8 +44,46 @@
 #include <glad/glad.h>
 #include <libzippp/libzippp.h>
 
+#ifdef _WIN32
+#include <Windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
 namespace Feather {
 
+	struct ProcessMemory
+	{
+		size_t resident{ 0 };
+		size_t peakResident{ 0 };
+	};
+
+	/* @brief Returns the current and peak resident memory of the process in bytes. */
+	static ProcessMemory GetProcessMemory()
+	{
+		ProcessMemory memory{};
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS memoryCounters{};
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters)))
+		{
+			memory.resident = static_cast<size_t>(memoryCounters.WorkingSetSize);
+			memory.peakResident = static_cast<size_t>(memoryCounters.PeakWorkingSetSize);
+		}
+#else
+		rusage usage{};
+		if (getrusage(RUSAGE_SELF, &usage) == 0)
+			memory.peakResident = static_cast<size_t>(usage.ru_maxrss) * 1024;
+
+		std::ifstream statm{ "/proc/self/statm" };
+		size_t totalPages{ 0 }, residentPages{ 0 };
+		if (statm >> totalPages >> residentPages)
+			memory.resident = residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+		return memory;
+	}
+
 	RuntimeApp::RuntimeApp()
 		: m_Window{ nullptr }
 		, m_Event{}
@@ -67,7 +110,7 @@ namespace Feather {
 
 	void RuntimeApp::Initialize()
 	{
-		F_INIT_LOGS(true, false);
+		F_INIT_LOGS_CONFIG(LogConfig{ .consoleLog = true, .retainLogs = false, .logFile = "game.log" });
 
 		FEATHER_INIT_CRASH_LOGS();
 
@@ -174,9 +217,9 @@ namespace Feather {
 		LoadBindings();
 		CoreEngineData::RegisterMetaFunctions();
 
-		if (m_GameConfig->packageAssets && !LoadZip())
+		if (m_GameConfig->packageAssets && !LoadAssets())
 		{
-			throw std::runtime_error("Failed to load game assets zip file");
+			throw std::runtime_error("Failed to load packaged game assets");
 		}
 
 		if (!LoadScripts())
@@ -193,6 +236,14 @@ namespace Feather {
 
 		sceneManagerData->sceneName = m_GameConfig->startupScene;
 
+		sol::optional<sol::table> optSceneData = (*lua)[m_GameConfig->startupScene + "_data"];
+		if (optSceneData)
+		{
+			sceneManagerData->defaultMusic = (*optSceneData)["default_music"].get_or(std::string{});
+		}
+
+		PreloadSceneAssets(*mainRegistry.GetRegistry(), mainRegistry.GetAssetManager(), sceneManagerData->defaultMusic);
+
 		if (!mainScript->init.valid())
 		{
 			throw std::runtime_error("Failed to initialize main script. init() function is invalid");
@@ -250,7 +301,7 @@ namespace Feather {
 
 		try
 		{
-			lua.safe_script_file(configFile);
+			LuaScriptBundle::RunFile(lua, configFile);
 		}
 		catch (const sol::error& err)
 		{
@@ -307,6 +358,7 @@ namespace Feather {
 		// TODO: Flags
 
 		m_GameConfig->packageAssets = (*maybeConfig)["PackageAssets"].get_or(false);
+		m_GameConfig->assetMemoryBudget = std::max((*maybeConfig)["AssetMemoryBudget"].get_or(0), 0);
 
 		sol::optional<sol::table> maybeAudio = (*maybeConfig)["AudioParams"];
 		if (maybeAudio)
@@ -338,6 +390,9 @@ namespace Feather {
 
 		mainRegistry.AddToContext<std::shared_ptr<ScriptingSystem>>(std::make_shared<ScriptingSystem>());
 
+		auto jobSystem = mainRegistry.AddToContext<SharedJobSystem>(std::make_shared<JobSystem>());
+		mainRegistry.GetAssetManager().SetJobSystem(jobSystem);
+
 		return false;
 	}
 
@@ -424,6 +479,51 @@ namespace Feather {
 		return true;
 	}
 
+	bool RuntimeApp::LoadAssets()
+	{
+		const std::string packPath{ std::format("{}{}{}", "assets", PATH_SEPARATOR, "FeatherAssets.fpack") };
+		const bool usePack{ fs::exists(fs::path{ packPath }) };
+
+		// Only the load step is measured, so packaging the same game with and without the legacy zip option
+		// compares the two formats. The peak is the process peak, it only grows if the load step raised it
+		const auto memoryBefore = GetProcessMemory();
+		Timer loadTimer{};
+		loadTimer.Start();
+
+		// Games packaged before the asset pack format still ship the lua asset zip
+		const bool success = usePack ? LoadAssetPack(packPath) : LoadZip();
+
+		const auto loadTimeMS = loadTimer.ElapsedMS();
+		const auto memoryAfter = GetProcessMemory();
+
+		constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+		F_INFO("Loaded packaged assets from {} in {}ms. Resident memory grew by {:.2f}MB, peak resident memory grew by {:.2f}MB",
+			usePack ? "asset pack" : "asset zip",
+			loadTimeMS,
+			(static_cast<double>(memoryAfter.resident) - static_cast<double>(memoryBefore.resident)) * bytesToMB,
+			static_cast<double>(memoryAfter.peakResident - memoryBefore.peakResident) * bytesToMB);
+
+		return success;
+	}
+
+	bool RuntimeApp::LoadAssetPack(const std::string& packPath)
+	{
+		auto& assetManager = MAIN_REGISTRY().GetAssetManager();
+
+		auto pAssetPack = std::make_shared<AssetPack>();
+		if (!pAssetPack->Open(packPath))
+		{
+			F_ERROR("Failed to open asset pack at path: {}", packPath);
+			return false;
+		}
+
+		// Assets are only registered here. They are loaded on first use or preloaded with their scene
+		assetManager.AddAssetPack(std::move(pAssetPack));
+		assetManager.SetMemoryBudget(static_cast<size_t>(m_GameConfig->assetMemoryBudget) * 1024 * 1024);
+
+		return true;
+	}
+
 	bool RuntimeApp::LoadZip()
 	{
 		auto& assetManager = MAIN_REGISTRY().GetAssetManager();
@@ -637,58 +737,22 @@ namespace Feather {
 		auto& mainRegistry = MAIN_REGISTRY();
 		auto* registry = mainRegistry.GetRegistry();
 
-		double dt = coreGlobals.GetDeltaTime();
 		coreGlobals.UpdateDeltaTime();
 
-		// Clamp delta time to the target frame rate
-		if (dt < TARGET_FRAME_TIME)
-		{
-			std::this_thread::sleep_for(std::chrono::duration<double>(TARGET_FRAME_TIME - dt));
-		}
-
 		auto& scriptSystem = mainRegistry.GetContext<std::shared_ptr<ScriptingSystem>>();
 		scriptSystem->Update(*registry);
 
 		if (coreGlobals.IsPhysicsEnabled() && !coreGlobals.IsPhysicsPaused())
 		{
-			auto& physicsWorld = mainRegistry.GetContext<PhysicsWorld>();
-			physicsWorld->Step(TARGET_FRAME_TIME_F, coreGlobals.GetVelocityIterations(), coreGlobals.GetPositionIterations());
-			physicsWorld->ClearForces();
-
-			auto& dispatch = mainRegistry.GetContext<std::shared_ptr<EventDispatcher>>();
-
-			// If there are no listeners for contact events, don't emit event
-			if (dispatch->HasHandlers<ContactEvent>())
-			{
-				if (auto& contactListener = mainRegistry.GetContext<std::shared_ptr<ContactListener>>())
-				{
-					auto userDataA = contactListener->GetUserDataA();
-					auto userDataB = contactListener->GetUserDataB();
-
-					// Only emit contact event if both contacts are valid
-					if (userDataA && userDataB)
-					{
-						try
-						{
-							auto ObjectA = std::any_cast<ObjectData>(userDataA->userData);
-							auto ObjectB = std::any_cast<ObjectData>(userDataB->userData);
-
-							dispatch->EmitEvent(ContactEvent{ .objectA = ObjectA, .objectB = ObjectB });
-						}
-						catch (const std::bad_any_cast& e)
-						{
-							F_ERROR("Failed to cast to object data: {}", e.what());
-						}
-					}
-				}
-			}
-
 			auto& physicsSystem = mainRegistry.GetPhysicsSystem();
+			physicsSystem.Step(*registry, coreGlobals.GetDeltaTime());
 			physicsSystem.Update(*registry);
 		}
 
 		auto& camera = mainRegistry.GetContext<std::shared_ptr<Camera2D>>();
-		mainRegistry.GetAnimationSystem().Update(*registry, *camera);
+		mainRegistry.GetAnimationSystem().Update(*registry, coreGlobals.GetDeltaTime());
+		// After scripts and physics have moved the entities, so children follow their parents this frame
+		mainRegistry.GetTransformSystem().Update(*registry);
 
 #ifdef DEBUG
 		if (INPUT_MANAGER().GetKeyboard().IsKeyJustPressed(F_KEY_F2))
@@ -700,6 +764,9 @@ namespace Feather {
 		INPUT_MANAGER().UpdateInputs();
 		camera->Update();
 
+		mainRegistry.GetContext<SharedJobSystem>()->RunMainThreadJobs();
+		mainRegistry.GetAssetManager().Update();
+
 		registry->ClearPendingEntities();
 	}
 
@@ -30,6 +30,8 @@ namespace Feather {
 		void LoadBindings();
 		bool LoadScripts();
 		bool LoadPhysics();
+		bool LoadAssets();
+		bool LoadAssetPack(const std::string& packPath);
 		bool LoadZip();
 
 		void ProcessEvents();